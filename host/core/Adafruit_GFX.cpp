@@ -0,0 +1,273 @@
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< Adafruit_GFX.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The parts of the Adafruit GFX library the sketch draws with, for the
+//          host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Text is drawn with the library's classic 5x7 font in 6x8 cells,
+//             and with the library's rules for the background, wrapping, and
+//             the old (not cp437) numbering of the upper characters, so the
+//             screen comes out as it does on the board.
+//
+//          -  Only the printable ASCII characters and the degree sign the
+//             sketch uses are in the font here; anything else draws blank.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Adafruit_GFX.h>
+
+
+
+// The first and last characters of the font table.
+#define FONT_FIRST              0x20
+#define FONT_LAST               0x7E
+
+// Where the degree sign is in the library's font.
+#define FONT_DEGREE             0xF8
+
+
+
+static const uint8_t Font[][ 5 ] =
+{
+   { 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x5F, 0x00, 0x00 },    // ' ' !
+   { 0x00, 0x07, 0x00, 0x07, 0x00 }, { 0x14, 0x7F, 0x14, 0x7F, 0x14 },    //  "  #
+   { 0x24, 0x2A, 0x7F, 0x2A, 0x12 }, { 0x23, 0x13, 0x08, 0x64, 0x62 },    //  $  %
+   { 0x36, 0x49, 0x56, 0x20, 0x50 }, { 0x00, 0x08, 0x07, 0x03, 0x00 },    //  &  '
+   { 0x00, 0x1C, 0x22, 0x41, 0x00 }, { 0x00, 0x41, 0x22, 0x1C, 0x00 },    //  (  )
+   { 0x2A, 0x1C, 0x7F, 0x1C, 0x2A }, { 0x08, 0x08, 0x3E, 0x08, 0x08 },    //  *  +
+   { 0x00, 0x80, 0x70, 0x30, 0x00 }, { 0x08, 0x08, 0x08, 0x08, 0x08 },    //  ,  -
+   { 0x00, 0x00, 0x60, 0x60, 0x00 }, { 0x20, 0x10, 0x08, 0x04, 0x02 },    //  .  /
+   { 0x3E, 0x51, 0x49, 0x45, 0x3E }, { 0x00, 0x42, 0x7F, 0x40, 0x00 },    //  0  1
+   { 0x72, 0x49, 0x49, 0x49, 0x46 }, { 0x21, 0x41, 0x49, 0x4D, 0x33 },    //  2  3
+   { 0x18, 0x14, 0x12, 0x7F, 0x10 }, { 0x27, 0x45, 0x45, 0x45, 0x39 },    //  4  5
+   { 0x3C, 0x4A, 0x49, 0x49, 0x31 }, { 0x41, 0x21, 0x11, 0x09, 0x07 },    //  6  7
+   { 0x36, 0x49, 0x49, 0x49, 0x36 }, { 0x46, 0x49, 0x49, 0x29, 0x1E },    //  8  9
+   { 0x00, 0x00, 0x14, 0x00, 0x00 }, { 0x00, 0x40, 0x34, 0x00, 0x00 },    //  :  ;
+   { 0x00, 0x08, 0x14, 0x22, 0x41 }, { 0x14, 0x14, 0x14, 0x14, 0x14 },    //  <  =
+   { 0x00, 0x41, 0x22, 0x14, 0x08 }, { 0x02, 0x01, 0x59, 0x09, 0x06 },    //  >  ?
+   { 0x3E, 0x41, 0x5D, 0x59, 0x4E }, { 0x7C, 0x12, 0x11, 0x12, 0x7C },    //  @  A
+   { 0x7F, 0x49, 0x49, 0x49, 0x36 }, { 0x3E, 0x41, 0x41, 0x41, 0x22 },    //  B  C
+   { 0x7F, 0x41, 0x41, 0x41, 0x3E }, { 0x7F, 0x49, 0x49, 0x49, 0x41 },    //  D  E
+   { 0x7F, 0x09, 0x09, 0x09, 0x01 }, { 0x3E, 0x41, 0x41, 0x51, 0x73 },    //  F  G
+   { 0x7F, 0x08, 0x08, 0x08, 0x7F }, { 0x00, 0x41, 0x7F, 0x41, 0x00 },    //  H  I
+   { 0x20, 0x40, 0x41, 0x3F, 0x01 }, { 0x7F, 0x08, 0x14, 0x22, 0x41 },    //  J  K
+   { 0x7F, 0x40, 0x40, 0x40, 0x40 }, { 0x7F, 0x02, 0x1C, 0x02, 0x7F },    //  L  M
+   { 0x7F, 0x04, 0x08, 0x10, 0x7F }, { 0x3E, 0x41, 0x41, 0x41, 0x3E },    //  N  O
+   { 0x7F, 0x09, 0x09, 0x09, 0x06 }, { 0x3E, 0x41, 0x51, 0x21, 0x5E },    //  P  Q
+   { 0x7F, 0x09, 0x19, 0x29, 0x46 }, { 0x26, 0x49, 0x49, 0x49, 0x32 },    //  R  S
+   { 0x03, 0x01, 0x7F, 0x01, 0x03 }, { 0x3F, 0x40, 0x40, 0x40, 0x3F },    //  T  U
+   { 0x1F, 0x20, 0x40, 0x20, 0x1F }, { 0x3F, 0x40, 0x38, 0x40, 0x3F },    //  V  W
+   { 0x63, 0x14, 0x08, 0x14, 0x63 }, { 0x03, 0x04, 0x78, 0x04, 0x03 },    //  X  Y
+   { 0x61, 0x59, 0x49, 0x4D, 0x43 }, { 0x00, 0x7F, 0x41, 0x41, 0x41 },    //  Z  [
+   { 0x02, 0x04, 0x08, 0x10, 0x20 }, { 0x00, 0x41, 0x41, 0x41, 0x7F },    //  \  ]
+   { 0x04, 0x02, 0x01, 0x02, 0x04 }, { 0x40, 0x40, 0x40, 0x40, 0x40 },    //  ^  _
+   { 0x00, 0x03, 0x07, 0x08, 0x00 }, { 0x20, 0x54, 0x54, 0x78, 0x40 },    //  `  a
+   { 0x7F, 0x28, 0x44, 0x44, 0x38 }, { 0x38, 0x44, 0x44, 0x44, 0x28 },    //  b  c
+   { 0x38, 0x44, 0x44, 0x28, 0x7F }, { 0x38, 0x54, 0x54, 0x54, 0x18 },    //  d  e
+   { 0x00, 0x08, 0x7E, 0x09, 0x02 }, { 0x18, 0xA4, 0xA4, 0x9C, 0x78 },    //  f  g
+   { 0x7F, 0x08, 0x04, 0x04, 0x78 }, { 0x00, 0x44, 0x7D, 0x40, 0x00 },    //  h  i
+   { 0x20, 0x40, 0x40, 0x3D, 0x00 }, { 0x7F, 0x10, 0x28, 0x44, 0x00 },    //  j  k
+   { 0x00, 0x41, 0x7F, 0x40, 0x00 }, { 0x7C, 0x04, 0x78, 0x04, 0x78 },    //  l  m
+   { 0x7C, 0x08, 0x04, 0x04, 0x78 }, { 0x38, 0x44, 0x44, 0x44, 0x38 },    //  n  o
+   { 0xFC, 0x18, 0x24, 0x24, 0x18 }, { 0x18, 0x24, 0x24, 0x18, 0xFC },    //  p  q
+   { 0x7C, 0x08, 0x04, 0x04, 0x08 }, { 0x48, 0x54, 0x54, 0x54, 0x24 },    //  r  s
+   { 0x04, 0x04, 0x3F, 0x44, 0x24 }, { 0x3C, 0x40, 0x40, 0x20, 0x7C },    //  t  u
+   { 0x1C, 0x20, 0x40, 0x20, 0x1C }, { 0x3C, 0x40, 0x30, 0x40, 0x3C },    //  v  w
+   { 0x44, 0x28, 0x10, 0x28, 0x44 }, { 0x4C, 0x90, 0x90, 0x90, 0x7C },    //  x  y
+   { 0x44, 0x64, 0x54, 0x4C, 0x44 }, { 0x00, 0x08, 0x36, 0x41, 0x00 },    //  z  {
+   { 0x00, 0x00, 0x77, 0x00, 0x00 }, { 0x00, 0x41, 0x36, 0x08, 0x00 },    //  |  }
+   { 0x02, 0x01, 0x02, 0x04, 0x02 }                                       //  ~
+};
+
+static const uint8_t Blank[ 5 ]  = { 0x00, 0x00, 0x00, 0x00, 0x00 };
+static const uint8_t Degree[ 5 ] = { 0x00, 0x06, 0x09, 0x09, 0x06 };
+
+
+
+Adafruit_GFX::Adafruit_GFX ( int16_t Width, int16_t Height )
+   : WIDTH ( Width ), HEIGHT ( Height ), _width ( Width ), _height ( Height )
+{
+}
+
+void Adafruit_GFX::drawFastVLine ( int16_t x, int16_t y, int16_t h, uint16_t Color )
+{
+   for ( int16_t i = 0; i < h; i++ )
+   {
+      drawPixel ( x, y + i, Color );
+   }
+}
+
+void Adafruit_GFX::drawFastHLine ( int16_t x, int16_t y, int16_t w, uint16_t Color )
+{
+   for ( int16_t i = 0; i < w; i++ )
+   {
+      drawPixel ( x + i, y, Color );
+   }
+}
+
+void Adafruit_GFX::fillRect ( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t Color )
+{
+   for ( int16_t i = x; i < x + w; i++ )
+   {
+      drawFastVLine ( i, y, h, Color );
+   }
+}
+
+void Adafruit_GFX::fillScreen ( uint16_t Color )
+{
+   fillRect ( 0, 0, _width, _height, Color );
+}
+
+void Adafruit_GFX::drawLine ( int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t Color )
+{
+   int16_t  dx = abs ( x1 - x0 );
+   int16_t  dy = -abs ( y1 - y0 );
+   int16_t  sx = ( x0 < x1 ) ? 1 : -1;
+   int16_t  sy = ( y0 < y1 ) ? 1 : -1;
+   int16_t  Error = dx + dy;
+   bool     Done = false;
+
+   while ( Done == false )
+   {
+      drawPixel ( x0, y0, Color );
+      Done = ( x0 == x1 && y0 == y1 );
+
+      if ( 2 * Error >= dy )
+      {
+         Error += dy;
+         x0    += ( x0 != x1 ) ? sx : 0;
+      }
+
+      if ( 2 * Error <= dx )
+      {
+         Error += dx;
+         y0    += ( y0 != y1 ) ? sy : 0;
+      }
+   }
+}
+
+void Adafruit_GFX::drawRect ( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t Color )
+{
+   drawFastHLine ( x, y, w, Color );
+   drawFastHLine ( x, y + h - 1, w, Color );
+   drawFastVLine ( x, y, h, Color );
+   drawFastVLine ( x + w - 1, y, h, Color );
+}
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< drawChar >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Draw one character cell, as the library's classic font does.
+//
+// PARAMETERS: x, y - Top left corner of the cell.
+//
+//             c - The character, in the library's numbering.
+//
+//             Color - Color of the character's pixels.
+//
+//             Background - Color of the rest of the cell; if it is the same
+//                          as Color, the rest of the cell is left alone.
+//
+//             Size - How many pixels square each font pixel is.
+//
+// RETURNS:    void
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void Adafruit_GFX::drawChar (
+   int16_t        x,
+   int16_t        y,
+   unsigned char  c,
+   uint16_t       Color,
+   uint16_t       Background,
+   uint8_t        Size
+)
+{
+   const uint8_t* Glyph = Blank;
+
+   if ( _cp437 == false && c >= 176 )
+   {
+      c++;
+   }
+
+   if ( c >= FONT_FIRST && c <= FONT_LAST )
+   {
+      Glyph = Font[ c - FONT_FIRST ];
+   }
+
+   else if ( c == FONT_DEGREE )
+   {
+      Glyph = Degree;
+   }
+
+   if ( x < _width && y < _height && x + 6 * Size - 1 >= 0 && y + 8 * Size - 1 >= 0 )
+   {
+      for ( int8_t i = 0; i < 5; i++ )
+      {
+         uint8_t  Line = Glyph[ i ];
+
+         for ( int8_t j = 0; j < 8; j++, Line >>= 1 )
+         {
+            if ( Line & 1 )
+            {
+               fillRect ( x + i * Size, y + j * Size, Size, Size, Color );
+            }
+
+            else if ( Background != Color )
+            {
+               fillRect ( x + i * Size, y + j * Size, Size, Size, Background );
+            }
+         }
+      }
+
+      if ( Background != Color )
+      {
+         fillRect ( x + 5 * Size, y, Size, 8 * Size, Background );
+      }
+   }
+}
+
+// -------------------------------------------------------------< /drawChar >---
+
+
+
+size_t Adafruit_GFX::write ( uint8_t c )
+{
+   if ( c == '\n' )
+   {
+      cursor_x  = 0;
+      cursor_y += textsize * 8;
+   }
+
+   else if ( c != '\r' )
+   {
+      if ( wrap == true && cursor_x + textsize * 6 > _width )
+      {
+         cursor_x  = 0;
+         cursor_y += textsize * 8;
+      }
+
+      drawChar ( cursor_x, cursor_y, c, textcolor, textbgcolor, textsize );
+      cursor_x += textsize * 6;
+   }
+
+   return 1;
+}
@@ -0,0 +1,76 @@
+#ifndef ADAFRUIT_GFX_H
+#define ADAFRUIT_GFX_H
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< Adafruit_GFX.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The Adafruit graphics library for the host build, drawing text with
+//          the library's built in 5x7 font.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Text is drawn the way the library draws it, so screens drawn on the
+//             host match the board pixel for pixel.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+
+
+
+class Adafruit_GFX : public Print
+{
+   public:
+
+   Adafruit_GFX ( int16_t Width, int16_t Height );
+
+   virtual void drawPixel ( int16_t x, int16_t y, uint16_t Color ) = 0;
+   virtual void drawFastVLine ( int16_t x, int16_t y, int16_t h, uint16_t Color );
+   virtual void drawFastHLine ( int16_t x, int16_t y, int16_t w, uint16_t Color );
+   virtual void fillRect ( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t Color );
+   virtual void fillScreen ( uint16_t Color );
+   void drawLine ( int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t Color );
+   void drawRect ( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t Color );
+   void drawChar ( int16_t x, int16_t y, unsigned char c, uint16_t Color, uint16_t Background, uint8_t Size );
+
+   void setCursor ( int16_t x, int16_t y ) { cursor_x = x; cursor_y = y; }
+   void setTextColor ( uint16_t Color ) { textcolor = textbgcolor = Color; }
+   void setTextColor ( uint16_t Color, uint16_t Background ) { textcolor = Color; textbgcolor = Background; }
+   void setTextSize ( uint8_t Size ) { textsize = ( Size > 0 ) ? Size : 1; }
+   void setTextWrap ( bool Wrap ) { wrap = Wrap; }
+   void cp437 ( bool Enable = true ) { _cp437 = Enable; }
+   int16_t getCursorX () const { return cursor_x; }
+   int16_t getCursorY () const { return cursor_y; }
+   int16_t width () const { return _width; }
+   int16_t height () const { return _height; }
+
+   size_t write ( uint8_t c ) override;
+   using Print::write;
+
+   protected:
+
+   int16_t  WIDTH;
+   int16_t  HEIGHT;
+   int16_t  _width;
+   int16_t  _height;
+   int16_t  cursor_x = 0;
+   int16_t  cursor_y = 0;
+   uint16_t textcolor = 0xFFFF;
+   uint16_t textbgcolor = 0xFFFF;
+   uint8_t  textsize = 1;
+   bool     wrap = true;
+   bool     _cp437 = false;
+};
+
+
+
+#endif   // ADAFRUIT_GFX_H
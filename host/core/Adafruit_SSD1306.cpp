@@ -0,0 +1,266 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------< Adafruit_SSD1306.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The SSD1306 screen driver for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The screen buffer and the commands and data sent over the I2C
+//             bus are laid out as the library lays them out, so the sketch's
+//             own writes to the bus line up with the driver's.
+//
+//          -  Horizontal lines are drawn straight into the buffer a byte at a
+//             time, as the library does, so timing them on the host compares
+//             fairly with other ways of changing the buffer.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - drawFastHLine() straight into the buffer.
+// 16Oct2026 Scott Vance - Last column of display() sent on its own.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Adafruit_SSD1306.h>
+
+
+
+// Most bytes in one I2C transmission, as the library sends them.
+#define WIRE_MAX                32
+
+
+
+Adafruit_SSD1306::Adafruit_SSD1306 ( uint8_t Width, uint8_t Height, TwoWire* Bus, int8_t ResetPin )
+   : Adafruit_GFX ( Width, Height ), wire ( Bus )
+{
+}
+
+Adafruit_SSD1306::~Adafruit_SSD1306 ()
+{
+   delete[] buffer;
+}
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------< begin >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Allocate the screen buffer and send the panel its start up
+//             commands.
+//
+// PARAMETERS: VccState - SSD1306_SWITCHCAPVCC or SSD1306_EXTERNALVCC.
+//
+//             Address - I2C address, or 0 for the usual one for the height.
+//
+//             Reset, PeriphBegin - As for the library.
+//
+// RETURNS:    bool - False if the buffer could not be allocated.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool Adafruit_SSD1306::begin (
+   uint8_t  VccState,
+   uint8_t  Address,
+   bool     Reset,
+   bool     PeriphBegin
+)
+{
+   if ( buffer == NULL )
+   {
+      buffer = new uint8_t[ WIDTH * ( ( HEIGHT + 7 ) / 8 ) ];
+   }
+
+   clearDisplay();
+
+   vccstate = VccState;
+   i2caddr  = ( Address != 0 ) ? Address : ( HEIGHT == 32 ) ? 0x3C : 0x3D;
+
+   if ( PeriphBegin == true )
+   {
+      wire->begin();
+   }
+
+   const uint8_t  Init[] =
+   {
+      SSD1306_DISPLAYOFF,
+      SSD1306_SETDISPLAYCLOCKDIV, 0x80,
+      SSD1306_SETMULTIPLEX, (uint8_t) ( HEIGHT - 1 ),
+      SSD1306_SETDISPLAYOFFSET, 0x00,
+      SSD1306_SETSTARTLINE | 0x00,
+      SSD1306_CHARGEPUMP, (uint8_t) ( ( VccState == SSD1306_EXTERNALVCC ) ? 0x10 : 0x14 ),
+      SSD1306_MEMORYMODE, 0x00,
+      SSD1306_SEGREMAP | 0x01,
+      SSD1306_COMSCANDEC,
+      SSD1306_SETCOMPINS, (uint8_t) ( ( HEIGHT == 32 ) ? 0x02 : 0x12 ),
+      SSD1306_SETCONTRAST, (uint8_t) ( ( VccState == SSD1306_EXTERNALVCC ) ? 0x9F : 0xCF ),
+      SSD1306_SETPRECHARGE, (uint8_t) ( ( VccState == SSD1306_EXTERNALVCC ) ? 0x22 : 0xF1 ),
+      SSD1306_SETVCOMDETECT, 0x40,
+      SSD1306_DISPLAYALLON_RESUME,
+      SSD1306_NORMALDISPLAY,
+      SSD1306_DEACTIVATE_SCROLL,
+      SSD1306_DISPLAYON
+   };
+
+   Commands ( Init, sizeof ( Init ) );
+
+   return buffer != NULL;
+}
+
+// ----------------------------------------------------------------< /begin >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< display >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send the whole screen buffer to the panel.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:      -  The last column is sent in a command transmission of its own,
+//                as the library sends it.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Last column sent on its own.
+//
+// -----------------------------------------------------------------------------
+
+void Adafruit_SSD1306::display ()
+{
+   const uint8_t  Window[] =
+   {
+      SSD1306_PAGEADDR, 0x00, 0xFF,
+      SSD1306_COLUMNADDR, 0x00
+   };
+   const uint8_t  LastColumn = WIDTH - 1;
+   size_t         Count = WIDTH * ( ( HEIGHT + 7 ) / 8 );
+   size_t         Sent = 0;
+
+   Commands ( Window, sizeof ( Window ) );
+   Commands ( &LastColumn, 1 );
+
+   while ( Sent < Count )
+   {
+      size_t   Chunk = min ( Count - Sent, (size_t) ( WIRE_MAX - 1 ) );
+
+      wire->beginTransmission ( i2caddr );
+      wire->write ( (uint8_t) 0x40 );
+      wire->write ( buffer + Sent, Chunk );
+      wire->endTransmission();
+      Sent += Chunk;
+   }
+}
+
+// --------------------------------------------------------------< /display >---
+
+
+
+void Adafruit_SSD1306::clearDisplay ()
+{
+   if ( buffer != NULL )
+   {
+      memset ( buffer, 0, WIDTH * ( ( HEIGHT + 7 ) / 8 ) );
+   }
+}
+
+void Adafruit_SSD1306::invertDisplay ( bool Invert )
+{
+   ssd1306_command ( Invert ? SSD1306_INVERTDISPLAY : SSD1306_NORMALDISPLAY );
+}
+
+void Adafruit_SSD1306::dim ( bool Dim )
+{
+   const uint8_t  Contrast[] =
+   {
+      SSD1306_SETCONTRAST,
+      (uint8_t) ( Dim ? 0x00 : ( vccstate == SSD1306_EXTERNALVCC ) ? 0x9F : 0xCF )
+   };
+
+   Commands ( Contrast, sizeof ( Contrast ) );
+}
+
+void Adafruit_SSD1306::drawPixel ( int16_t x, int16_t y, uint16_t Color )
+{
+   if ( buffer != NULL && x >= 0 && x < _width && y >= 0 && y < _height )
+   {
+      uint8_t* Byte = &buffer[ x + ( y / 8 ) * WIDTH ];
+      uint8_t  Bit = 1 << ( y & 7 );
+
+      *Byte = ( Color == SSD1306_WHITE ) ? *Byte | Bit
+            : ( Color == SSD1306_BLACK ) ? *Byte & ~Bit
+            : ( Color == SSD1306_INVERSE ) ? *Byte ^ Bit
+            : *Byte;
+   }
+}
+
+void Adafruit_SSD1306::drawFastHLine ( int16_t x, int16_t y, int16_t w, uint16_t Color )
+{
+   if ( buffer != NULL && y >= 0 && y < _height )
+   {
+      if ( x < 0 )
+      {
+         w += x;
+         x  = 0;
+      }
+
+      w = min ( w, (int16_t) ( _width - x ) );
+
+      uint8_t* Byte = &buffer[ x + ( y / 8 ) * WIDTH ];
+      uint8_t  Bit = 1 << ( y & 7 );
+
+      for ( ; w > 0; w--, Byte++ )
+      {
+         *Byte = ( Color == SSD1306_WHITE ) ? *Byte | Bit
+               : ( Color == SSD1306_BLACK ) ? *Byte & ~Bit
+               : ( Color == SSD1306_INVERSE ) ? *Byte ^ Bit
+               : *Byte;
+      }
+   }
+}
+
+bool Adafruit_SSD1306::getPixel ( int16_t x, int16_t y )
+{
+   return buffer != NULL && x >= 0 && x < _width && y >= 0 && y < _height
+          && ( buffer[ x + ( y / 8 ) * WIDTH ] & ( 1 << ( y & 7 ) ) );
+}
+
+uint8_t* Adafruit_SSD1306::getBuffer ()
+{
+   return buffer;
+}
+
+void Adafruit_SSD1306::ssd1306_command ( uint8_t Command )
+{
+   Commands ( &Command, 1 );
+}
+
+void Adafruit_SSD1306::Commands ( const uint8_t* List, uint8_t Count )
+{
+   uint8_t  Sent = 0;
+
+   while ( Sent < Count )
+   {
+      uint8_t  Chunk = min ( (uint8_t) ( Count - Sent ), (uint8_t) ( WIRE_MAX - 1 ) );
+
+      wire->beginTransmission ( i2caddr );
+      wire->write ( (uint8_t) 0x00 );
+      wire->write ( List + Sent, Chunk );
+      wire->endTransmission();
+      Sent += Chunk;
+   }
+}
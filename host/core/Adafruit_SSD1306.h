@@ -0,0 +1,93 @@
+#ifndef ADAFRUIT_SSD1306_H
+#define ADAFRUIT_SSD1306_H
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------< Adafruit_SSD1306.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The Adafruit SSD1306 screen driver for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The frame buffer is sent over the Wire stand-in in the same
+//             transmissions as the library sends it.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Adafruit_GFX.h>
+#include <Wire.h>
+
+
+
+#define BLACK                          0
+#define WHITE                          1
+#define INVERSE                        2
+#define SSD1306_BLACK                  0
+#define SSD1306_WHITE                  1
+#define SSD1306_INVERSE                2
+
+#define SSD1306_MEMORYMODE             0x20
+#define SSD1306_COLUMNADDR             0x21
+#define SSD1306_PAGEADDR               0x22
+#define SSD1306_SETCONTRAST            0x81
+#define SSD1306_CHARGEPUMP             0x8D
+#define SSD1306_SEGREMAP               0xA0
+#define SSD1306_DISPLAYALLON_RESUME    0xA4
+#define SSD1306_NORMALDISPLAY          0xA6
+#define SSD1306_INVERTDISPLAY          0xA7
+#define SSD1306_SETMULTIPLEX           0xA8
+#define SSD1306_DISPLAYOFF             0xAE
+#define SSD1306_DISPLAYON              0xAF
+#define SSD1306_COMSCANDEC             0xC8
+#define SSD1306_SETDISPLAYOFFSET       0xD3
+#define SSD1306_SETDISPLAYCLOCKDIV     0xD5
+#define SSD1306_SETPRECHARGE           0xD9
+#define SSD1306_SETCOMPINS             0xDA
+#define SSD1306_SETVCOMDETECT          0xDB
+#define SSD1306_SETSTARTLINE           0x40
+#define SSD1306_DEACTIVATE_SCROLL      0x2E
+
+#define SSD1306_EXTERNALVCC            0x01
+#define SSD1306_SWITCHCAPVCC           0x02
+
+
+
+class Adafruit_SSD1306 : public Adafruit_GFX
+{
+   public:
+
+   Adafruit_SSD1306 ( uint8_t Width, uint8_t Height, TwoWire* Bus = &Wire, int8_t ResetPin = -1 );
+   ~Adafruit_SSD1306 ();
+
+   bool begin ( uint8_t VccState = SSD1306_SWITCHCAPVCC, uint8_t Address = 0, bool Reset = true, bool PeriphBegin = true );
+   void display ();
+   void clearDisplay ();
+   void invertDisplay ( bool Invert );
+   void dim ( bool Dim );
+   void drawPixel ( int16_t x, int16_t y, uint16_t Color ) override;
+   void drawFastHLine ( int16_t x, int16_t y, int16_t w, uint16_t Color ) override;
+   bool getPixel ( int16_t x, int16_t y );
+   uint8_t* getBuffer ();
+   void ssd1306_command ( uint8_t Command );
+
+   private:
+
+   void Commands ( const uint8_t* List, uint8_t Count );
+
+   TwoWire* wire;
+   uint8_t* buffer = NULL;
+   uint8_t  i2caddr = 0;
+   uint8_t  vccstate = SSD1306_SWITCHCAPVCC;
+};
+
+
+
+#endif   // ADAFRUIT_SSD1306_H
@@ -0,0 +1,164 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< Arduino.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The part of the Arduino/ESP8266 core the sketch uses, for building
+//          it on a development machine (see HostCore.h).
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Only what the sketch uses is here, declared the same way as in
+//             the ESP8266 core so the sketch compiles unchanged.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+
+using std::min;
+using std::max;
+
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "HardwareSerial.h"
+#include "Esp.h"
+
+
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define HIGH            0x1
+#define LOW             0x0
+
+#define INPUT           0x00
+#define INPUT_PULLUP    0x02
+#define OUTPUT          0x01
+
+// NodeMCU pin names and their GPIO numbers.
+#define D0              16
+#define D1              5
+#define D2              4
+#define D3              0
+#define D4              2
+#define D5              14
+#define D6              12
+#define D7              13
+#define D8              15
+#define LED_BUILTIN     2
+
+#define PROGMEM
+#define PGM_P           const char*
+#define PSTR(s)         (s)
+#define F(s)            (s)
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+
+
+void pinMode (
+   uint8_t  Pin,
+   uint8_t  Mode
+);
+
+void digitalWrite (
+   uint8_t  Pin,
+   uint8_t  Value
+);
+
+int digitalRead (
+   uint8_t  Pin
+);
+
+int analogRead (
+   uint8_t  Pin
+);
+
+void delay (
+   unsigned long Milliseconds
+);
+
+void delayMicroseconds (
+   unsigned int  Microseconds
+);
+
+unsigned long millis ();
+
+unsigned long micros ();
+
+void yield ();
+
+long random (
+   long  Max
+);
+
+long random (
+   long  Min,
+   long  Max
+);
+
+void randomSeed (
+   unsigned long Seed
+);
+
+
+
+//
+// SDK software timers.  The callback is run as the virtual clock passes the
+// time it is due (see HostAdvance).
+//
+extern "C"
+{
+   typedef void os_timer_func_t ( void* Arg );
+
+   typedef struct _ETSTIMER_
+   {
+      struct _ETSTIMER_* timer_next;
+      uint64_t           timer_expire;
+      uint32_t           timer_period;
+      os_timer_func_t*   timer_func;
+      void*              timer_arg;
+      bool               timer_armed;
+   } os_timer_t;
+
+   void os_timer_setfn (
+      os_timer_t*       Timer,
+      os_timer_func_t*  Function,
+      void*             Arg
+   );
+
+   void os_timer_arm (
+      os_timer_t*       Timer,
+      uint32_t          Milliseconds,
+      bool              Repeat
+   );
+
+   void os_timer_disarm (
+      os_timer_t*       Timer
+   );
+}
+
+
+
+#endif   // ARDUINO_H
@@ -0,0 +1,858 @@
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< ArduinoJson.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The part of version 5 of the ArduinoJson library the sketch uses,
+//          for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Text is parsed in place, as the library does with a char*: the
+//             strings of the parsed values point into the text, which has
+//             its quotes and escapes taken out.
+//
+//          -  Printing to a buffer stops when it is full, and returns only
+//             what fit; measureLength() returns the whole length.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ArduinoJson.h>
+
+
+
+// Spaces each level of pretty text is indented by.
+#define JSON_INDENT             2
+
+
+
+//
+// Where text is printed to: a buffer that may be too small, or nowhere at all
+// when only the length is wanted.
+//
+
+typedef struct JSON_OUT
+{
+   char*    Buffer;
+   size_t   Size;
+   size_t   Written;
+   size_t   Length;
+   bool     Pretty;
+   int      Level;
+} JOut_t;
+
+static void JsonPrint ( JOut_t* Out, const JsonVariant& Value );
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< Support >---
+// -----------------------------------------------------------------------------
+
+static void Put (
+   JOut_t*     Out,
+   const char* Text,
+   size_t      Length
+)
+{
+   for ( size_t i = 0; i < Length; i++ )
+   {
+      if ( Out->Buffer != NULL && Out->Written + 1 < Out->Size )
+      {
+         Out->Buffer[ Out->Written++ ] = Text[ i ];
+      }
+
+      Out->Length++;
+   }
+}
+
+static void Put (
+   JOut_t*     Out,
+   const char* Text
+)
+{
+   Put ( Out, Text, strlen ( Text ) );
+}
+
+static void NewLine (
+   JOut_t*  Out
+)
+{
+   if ( Out->Pretty == true )
+   {
+      Put ( Out, "\r\n" );
+
+      for ( int i = 0; i < Out->Level * JSON_INDENT; i++ )
+      {
+         Put ( Out, " " );
+      }
+   }
+}
+
+static void PutString (
+   JOut_t*     Out,
+   const char* Text
+)
+{
+   Put ( Out, "\"" );
+
+   for ( const char* c = Text; *c != '\0'; c++ )
+   {
+      const char* Escape = strchr ( "\"\\\b\f\n\r\t", *c );
+
+      if ( Escape != NULL )
+      {
+         char  Pair[ 2 ] = { '\\', "\"\\bfnrt"[ Escape - "\"\\\b\f\n\r\t" ] };
+
+         Put ( Out, Pair, 2 );
+      }
+
+      else
+      {
+         Put ( Out, c, 1 );
+      }
+   }
+
+   Put ( Out, "\"" );
+}
+
+static size_t Finish (
+   JOut_t*  Out
+)
+{
+   if ( Out->Buffer != NULL && Out->Size > 0 )
+   {
+      Out->Buffer[ Out->Written ] = '\0';
+   }
+
+   return Out->Written;
+}
+
+static void PutArray (
+   JOut_t*           Out,
+   const JsonArray&  Array
+)
+{
+   Put ( Out, "[" );
+   Out->Level++;
+
+   for ( JsonArray::Node* Each = Array.Head; Each != NULL; Each = Each->Next )
+   {
+      NewLine ( Out );
+      JsonPrint ( Out, Each->Value );
+
+      if ( Each->Next != NULL )
+      {
+         Put ( Out, "," );
+      }
+   }
+
+   Out->Level--;
+
+   if ( Array.Head != NULL )
+   {
+      NewLine ( Out );
+   }
+
+   Put ( Out, "]" );
+}
+
+static void PutObject (
+   JOut_t*           Out,
+   const JsonObject& Object
+)
+{
+   Put ( Out, "{" );
+   Out->Level++;
+
+   for ( JsonObject::Node* Each = Object.Head; Each != NULL; Each = Each->Next )
+   {
+      NewLine ( Out );
+      PutString ( Out, Each->Key );
+      Put ( Out, Out->Pretty ? ": " : ":" );
+      JsonPrint ( Out, Each->Value );
+
+      if ( Each->Next != NULL )
+      {
+         Put ( Out, "," );
+      }
+   }
+
+   Out->Level--;
+
+   if ( Object.Head != NULL )
+   {
+      NewLine ( Out );
+   }
+
+   Put ( Out, "}" );
+}
+
+static void JsonPrint (
+   JOut_t*              Out,
+   const JsonVariant&   Value
+)
+{
+   char  Number[ 32 ];
+
+   switch ( Value.Type )
+   {
+      case JsonVariant::RAW:
+         Put ( Out, Value.Value.String );
+         break;
+
+      case JsonVariant::STRING:
+         PutString ( Out, Value.Value.String );
+         break;
+
+      case JsonVariant::INTEGER:
+         sprintf ( Number, "%lld", (long long) Value.Value.Integer );
+         Put ( Out, Number );
+         break;
+
+      case JsonVariant::FLOAT:
+         sprintf ( Number, "%.*f", Value.Places, Value.Value.Float );
+         Put ( Out, Number );
+         break;
+
+      case JsonVariant::BOOLEAN:
+         Put ( Out, Value.Value.Boolean ? "true" : "false" );
+         break;
+
+      case JsonVariant::ARRAY:
+         PutArray ( Out, *Value.Value.Array );
+         break;
+
+      case JsonVariant::OBJECT:
+         PutObject ( Out, *Value.Value.Object );
+         break;
+
+      default:
+         Put ( Out, "null" );
+         break;
+   }
+}
+
+// --------------------------------------------------------------< /Support >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------------< Parser >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Parse JSON text in place into values taken from a JsonBuffer.
+//
+// NOTES:      -  Each function takes the text at *Text, moves *Text past what
+//                it used, and returns false if the text is not good JSON or
+//                the buffer ran out.
+//
+// -----------------------------------------------------------------------------
+
+static bool ParseValue ( JsonBuffer* Buffer, char** Text, JsonVariant* Value );
+
+static void SkipSpace (
+   char**   Text
+)
+{
+   while ( isspace ( (unsigned char) **Text ) )
+   {
+      (*Text)++;
+   }
+}
+
+static bool ParseString (
+   char**         Text,
+   const char**   Value
+)
+{
+   char  Quote = **Text;
+   char* To;
+   bool  Good = ( Quote == '"' || Quote == '\'' );
+
+   if ( Good == true )
+   {
+      (*Text)++;
+      *Value = To = *Text;
+
+      while ( **Text != Quote && **Text != '\0' )
+      {
+         if ( **Text == '\\' && (*Text)[ 1 ] != '\0' )
+         {
+            const char* Escape = strchr ( "\"\"\\\\//b\bf\fn\nr\rt\t", (*Text)[ 1 ] );
+
+            *To++   = ( Escape != NULL ) ? Escape[ 1 ] : (*Text)[ 1 ];
+            (*Text) += 2;
+         }
+
+         else
+         {
+            *To++ = *(*Text)++;
+         }
+      }
+
+      Good = ( **Text == Quote );
+
+      if ( Good == true )
+      {
+         (*Text)++;
+         *To = '\0';
+      }
+   }
+
+   return Good;
+}
+
+static bool ParseArray (
+   JsonBuffer* Buffer,
+   char**      Text,
+   JsonArray&  Array
+)
+{
+   bool  Good = Array.success();
+
+   (*Text)++;
+   SkipSpace ( Text );
+
+   if ( **Text == ']' )
+   {
+      (*Text)++;
+   }
+
+   else
+   {
+      bool  More = Good;
+
+      while ( More == true )
+      {
+         JsonVariant Value;
+
+         Good = ParseValue ( Buffer, Text, &Value ) && Array.add ( Value );
+         SkipSpace ( Text );
+         More = ( Good == true && **Text == ',' );
+         Good = Good && ( **Text == ',' || **Text == ']' );
+         (*Text) += ( Good == true ) ? 1 : 0;
+      }
+   }
+
+   return Good;
+}
+
+static bool ParseObject (
+   JsonBuffer* Buffer,
+   char**      Text,
+   JsonObject& Object
+)
+{
+   bool  Good = Object.success();
+
+   (*Text)++;
+   SkipSpace ( Text );
+
+   if ( **Text == '}' )
+   {
+      (*Text)++;
+   }
+
+   else
+   {
+      bool  More = Good;
+
+      while ( More == true )
+      {
+         const char* Key = NULL;
+         JsonVariant Value;
+
+         SkipSpace ( Text );
+         Good = ParseString ( Text, &Key );
+         SkipSpace ( Text );
+         Good = Good && *(*Text)++ == ':';
+         Good = Good && ParseValue ( Buffer, Text, &Value ) && Object.set ( Key, Value );
+         SkipSpace ( Text );
+         More = ( Good == true && **Text == ',' );
+         Good = Good && ( **Text == ',' || **Text == '}' );
+         (*Text) += ( Good == true ) ? 1 : 0;
+      }
+   }
+
+   return Good;
+}
+
+static bool ParseValue (
+   JsonBuffer*    Buffer,
+   char**         Text,
+   JsonVariant*   Value
+)
+{
+   bool  Good = true;
+
+   SkipSpace ( Text );
+
+   if ( **Text == '{' )
+   {
+      JsonObject& Object = Buffer->createObject();
+
+      *Value = JsonVariant ( Object );
+      Good   = ParseObject ( Buffer, Text, Object );
+   }
+
+   else if ( **Text == '[' )
+   {
+      JsonArray&  Array = Buffer->createArray();
+
+      *Value = JsonVariant ( Array );
+      Good   = ParseArray ( Buffer, Text, Array );
+   }
+
+   else if ( **Text == '"' || **Text == '\'' )
+   {
+      const char* String = NULL;
+
+      Good   = ParseString ( Text, &String );
+      *Value = JsonVariant ( String );
+   }
+
+   else if ( strncmp ( *Text, "true", 4 ) == 0 || strncmp ( *Text, "false", 5 ) == 0 )
+   {
+      *Value  = JsonVariant ( **Text == 't' );
+      (*Text) += ( **Text == 't' ) ? 4 : 5;
+   }
+
+   else if ( strncmp ( *Text, "null", 4 ) == 0 )
+   {
+      *Value      = JsonVariant();
+      Value->Type = JsonVariant::NUL;
+      (*Text)    += 4;
+   }
+
+   else
+   {
+      char* End = *Text + strspn ( *Text, "+-0123456789.eE" );
+      bool  Float = ( strpbrk ( std::string ( *Text, End ).c_str(), ".eE" ) != NULL );
+
+      Good = ( End != *Text );
+
+      if ( Float == true )
+      {
+         *Value = JsonVariant ( strtod ( *Text, NULL ) );
+      }
+
+      else
+      {
+         // A long on the ESP8266 is 32 bits.
+         *Value = JsonVariant ( (int32_t) strtoll ( *Text, NULL, 10 ) );
+      }
+
+      *Text = End;
+   }
+
+   return Good;
+}
+
+// ---------------------------------------------------------------< /Parser >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< JsonVariant >---
+// -----------------------------------------------------------------------------
+
+JsonVariant::JsonVariant ( JsonArray& Array ) : Type ( Array.success() ? ARRAY : UNDEFINED )
+{
+   Value.Array = &Array;
+}
+
+JsonVariant::JsonVariant ( JsonObject& Object ) : Type ( Object.success() ? OBJECT : UNDEFINED )
+{
+   Value.Object = &Object;
+}
+
+int64_t JsonVariant::AsInteger () const
+{
+   return ( Type == INTEGER )                  ? Value.Integer
+        : ( Type == FLOAT )                    ? (int64_t) Value.Float
+        : ( Type == BOOLEAN )                  ? Value.Boolean
+        : ( Type == STRING || Type == RAW )    ? (int32_t) strtoll ( Value.String, NULL, 10 )
+        : 0;
+}
+
+double JsonVariant::AsFloat () const
+{
+   return ( Type == FLOAT )                    ? Value.Float
+        : ( Type == INTEGER )                  ? (double) Value.Integer
+        : ( Type == BOOLEAN )                  ? Value.Boolean
+        : ( Type == STRING || Type == RAW )    ? strtod ( Value.String, NULL )
+        : 0.0;
+}
+
+bool JsonVariant::AsBool () const
+{
+   return ( Type == BOOLEAN )                  ? Value.Boolean
+        : ( Type == INTEGER )                  ? Value.Integer != 0
+        : ( Type == STRING || Type == RAW )    ? strcmp ( Value.String, "true" ) == 0
+        : false;
+}
+
+const char* JsonVariant::AsString () const
+{
+   return ( Type == STRING || Type == RAW ) ? Value.String : NULL;
+}
+
+JsonArray& JsonVariant::AsArray () const
+{
+   return ( Type == ARRAY ) ? *Value.Array : JsonArray::invalid();
+}
+
+JsonObject& JsonVariant::AsObject () const
+{
+   return ( Type == OBJECT ) ? *Value.Object : JsonObject::invalid();
+}
+
+JsonVariant JsonVariant::operator[] ( const char* Key ) const
+{
+   return AsObject().get ( Key );
+}
+
+JsonVariant JsonVariant::operator[] ( int Index ) const
+{
+   return AsArray()[ Index ];
+}
+
+size_t JsonVariant::printTo ( char* Buffer, size_t Size ) const
+{
+   JOut_t   Out = { Buffer, Size, 0, 0, false, 0 };
+
+   JsonPrint ( &Out, *this );
+
+   return Finish ( &Out );
+}
+
+size_t JsonVariant::measureLength () const
+{
+   JOut_t   Out = { NULL, 0, 0, 0, false, 0 };
+
+   JsonPrint ( &Out, *this );
+
+   return Out.Length;
+}
+
+// ----------------------------------------------------------< /JsonVariant >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< JsonBuffer >---
+// -----------------------------------------------------------------------------
+
+void* JsonBuffer::alloc ( size_t Bytes )
+{
+   void* Block = NULL;
+
+   // Keep every block aligned as the pool is.
+   Bytes = ( Bytes + 7 ) & ~(size_t) 7;
+
+   if ( Used + Bytes <= Capacity )
+   {
+      Block = Pool + Used;
+      Used += Bytes;
+   }
+
+   return Block;
+}
+
+JsonObject& JsonBuffer::createObject ()
+{
+   void* Block = alloc ( sizeof ( JsonObject ) );
+
+   return ( Block != NULL ) ? *new ( Block ) JsonObject ( this ) : JsonObject::invalid();
+}
+
+JsonArray& JsonBuffer::createArray ()
+{
+   void* Block = alloc ( sizeof ( JsonArray ) );
+
+   return ( Block != NULL ) ? *new ( Block ) JsonArray ( this ) : JsonArray::invalid();
+}
+
+JsonObject& JsonBuffer::parseObject ( char* Json )
+{
+   JsonVariant Value;
+   bool        Good = ( Json != NULL && ParseValue ( this, &Json, &Value ) );
+
+   return ( Good == true ) ? Value.as<JsonObject>() : JsonObject::invalid();
+}
+
+JsonObject& JsonBuffer::parseObject ( const char* Json )
+{
+   char* Copy = ( Json != NULL ) ? (char*) alloc ( strlen ( Json ) + 1 ) : NULL;
+
+   if ( Copy != NULL )
+   {
+      strcpy ( Copy, Json );
+   }
+
+   return parseObject ( Copy );
+}
+
+JsonArray& JsonBuffer::parseArray ( char* Json )
+{
+   JsonVariant Value;
+   bool        Good = ( Json != NULL && ParseValue ( this, &Json, &Value ) );
+
+   return ( Good == true ) ? Value.as<JsonArray>() : JsonArray::invalid();
+}
+
+// -----------------------------------------------------------< /JsonBuffer >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< JsonArray >---
+// -----------------------------------------------------------------------------
+
+JsonArray& JsonArray::invalid ()
+{
+   static JsonArray  Invalid ( NULL );
+
+   return Invalid;
+}
+
+bool JsonArray::add ( const JsonVariant& Value )
+{
+   Node* Each = ( Buffer != NULL ) ? (Node*) Buffer->alloc ( sizeof ( Node ) ) : NULL;
+
+   if ( Each != NULL )
+   {
+      new ( Each ) Node { Value, NULL };
+      ( ( Tail != NULL ) ? Tail->Next : Head ) = Each;
+      Tail = Each;
+   }
+
+   return Each != NULL;
+}
+
+JsonArray& JsonArray::createNestedArray ()
+{
+   JsonArray&  Array = ( Buffer != NULL ) ? Buffer->createArray() : invalid();
+
+   add ( JsonVariant ( Array ) );
+
+   return Array;
+}
+
+JsonObject& JsonArray::createNestedObject ()
+{
+   JsonObject& Object = ( Buffer != NULL ) ? Buffer->createObject() : JsonObject::invalid();
+
+   add ( JsonVariant ( Object ) );
+
+   return Object;
+}
+
+JsonVariant JsonArray::operator[] ( size_t Index ) const
+{
+   Node* Each = Head;
+
+   for ( ; Each != NULL && Index > 0; Index-- )
+   {
+      Each = Each->Next;
+   }
+
+   return ( Each != NULL ) ? Each->Value : JsonVariant();
+}
+
+size_t JsonArray::size () const
+{
+   size_t   Count = 0;
+
+   for ( Node* Each = Head; Each != NULL; Each = Each->Next )
+   {
+      Count++;
+   }
+
+   return Count;
+}
+
+size_t JsonArray::printTo ( char* Text, size_t Size ) const
+{
+   JOut_t   Out = { Text, Size, 0, 0, false, 0 };
+
+   PutArray ( &Out, *this );
+
+   return Finish ( &Out );
+}
+
+size_t JsonArray::prettyPrintTo ( char* Text, size_t Size ) const
+{
+   JOut_t   Out = { Text, Size, 0, 0, true, 0 };
+
+   PutArray ( &Out, *this );
+
+   return Finish ( &Out );
+}
+
+size_t JsonArray::measureLength () const
+{
+   JOut_t   Out = { NULL, 0, 0, 0, false, 0 };
+
+   PutArray ( &Out, *this );
+
+   return Out.Length;
+}
+
+size_t JsonArray::measurePrettyLength () const
+{
+   JOut_t   Out = { NULL, 0, 0, 0, true, 0 };
+
+   PutArray ( &Out, *this );
+
+   return Out.Length;
+}
+
+// ------------------------------------------------------------< /JsonArray >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< JsonObject >---
+// -----------------------------------------------------------------------------
+
+JsonObject& JsonObject::invalid ()
+{
+   static JsonObject Invalid ( NULL );
+
+   return Invalid;
+}
+
+JsonObject::Node* JsonObject::Find ( const char* Key ) const
+{
+   Node* Each = Head;
+
+   while ( Each != NULL && strcmp ( Each->Key, Key ) != 0 )
+   {
+      Each = Each->Next;
+   }
+
+   return Each;
+}
+
+JsonObjectSubscript JsonObject::operator[] ( const char* Key )
+{
+   return JsonObjectSubscript ( *this, Key );
+}
+
+JsonVariant JsonObject::get ( const char* Key ) const
+{
+   Node* Each = Find ( Key );
+
+   return ( Each != NULL ) ? Each->Value : JsonVariant();
+}
+
+bool JsonObject::set ( const char* Key, const JsonVariant& Value )
+{
+   Node* Each = ( Buffer != NULL ) ? Find ( Key ) : NULL;
+
+   if ( Each == NULL && Buffer != NULL )
+   {
+      Each = (Node*) Buffer->alloc ( sizeof ( Node ) );
+
+      if ( Each != NULL )
+      {
+         new ( Each ) Node { Key, JsonVariant(), NULL };
+         ( ( Tail != NULL ) ? Tail->Next : Head ) = Each;
+         Tail = Each;
+      }
+   }
+
+   if ( Each != NULL )
+   {
+      Each->Value = Value;
+   }
+
+   return Each != NULL;
+}
+
+JsonArray& JsonObject::createNestedArray ( const char* Key )
+{
+   JsonArray&  Array = ( Buffer != NULL ) ? Buffer->createArray() : JsonArray::invalid();
+
+   set ( Key, JsonVariant ( Array ) );
+
+   return Array;
+}
+
+JsonObject& JsonObject::createNestedObject ( const char* Key )
+{
+   JsonObject& Object = ( Buffer != NULL ) ? Buffer->createObject() : invalid();
+
+   set ( Key, JsonVariant ( Object ) );
+
+   return Object;
+}
+
+size_t JsonObject::size () const
+{
+   size_t   Count = 0;
+
+   for ( Node* Each = Head; Each != NULL; Each = Each->Next )
+   {
+      Count++;
+   }
+
+   return Count;
+}
+
+size_t JsonObject::printTo ( char* Text, size_t Size ) const
+{
+   JOut_t   Out = { Text, Size, 0, 0, false, 0 };
+
+   PutObject ( &Out, *this );
+
+   return Finish ( &Out );
+}
+
+size_t JsonObject::printTo ( String& Text ) const
+{
+   std::string Whole ( measureLength() + 1, '\0' );
+   size_t      Length = printTo ( &Whole[ 0 ], Whole.size() );
+
+   Text = Whole.c_str();
+
+   return Length;
+}
+
+size_t JsonObject::prettyPrintTo ( char* Text, size_t Size ) const
+{
+   JOut_t   Out = { Text, Size, 0, 0, true, 0 };
+
+   PutObject ( &Out, *this );
+
+   return Finish ( &Out );
+}
+
+size_t JsonObject::measureLength () const
+{
+   JOut_t   Out = { NULL, 0, 0, 0, false, 0 };
+
+   PutObject ( &Out, *this );
+
+   return Out.Length;
+}
+
+size_t JsonObject::measurePrettyLength () const
+{
+   JOut_t   Out = { NULL, 0, 0, 0, true, 0 };
+
+   PutObject ( &Out, *this );
+
+   return Out.Length;
+}
+
+// -----------------------------------------------------------< /JsonObject >---
@@ -0,0 +1,435 @@
+#ifndef ARDUINO_JSON_H
+#define ARDUINO_JSON_H
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< ArduinoJson.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The part of version 5 of the ArduinoJson library the sketch uses,
+//          for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Objects and arrays are lists of nodes taken from a fixed buffer,
+//             parsing is done in place, and text is written the same way as
+//             by the library (pretty text indented two spaces, lines ending
+//             in CR LF), so the sketch behaves as it does with the library.
+//
+//          -  Integers parsed from text are kept as a long of the ESP8266 (32
+//             bits), so values too big for one wrap as they do on the board.
+//
+//          -  Build with ARDUINOJSON=<path to ArduinoJson 5 src> to use the
+//             real library instead (see the Makefile).
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <type_traits>
+
+
+
+class JsonArray;
+class JsonObject;
+class JsonBuffer;
+class JsonObjectSubscript;
+
+struct RawJsonString
+{
+   const char* p;
+};
+
+inline RawJsonString RawJson ( const char* Text ) { return { Text }; }
+
+
+
+// What as<T>() returns: a reference for objects and arrays, a value otherwise.
+template< typename T > struct JsonVariantAs                { typedef T           type; };
+template<> struct JsonVariantAs< JsonArray >               { typedef JsonArray&  type; };
+template<> struct JsonVariantAs< JsonArray& >              { typedef JsonArray&  type; };
+template<> struct JsonVariantAs< JsonObject >              { typedef JsonObject& type; };
+template<> struct JsonVariantAs< JsonObject& >             { typedef JsonObject& type; };
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< JsonVariant >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: One JSON value of any type.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+class JsonVariant
+{
+   public:
+
+   enum
+   {
+      UNDEFINED,
+      NUL,
+      RAW,
+      STRING,
+      INTEGER,
+      FLOAT,
+      BOOLEAN,
+      ARRAY,
+      OBJECT
+   };
+
+   JsonVariant () : Type ( UNDEFINED ) { Value.Integer = 0; }
+   JsonVariant ( const char* Text ) : Type ( Text ? STRING : NUL ) { Value.String = Text; }
+   JsonVariant ( const String& Text ) : JsonVariant ( Text.c_str() ) {}
+   JsonVariant ( RawJsonString Text ) : Type ( RAW ) { Value.String = Text.p; }
+   JsonVariant ( bool Flag ) : Type ( BOOLEAN ) { Value.Boolean = Flag; }
+   JsonVariant ( double Number, uint8_t Places = 2 ) : Type ( FLOAT ), Places ( Places ) { Value.Float = Number; }
+   JsonVariant ( float Number, uint8_t Places = 2 ) : JsonVariant ( (double) Number, Places ) {}
+   JsonVariant ( JsonArray& Array );
+   JsonVariant ( JsonObject& Object );
+
+   template< typename T, typename = typename std::enable_if< std::is_integral< T >::value && ! std::is_same< T, bool >::value >::type >
+   JsonVariant ( T Number ) : Type ( INTEGER ) { Value.Integer = (int64_t) Number; }
+
+   template< typename T > typename JsonVariantAs< T >::type as () const;
+   template< typename T > bool is () const;
+   template< typename T > operator T () const { return as< T >(); }
+
+   JsonVariant operator[] ( const char* Key ) const;
+   JsonVariant operator[] ( int Index ) const;
+   bool success () const { return Type != UNDEFINED; }
+
+   size_t printTo ( char* Buffer, size_t Size ) const;
+   size_t measureLength () const;
+
+   uint8_t  Type;
+   uint8_t  Places = 2;
+
+   union
+   {
+      const char* String;
+      int64_t     Integer;
+      double      Float;
+      bool        Boolean;
+      JsonArray*  Array;
+      JsonObject* Object;
+   } Value;
+
+   private:
+
+   int64_t AsInteger () const;
+   double AsFloat () const;
+   bool AsBool () const;
+   const char* AsString () const;
+   JsonArray& AsArray () const;
+   JsonObject& AsObject () const;
+};
+
+// ----------------------------------------------------------< /JsonVariant >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< JsonBuffer >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: Memory the objects, arrays, and copied strings are taken from.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+class JsonBuffer
+{
+   public:
+
+   virtual ~JsonBuffer () {}
+
+   JsonObject& createObject ();
+   JsonArray& createArray ();
+   JsonObject& parseObject ( char* Json );
+   JsonObject& parseObject ( const char* Json );
+   JsonObject& parseObject ( const String& Json ) { return parseObject ( Json.c_str() ); }
+   JsonArray& parseArray ( char* Json );
+
+   void* alloc ( size_t Bytes );
+   size_t size () const { return Used; }
+
+   protected:
+
+   JsonBuffer ( char* Pool, size_t Capacity ) : Pool ( Pool ), Capacity ( Capacity ) {}
+
+   private:
+
+   char*    Pool;
+   size_t   Capacity;
+   size_t   Used = 0;
+};
+
+template< size_t N > class StaticJsonBuffer : public JsonBuffer
+{
+   public:
+
+   StaticJsonBuffer () : JsonBuffer ( Pool, N ) {}
+
+   private:
+
+   alignas ( 8 ) char Pool[ N ];
+};
+
+// -----------------------------------------------------------< /JsonBuffer >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< JsonArray >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: A JSON array, a list of values.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+class JsonArray
+{
+   public:
+
+   struct Node
+   {
+      JsonVariant Value;
+      Node*       Next;
+   };
+
+   JsonArray ( JsonBuffer* Buffer ) : Buffer ( Buffer ) {}
+
+   static JsonArray& invalid ();
+
+   bool add ( const JsonVariant& Value );
+   bool add ( double Value, uint8_t Places ) { return add ( JsonVariant ( Value, Places ) ); }
+   template< typename T > bool add ( const T& Value ) { return add ( JsonVariant ( Value ) ); }
+   JsonArray& createNestedArray ();
+   JsonObject& createNestedObject ();
+
+   JsonVariant operator[] ( size_t Index ) const;
+   size_t size () const;
+   bool success () const { return Buffer != NULL; }
+
+   size_t printTo ( char* Buffer, size_t Size ) const;
+   size_t prettyPrintTo ( char* Buffer, size_t Size ) const;
+   size_t measureLength () const;
+   size_t measurePrettyLength () const;
+
+   JsonBuffer* Buffer;
+   Node*       Head = NULL;
+   Node*       Tail = NULL;
+};
+
+// ------------------------------------------------------------< /JsonArray >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< JsonObject >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: A JSON object, a list of named values.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+class JsonObject
+{
+   public:
+
+   struct Node
+   {
+      const char* Key;
+      JsonVariant Value;
+      Node*       Next;
+   };
+
+   JsonObject ( JsonBuffer* Buffer ) : Buffer ( Buffer ) {}
+
+   static JsonObject& invalid ();
+
+   JsonObjectSubscript operator[] ( const char* Key );
+   JsonVariant operator[] ( const char* Key ) const { return get ( Key ); }
+   JsonVariant get ( const char* Key ) const;
+   template< typename T > T get ( const char* Key ) const { return get ( Key ).as< T >(); }
+   bool set ( const char* Key, const JsonVariant& Value );
+   bool containsKey ( const char* Key ) const { return Find ( Key ) != NULL; }
+   JsonArray& createNestedArray ( const char* Key );
+   JsonObject& createNestedObject ( const char* Key );
+   size_t size () const;
+   bool success () const { return Buffer != NULL; }
+
+   size_t printTo ( char* Buffer, size_t Size ) const;
+   size_t printTo ( String& Text ) const;
+   size_t prettyPrintTo ( char* Buffer, size_t Size ) const;
+   size_t measureLength () const;
+   size_t measurePrettyLength () const;
+
+   JsonBuffer* Buffer;
+   Node*       Head = NULL;
+   Node*       Tail = NULL;
+
+   private:
+
+   Node* Find ( const char* Key ) const;
+};
+
+// -----------------------------------------------------------< /JsonObject >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------< JsonObjectSubscript >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: A named value of an object, read or set through the object.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+class JsonObjectSubscript
+{
+   public:
+
+   JsonObjectSubscript ( JsonObject& Object, const char* Key ) : Object ( Object ), Key ( Key ) {}
+
+   template< typename T > JsonObjectSubscript& operator= ( const T& Value )
+   {
+      Object.set ( Key, JsonVariant ( Value ) );
+      return *this;
+   }
+
+   JsonObjectSubscript& operator= ( const char* Value )
+   {
+      Object.set ( Key, JsonVariant ( Value ) );
+      return *this;
+   }
+
+   template< typename T > typename JsonVariantAs< T >::type as () const { return Object.get ( Key ).as< T >(); }
+   template< typename T > bool is () const { return Object.get ( Key ).is< T >(); }
+   template< typename T > operator T () const { return as< T >(); }
+   JsonVariant operator[] ( const char* Name ) const { return Object.get ( Key )[ Name ]; }
+   JsonVariant operator[] ( int Index ) const { return Object.get ( Key )[ Index ]; }
+   bool success () const { return Object.get ( Key ).success(); }
+
+   private:
+
+   JsonObject& Object;
+   const char* Key;
+};
+
+// --------------------------------------------------< /JsonObjectSubscript >---
+
+
+
+// Bytes of buffer an object or array of n values takes.
+#define JSON_OBJECT_SIZE(n)  ( sizeof ( JsonObject ) + (n) * sizeof ( JsonObject::Node ) )
+#define JSON_ARRAY_SIZE(n)   ( sizeof ( JsonArray ) + (n) * sizeof ( JsonArray::Node ) )
+
+
+
+template< typename T > typename JsonVariantAs< T >::type JsonVariant::as () const
+{
+   typedef typename std::remove_reference< T >::type Base;
+
+   if constexpr ( std::is_same< Base, bool >::value )
+   {
+      return AsBool();
+   }
+
+   else if constexpr ( std::is_integral< Base >::value )
+   {
+      return (Base) AsInteger();
+   }
+
+   else if constexpr ( std::is_floating_point< Base >::value )
+   {
+      return (Base) AsFloat();
+   }
+
+   else if constexpr ( std::is_same< Base, JsonArray >::value )
+   {
+      return AsArray();
+   }
+
+   else if constexpr ( std::is_same< Base, JsonObject >::value )
+   {
+      return AsObject();
+   }
+
+   else if constexpr ( std::is_same< Base, String >::value )
+   {
+      return String ( AsString() ? AsString() : "" );
+   }
+
+   else
+   {
+      return (Base) AsString();
+   }
+}
+
+
+
+template< typename T > bool JsonVariant::is () const
+{
+   typedef typename std::remove_reference< T >::type Base;
+
+   if constexpr ( std::is_same< Base, bool >::value )
+   {
+      return Type == BOOLEAN;
+   }
+
+   else if constexpr ( std::is_integral< Base >::value )
+   {
+      return Type == INTEGER;
+   }
+
+   else if constexpr ( std::is_floating_point< Base >::value )
+   {
+      return Type == INTEGER || Type == FLOAT;
+   }
+
+   else if constexpr ( std::is_same< Base, JsonArray >::value )
+   {
+      return Type == ARRAY;
+   }
+
+   else if constexpr ( std::is_same< Base, JsonObject >::value )
+   {
+      return Type == OBJECT;
+   }
+
+   else
+   {
+      return Type == STRING;
+   }
+}
+
+
+
+#endif   // ARDUINO_JSON_H
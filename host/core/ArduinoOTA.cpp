@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< ArduinoOTA.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Over the air updates for the host build.  No update ever arrives on
+//          its own; a test plays one through the sketch's handlers with the
+//          HostOTA functions.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ArduinoOTA.h>
+#include "HostCore.h"
+
+
+
+ArduinoOTAClass ArduinoOTA;
+
+
+
+void ArduinoOTAClass::onStart ( THandlerFunction Handler )             { Start = Handler; }
+void ArduinoOTAClass::onEnd ( THandlerFunction Handler )               { End = Handler; }
+void ArduinoOTAClass::onError ( THandlerFunction_Error Handler )       { Error = Handler; }
+void ArduinoOTAClass::onProgress ( THandlerFunction_Progress Handler ) { Progress = Handler; }
+void ArduinoOTAClass::setHostname ( const char* Name )                 {}
+void ArduinoOTAClass::begin ()                                         {}
+void ArduinoOTAClass::handle ()                                        {}
+int ArduinoOTAClass::getCommand ()                                     { return Command; }
+
+
+
+void HostOTAStart ()
+{
+   if ( ArduinoOTA.Start )
+   {
+      ArduinoOTA.Start();
+   }
+}
+
+void HostOTAProgress (
+   unsigned int   Progress,
+   unsigned int   Total
+)
+{
+   if ( ArduinoOTA.Progress )
+   {
+      ArduinoOTA.Progress ( Progress, Total );
+   }
+}
+
+void HostOTAEnd ()
+{
+   if ( ArduinoOTA.End )
+   {
+      ArduinoOTA.End();
+   }
+}
+
+void HostOTAError (
+   int   Error
+)
+{
+   if ( ArduinoOTA.Error )
+   {
+      ArduinoOTA.Error ( (ota_error_t) Error );
+   }
+}
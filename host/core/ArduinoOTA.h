@@ -0,0 +1,69 @@
+#ifndef ARDUINO_OTA_H
+#define ARDUINO_OTA_H
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< ArduinoOTA.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Stand-in for the over the air update library on the host.  Updates
+//          are started by the tests (see HostOTAStart).
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+
+
+
+#define U_FLASH   0
+#define U_FS      100
+
+typedef enum
+{
+   OTA_AUTH_ERROR,
+   OTA_BEGIN_ERROR,
+   OTA_CONNECT_ERROR,
+   OTA_RECEIVE_ERROR,
+   OTA_END_ERROR
+} ota_error_t;
+
+
+
+class ArduinoOTAClass
+{
+   public:
+
+   typedef std::function< void ( void ) > THandlerFunction;
+   typedef std::function< void ( ota_error_t ) > THandlerFunction_Error;
+   typedef std::function< void ( unsigned int, unsigned int ) > THandlerFunction_Progress;
+
+   void onStart ( THandlerFunction Handler );
+   void onEnd ( THandlerFunction Handler );
+   void onError ( THandlerFunction_Error Handler );
+   void onProgress ( THandlerFunction_Progress Handler );
+   void setHostname ( const char* Name );
+   void begin ();
+   void handle ();
+   int getCommand ();
+
+   THandlerFunction          Start;
+   THandlerFunction          End;
+   THandlerFunction_Error    Error;
+   THandlerFunction_Progress Progress;
+   int                       Command = U_FLASH;
+};
+
+extern ArduinoOTAClass ArduinoOTA;
+
+
+
+#endif   // ARDUINO_OTA_H
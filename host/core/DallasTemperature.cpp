@@ -0,0 +1,209 @@
+// -----------------------------------------------------------------------------
+// -------------------------------------------------< DallasTemperature.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The DallasTemperature library for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Each call goes over the OneWire bus the way the library does it,
+//             so it finds and reads whatever the host's bus has on it.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Copy the scratch pad to EEPROM after writing it.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <DallasTemperature.h>
+
+
+
+// DS18B20 function commands.
+#define STARTCONVO              0x44
+#define WRITESCRATCH            0x4E
+#define READSCRATCH             0xBE
+#define COPYSCRATCH             0x48
+
+// Scratch pad locations.
+#define TEMP_LSB                0
+#define TEMP_MSB                1
+#define HIGH_ALARM_TEMP         2
+#define LOW_ALARM_TEMP          3
+#define CONFIGURATION           4
+#define SCRATCHPAD_CRC          8
+
+
+
+DallasTemperature::DallasTemperature ( OneWire* Bus ) : Bus ( Bus )
+{
+}
+
+void DallasTemperature::begin ()
+{
+   DeviceAddress  Address;
+
+   Bus->reset_search();
+   Devices = 0;
+
+   while ( Bus->search ( Address ) )
+   {
+      Devices += validAddress ( Address );
+   }
+}
+
+uint8_t DallasTemperature::getDeviceCount ()
+{
+   return Devices;
+}
+
+bool DallasTemperature::getAddress ( uint8_t* Address, uint8_t Index )
+{
+   uint8_t  Depth = 0;
+   bool     Found = false;
+
+   Bus->reset_search();
+
+   while ( Found == false && Depth <= Index && Bus->search ( Address ) )
+   {
+      Found = ( Depth == Index && validAddress ( Address ) );
+      Depth++;
+   }
+
+   return Found;
+}
+
+bool DallasTemperature::validAddress ( const uint8_t* Address )
+{
+   return OneWire::crc8 ( Address, 7 ) == Address[ 7 ];
+}
+
+bool DallasTemperature::isConnected ( const uint8_t* Address )
+{
+   ScratchPad  Data;
+
+   return readScratchPad ( Address, Data ) && OneWire::crc8 ( Data, 8 ) == Data[ SCRATCHPAD_CRC ];
+}
+
+bool DallasTemperature::readScratchPad ( const uint8_t* Address, uint8_t* Data )
+{
+   bool  Read = ( Bus->reset() != 0 );
+
+   if ( Read == true )
+   {
+      Bus->select ( Address );
+      Bus->write ( READSCRATCH );
+      Bus->read_bytes ( Data, sizeof ( ScratchPad ) );
+      Read = ( Bus->reset() == 1 );
+   }
+
+   return Read;
+}
+
+void DallasTemperature::writeScratchPad ( const uint8_t* Address, const uint8_t* Data )
+{
+   Bus->reset();
+   Bus->select ( Address );
+   Bus->write ( WRITESCRATCH );
+   Bus->write ( Data[ HIGH_ALARM_TEMP ] );
+   Bus->write ( Data[ LOW_ALARM_TEMP ] );
+   Bus->write ( Data[ CONFIGURATION ] );
+
+   // Like the library, save the new settings in the probe's EEPROM so they
+   // come back after the probe is reset.
+   Bus->reset();
+   Bus->select ( Address );
+   Bus->write ( COPYSCRATCH );
+   delay ( 20 );
+   Bus->reset();
+}
+
+void DallasTemperature::setResolution ( uint8_t NewResolution )
+{
+   DeviceAddress  Address;
+
+   Resolution = constrain ( NewResolution, 9, 12 );
+
+   for ( uint8_t i = 0; i < Devices; i++ )
+   {
+      if ( getAddress ( Address, i ) )
+      {
+         setResolution ( Address, Resolution, true );
+      }
+   }
+}
+
+bool DallasTemperature::setResolution ( const uint8_t* Address, uint8_t NewResolution, bool SkipGlobal )
+{
+   ScratchPad  Data;
+   bool        Set = readScratchPad ( Address, Data );
+
+   NewResolution = constrain ( NewResolution, 9, 12 );
+
+   if ( Set == true )
+   {
+      uint8_t  Config = 0x1F | ( ( NewResolution - 9 ) << 5 );
+
+      if ( Data[ CONFIGURATION ] != Config )
+      {
+         Data[ CONFIGURATION ] = Config;
+         writeScratchPad ( Address, Data );
+      }
+
+      if ( SkipGlobal == false )
+      {
+         Resolution = max ( Resolution, NewResolution );
+      }
+   }
+
+   return Set;
+}
+
+uint8_t DallasTemperature::getResolution ()                  { return Resolution; }
+void DallasTemperature::setWaitForConversion ( bool NewWait ) { Wait = NewWait; }
+bool DallasTemperature::getWaitForConversion ()               { return Wait; }
+
+bool DallasTemperature::isConversionComplete ()
+{
+   return Bus->read_bit() == 1;
+}
+
+int16_t DallasTemperature::millisToWaitForConversion ( uint8_t Bits )
+{
+   return ( Bits == 9 ) ? 94 : ( Bits == 10 ) ? 188 : ( Bits == 11 ) ? 375 : 750;
+}
+
+DallasTemperature::request_t DallasTemperature::requestTemperatures ()
+{
+   request_t   Request = { true, millis() };
+
+   Bus->reset();
+   Bus->skip();
+   Bus->write ( STARTCONVO );
+
+   if ( Wait == true )
+   {
+      delay ( millisToWaitForConversion ( Resolution ) );
+   }
+
+   return Request;
+}
+
+int16_t DallasTemperature::getTemp ( const uint8_t* Address )
+{
+   ScratchPad  Data;
+
+   return readScratchPad ( Address, Data )
+          ? (int16_t) ( ( (int16_t) Data[ TEMP_MSB ] << 11 ) | ( (int16_t) Data[ TEMP_LSB ] << 3 ) )
+          : DEVICE_DISCONNECTED_RAW;
+}
+
+float DallasTemperature::getTempC ( const uint8_t* Address )
+{
+   return getTemp ( Address ) * 0.0078125f;
+}
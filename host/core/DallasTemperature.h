@@ -0,0 +1,84 @@
+#ifndef DALLAS_TEMPERATURE_H
+#define DALLAS_TEMPERATURE_H
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------< DallasTemperature.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The DallasTemperature library for the host build, driving the OneWire
+//          bus the same way the library does.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Only the calls the sketch makes are here.  Each sends the same
+//             commands over the bus as the library, so the bus time they take can
+//             be measured.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <OneWire.h>
+
+
+
+#define DEVICE_DISCONNECTED_C    -127
+#define DEVICE_DISCONNECTED_F    -196.6
+#define DEVICE_DISCONNECTED_RAW  -7040
+
+typedef uint8_t DeviceAddress[ 8 ];
+typedef uint8_t ScratchPad[ 9 ];
+
+
+
+class DallasTemperature
+{
+   public:
+
+   struct request_t
+   {
+      bool          result;
+      unsigned long timestamp;
+
+      operator bool () { return result; }
+   };
+
+   DallasTemperature ( OneWire* Bus );
+
+   void begin ();
+   uint8_t getDeviceCount ();
+   bool getAddress ( uint8_t* Address, uint8_t Index );
+   bool validAddress ( const uint8_t* Address );
+   bool isConnected ( const uint8_t* Address );
+   bool readScratchPad ( const uint8_t* Address, uint8_t* Data );
+   void writeScratchPad ( const uint8_t* Address, const uint8_t* Data );
+
+   void setResolution ( uint8_t Resolution );
+   bool setResolution ( const uint8_t* Address, uint8_t Resolution, bool SkipGlobal = false );
+   uint8_t getResolution ();
+   void setWaitForConversion ( bool Wait );
+   bool getWaitForConversion ();
+   bool isConversionComplete ();
+   int16_t millisToWaitForConversion ( uint8_t Resolution );
+
+   request_t requestTemperatures ();
+   int16_t getTemp ( const uint8_t* Address );
+   float getTempC ( const uint8_t* Address );
+
+   private:
+
+   OneWire* Bus;
+   uint8_t  Devices = 0;
+   uint8_t  Resolution = 9;
+   bool     Wait = true;
+};
+
+
+
+#endif   // DALLAS_TEMPERATURE_H
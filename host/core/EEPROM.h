@@ -0,0 +1,79 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< EEPROM.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The emulated EEPROM of the ESP8266 core for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Like the core, begin() copies the flash sector into RAM, and only
+//             commit() writes it back.  The flash starts out all zero, as after
+//             ClearROM(), unless changed with HostEEPROMFill().
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+
+
+
+// Bytes of flash set aside for the emulated EEPROM.
+#define HOST_EEPROM_SIZE        4096
+
+
+
+class EEPROMClass
+{
+   public:
+
+   void begin ( size_t Size );
+   uint8_t read ( int Address );
+   void write ( int Address, uint8_t Value );
+   bool commit ();
+   void end ();
+   uint8_t* getDataPtr ();
+   size_t length ();
+
+   template< typename T > T& get ( int Address, T& Value )
+   {
+      if ( Address >= 0 && Address + sizeof ( T ) <= Size )
+      {
+         memcpy ( (uint8_t*) &Value, &Data[ Address ], sizeof ( T ) );
+      }
+
+      return Value;
+   }
+
+   template< typename T > const T& put ( int Address, const T& Value )
+   {
+      if ( Address >= 0 && Address + sizeof ( T ) <= Size )
+      {
+         memcpy ( &Data[ Address ], (const uint8_t*) &Value, sizeof ( T ) );
+         Dirty = true;
+      }
+
+      return Value;
+   }
+
+   uint8_t  Data[ HOST_EEPROM_SIZE ];
+   uint8_t  Flash[ HOST_EEPROM_SIZE ];
+   size_t   Size = 0;
+   bool     Dirty = false;
+   uint32_t Commits = 0;
+};
+
+extern EEPROMClass EEPROM;
+
+
+
+#endif   // EEPROM_H
@@ -0,0 +1,73 @@
+#ifndef ESP8266_SSDP_H
+#define ESP8266_SSDP_H
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< ESP8266SSDP.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Stand-in for the SSDP service discovery library on the host.  The
+//          settings are kept and the schema is written, nothing is announced.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ESP8266WiFi.h>
+
+
+
+#define SSDP_UUID_SIZE          37
+#define SSDP_SCHEMA_URL_SIZE    64
+#define SSDP_DEVICE_TYPE_SIZE   64
+#define SSDP_FRIENDLY_NAME_SIZE 64
+#define SSDP_SERIAL_NUMBER_SIZE 32
+#define SSDP_PRESENTATION_URL_SIZE 128
+#define SSDP_MODEL_NAME_SIZE    64
+#define SSDP_MODEL_URL_SIZE     128
+#define SSDP_MODEL_VERSION_SIZE 32
+#define SSDP_MANUFACTURER_SIZE  64
+#define SSDP_MANUFACTURER_URL_SIZE 128
+
+
+
+class SSDPClass
+{
+   public:
+
+   bool begin ();
+   void end ();
+   void schema ( WiFiClient Client );
+
+   void setDeviceType ( const char* Value );
+   void setName ( const char* Value );
+   void setURL ( const char* Value );
+   void setSchemaURL ( const char* Value );
+   void setSerialNumber ( const char* Value );
+   void setModelName ( const char* Value );
+   void setModelNumber ( const char* Value );
+   void setModelURL ( const char* Value );
+   void setManufacturer ( const char* Value );
+   void setManufacturerURL ( const char* Value );
+   void setHTTPPort ( uint16_t Port );
+   void setUUID ( const char* Value );
+
+   char     DeviceType[ SSDP_DEVICE_TYPE_SIZE ];
+   char     Name[ SSDP_FRIENDLY_NAME_SIZE ];
+   char     UUID[ SSDP_UUID_SIZE ];
+   uint16_t Port;
+   bool     Running;
+};
+
+extern SSDPClass SSDP;
+
+
+
+#endif   // ESP8266_SSDP_H
@@ -0,0 +1,156 @@
+#ifndef ESP8266_WEB_SERVER_H
+#define ESP8266_WEB_SERVER_H
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------< ESP8266WebServer.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The web server of the ESP8266 core for the host build.  Requests come
+//          from the tests (see HostWebRequest) instead of the network.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  What a handler sends is kept in the response the test passed in,
+//             along with how long it took to send the first byte.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ESP8266WiFi.h>
+#include <FS.h>
+#include <vector>
+#include "HostCore.h"
+
+
+
+enum HTTPMethod
+{
+   HTTP_ANY,
+   HTTP_GET,
+   HTTP_HEAD,
+   HTTP_POST,
+   HTTP_PUT,
+   HTTP_PATCH,
+   HTTP_DELETE,
+   HTTP_OPTIONS
+};
+
+enum HTTPUploadStatus
+{
+   UPLOAD_FILE_START,
+   UPLOAD_FILE_WRITE,
+   UPLOAD_FILE_END,
+   UPLOAD_FILE_ABORTED
+};
+
+#define HTTP_UPLOAD_BUFLEN      2048
+#define CONTENT_LENGTH_UNKNOWN  ( (size_t) -1 )
+#define CONTENT_LENGTH_NOT_SET  ( (size_t) -2 )
+
+typedef struct
+{
+   HTTPUploadStatus status;
+   String           filename;
+   String           name;
+   String           type;
+   size_t           totalSize;
+   size_t           currentSize;
+   size_t           contentLength;
+   uint8_t          buf[ HTTP_UPLOAD_BUFLEN ];
+} HTTPUpload;
+
+
+
+class ESP8266WebServer
+{
+   public:
+
+   typedef std::function< void ( void ) > THandlerFunction;
+
+   ESP8266WebServer ( int Port = 80 );
+   ESP8266WebServer ( IPAddress Address, int Port = 80 );
+
+   void begin ();
+   void begin ( uint16_t Port );
+   void close ();
+   void stop ();
+   void handleClient ();
+
+   void on ( const String& Uri, THandlerFunction Handler );
+   void on ( const String& Uri, HTTPMethod Method, THandlerFunction Handler );
+   void on ( const String& Uri, HTTPMethod Method, THandlerFunction Handler, THandlerFunction Upload );
+   void onNotFound ( THandlerFunction Handler );
+
+   String uri ();
+   HTTPMethod method ();
+   WiFiClient client ();
+   HTTPUpload& upload ();
+
+   String arg ( const String& Name );
+   String arg ( int Index );
+   String argName ( int Index );
+   int args ();
+   bool hasArg ( const String& Name );
+
+   void setContentLength ( size_t Length );
+   void sendHeader ( const String& Name, const String& Value, bool First = false );
+   void send ( int Code, const char* ContentType = NULL, const String& Content = String ( "" ) );
+   void send ( int Code, char* ContentType, const String& Content );
+   void send ( int Code, const String& ContentType, const String& Content );
+   void sendContent ( const String& Content );
+   void sendContent ( const char* Content, size_t Length );
+
+   template< typename T > size_t streamFile ( T& File, const String& ContentType )
+   {
+      uint8_t  Block[ 256 ];
+      size_t   Sent = 0;
+      size_t   Length;
+
+      setContentLength ( File.size() );
+      send ( 200, ContentType, "" );
+
+      while ( ( Length = File.read ( Block, sizeof ( Block ) ) ) > 0 )
+      {
+         Capture ( (const char*) Block, Length );
+         Sent += Length;
+      }
+
+      return Sent;
+   }
+
+   private:
+
+   typedef struct
+   {
+      String           Uri;
+      HTTPMethod       Method;
+      THandlerFunction Handler;
+      THandlerFunction Upload;
+   } Route_t;
+
+   void Capture ( const char* Content, size_t Length );
+   friend bool HostWebRequest ( int, const char*, const HArgs_t&, HResponse_t* );
+
+   uint16_t               Port;
+   bool                   Running = false;
+   std::vector< Route_t > Routes;
+   THandlerFunction       NotFound;
+   HTTPUpload             Upload;
+   String                 Uri;
+   HTTPMethod             Method = HTTP_GET;
+   const HArgs_t*         Args = NULL;
+   HResponse_t*           Response = NULL;
+   size_t                 ContentLength = CONTENT_LENGTH_NOT_SET;
+   uint64_t               StartNanos = 0;
+};
+
+
+
+#endif   // ESP8266_WEB_SERVER_H
@@ -0,0 +1,92 @@
+#ifndef ESP8266_WIFI_H
+#define ESP8266_WIFI_H
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< ESP8266WiFi.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The wifi object of the ESP8266 core for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <WiFiClient.h>
+
+
+
+enum WiFiMode_t
+{
+   WIFI_OFF    = 0,
+   WIFI_STA    = 1,
+   WIFI_AP     = 2,
+   WIFI_AP_STA = 3
+};
+
+typedef enum
+{
+   WL_NO_SHIELD       = 255,
+   WL_IDLE_STATUS     = 0,
+   WL_NO_SSID_AVAIL   = 1,
+   WL_SCAN_COMPLETED  = 2,
+   WL_CONNECTED       = 3,
+   WL_CONNECT_FAILED  = 4,
+   WL_CONNECTION_LOST = 5,
+   WL_DISCONNECTED    = 6
+} wl_status_t;
+
+#define ENC_TYPE_TKIP   2
+#define ENC_TYPE_CCMP   4
+#define ENC_TYPE_WEP    5
+#define ENC_TYPE_NONE   7
+#define ENC_TYPE_AUTO   8
+
+#define WIFI_SCAN_RUNNING  ( -1 )
+#define WIFI_SCAN_FAILED   ( -2 )
+
+
+
+class ESP8266WiFiClass
+{
+   public:
+
+   bool mode ( WiFiMode_t Mode );
+   WiFiMode_t getMode ();
+   bool hostname ( const char* Name );
+   wl_status_t begin ( const char* SSID, const char* Password = NULL );
+   uint8_t waitForConnectResult ();
+   wl_status_t status ();
+   bool disconnect ( bool WifiOff = false );
+
+   IPAddress localIP ();
+   IPAddress subnetMask ();
+   IPAddress gatewayIP ();
+   String SSID () const;
+
+   bool softAPConfig ( IPAddress Local, IPAddress Gateway, IPAddress Subnet );
+   bool softAP ( const char* SSID, const char* Password = NULL );
+   IPAddress softAPIP ();
+
+   int8_t scanNetworks ( bool Async = false, bool Hidden = false );
+   void scanDelete ();
+   String SSID ( uint8_t Index );
+   int32_t channel ( uint8_t Index );
+   int32_t RSSI ( uint8_t Index );
+   uint8_t encryptionType ( uint8_t Index );
+};
+
+extern ESP8266WiFiClass WiFi;
+
+
+
+#endif   // ESP8266_WIFI_H
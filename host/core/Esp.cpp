@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< Esp.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The ESP object and the emulated EEPROM of the ESP8266 core, for the
+//          host build.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "HostCore.h"
+
+
+
+// The chip ID every host board reports.
+#define HOST_CHIP_ID            0x00C0FFEE
+
+// The CPU clock the cycle counter runs at.
+#define HOST_CPU_MHZ            80
+
+
+
+EspClass    ESP;
+EEPROMClass EEPROM;
+
+static rst_info   ResetInfo = { REASON_DEFAULT_RST };
+static uint32_t   Restarts = 0;
+
+
+
+uint32_t EspClass::getChipId ()
+{
+   return HOST_CHIP_ID;
+}
+
+uint32_t EspClass::getFreeHeap ()
+{
+   return ( HostHeapInUse() < HOST_HEAP_SIZE ) ? HOST_HEAP_SIZE - HostHeapInUse() : 0;
+}
+
+uint32_t EspClass::getCycleCount ()
+{
+   return (uint32_t) ( HostMicros() * HOST_CPU_MHZ );
+}
+
+uint8_t EspClass::getCpuFreqMHz ()
+{
+   return HOST_CPU_MHZ;
+}
+
+rst_info* EspClass::getResetInfoPtr ()
+{
+   return &ResetInfo;
+}
+
+void EspClass::restart ()
+{
+   Restarts++;
+   Serial.println ( "HOST: ESP.restart()" );
+}
+
+void HostSetResetReason (
+   uint32_t Reason
+)
+{
+   ResetInfo.reason = Reason;
+}
+
+uint32_t HostRestarts ()
+{
+   return Restarts;
+}
+
+
+
+//
+// The EEPROM, kept in RAM and only written back to the flash by commit().
+//
+
+void EEPROMClass::begin ( size_t Bytes )
+{
+   Size = min ( Bytes, sizeof ( Data ) );
+   memcpy ( Data, Flash, Size );
+   Dirty = false;
+}
+
+uint8_t EEPROMClass::read ( int Address )
+{
+   return ( Address >= 0 && (size_t) Address < Size ) ? Data[ Address ] : 0;
+}
+
+void EEPROMClass::write ( int Address, uint8_t Value )
+{
+   if ( Address >= 0 && (size_t) Address < Size )
+   {
+      Dirty = Dirty || Data[ Address ] != Value;
+      Data[ Address ] = Value;
+   }
+}
+
+bool EEPROMClass::commit ()
+{
+   if ( Dirty == true )
+   {
+      memcpy ( Flash, Data, Size );
+      Commits++;
+      Dirty = false;
+   }
+
+   return Size > 0;
+}
+
+void EEPROMClass::end ()
+{
+   commit();
+   Size = 0;
+}
+
+uint8_t* EEPROMClass::getDataPtr ()
+{
+   Dirty = true;
+
+   return Data;
+}
+
+size_t EEPROMClass::length ()
+{
+   return Size;
+}
+
+void HostEEPROMFill (
+   uint8_t  Value
+)
+{
+   memset ( EEPROM.Flash, Value, sizeof ( EEPROM.Flash ) );
+   memcpy ( EEPROM.Data, EEPROM.Flash, EEPROM.Size );
+}
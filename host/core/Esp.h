@@ -0,0 +1,73 @@
+#ifndef ESP_H
+#define ESP_H
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------< Esp.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The ESP object of the ESP8266 core for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The cycle counter runs at 80MHz of virtual time, and the free
+//             heap is HOST_HEAP_SIZE less what the sketch has allocated (see
+//             HostCore.h).
+//
+//          -  restart() does not return to the sketch on the board.  Here it
+//             only counts the restart (see HostRestarts).
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <stdint.h>
+
+
+
+enum rst_reason
+{
+   REASON_DEFAULT_RST      = 0,
+   REASON_WDT_RST          = 1,
+   REASON_EXCEPTION_RST    = 2,
+   REASON_SOFT_WDT_RST     = 3,
+   REASON_SOFT_RESTART     = 4,
+   REASON_DEEP_SLEEP_AWAKE = 5,
+   REASON_EXT_SYS_RST      = 6
+};
+
+struct rst_info
+{
+   uint32_t reason;
+   uint32_t exccause;
+   uint32_t epc1;
+   uint32_t epc2;
+   uint32_t epc3;
+   uint32_t excvaddr;
+   uint32_t depc;
+};
+
+
+
+class EspClass
+{
+   public:
+
+   uint32_t getChipId ();
+   uint32_t getFreeHeap ();
+   uint32_t getCycleCount ();
+   uint8_t getCpuFreqMHz ();
+   rst_info* getResetInfoPtr ();
+   void restart ();
+};
+
+extern EspClass ESP;
+
+
+
+#endif   // ESP_H
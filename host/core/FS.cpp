@@ -0,0 +1,211 @@
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------------< FS.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The SPIFFS file system for the host build, kept in a directory on
+//          the host.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The directory is the sketch's data directory unless a test picks
+//             another with HostSetFileRoot(), so the pages are the ones that
+//             are uploaded to the board.  A test that writes files should
+//             pick a directory of its own.
+//
+//          -  Every read call is counted (see HostFileReads), since on the
+//             board each one costs far more than the bytes it returns.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <FS.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "HostCore.h"
+
+
+
+#ifndef HOST_FILE_ROOT
+#define HOST_FILE_ROOT          "data"
+#endif
+
+
+
+fs::FS SPIFFS;
+
+static std::string   Root = HOST_FILE_ROOT;
+static size_t        ReadLimit = 0;
+static uint32_t      Reads = 0;
+
+
+
+static std::string HostPath (
+   const char* Path
+)
+{
+   return Root + ( ( Path[ 0 ] == '/' ) ? "" : "/" ) + Path;
+}
+
+
+
+namespace fs
+{
+
+File::File ( FILE* Handle, const char* Path )
+   : Handle ( Handle, [] ( FILE* Each ) { if ( Each != NULL ) fclose ( Each ); } ), Path ( Path )
+{
+}
+
+size_t File::write ( uint8_t Value )
+{
+   return write ( &Value, 1 );
+}
+
+size_t File::write ( const uint8_t* Buffer, size_t Size )
+{
+   return ( Handle ) ? fwrite ( Buffer, 1, Size, Handle.get() ) : 0;
+}
+
+int File::available ()
+{
+   return ( Handle ) ? (int) ( size() - position() ) : 0;
+}
+
+int File::read ()
+{
+   Reads++;
+
+   return ( Handle ) ? fgetc ( Handle.get() ) : -1;
+}
+
+int File::peek ()
+{
+   int   Value = -1;
+
+   if ( Handle )
+   {
+      Value = fgetc ( Handle.get() );
+
+      if ( Value >= 0 )
+      {
+         ungetc ( Value, Handle.get() );
+      }
+   }
+
+   return Value;
+}
+
+size_t File::read ( uint8_t* Buffer, size_t Size )
+{
+   Reads++;
+
+   if ( ReadLimit > 0 && Size > ReadLimit )
+   {
+      Size = ReadLimit;
+   }
+
+   return ( Handle ) ? fread ( Buffer, 1, Size, Handle.get() ) : 0;
+}
+
+bool File::seek ( uint32_t Position )
+{
+   return ( Handle ) && fseek ( Handle.get(), Position, SEEK_SET ) == 0;
+}
+
+size_t File::position () const
+{
+   return ( Handle ) ? ftell ( Handle.get() ) : 0;
+}
+
+size_t File::size () const
+{
+   struct stat Info;
+
+   fflush ( Handle.get() );
+
+   return ( Handle && fstat ( fileno ( Handle.get() ), &Info ) == 0 ) ? Info.st_size : 0;
+}
+
+void File::close ()
+{
+   Handle.reset();
+}
+
+const char* File::name () const
+{
+   return Path.c_str();
+}
+
+File::operator bool () const
+{
+   return (bool) Handle;
+}
+
+
+
+bool FS::begin ()
+{
+   Mounted = true;
+
+   return true;
+}
+
+void FS::end ()
+{
+   Mounted = false;
+}
+
+File FS::open ( const char* Path, const char* Mode )
+{
+   HostHeapPause  Pause;
+   std::string    Name = HostPath ( Path );
+   const char*    HostMode = ( Mode[ 0 ] == 'w' ) ? "wb" : ( Mode[ 0 ] == 'a' ) ? "ab" : "rb";
+
+   return File ( Mounted ? fopen ( Name.c_str(), HostMode ) : NULL, Path );
+}
+
+bool FS::exists ( const char* Path )
+{
+   HostHeapPause  Pause;
+
+   return Mounted && access ( HostPath ( Path ).c_str(), F_OK ) == 0;
+}
+
+bool FS::remove ( const char* Path )
+{
+   HostHeapPause  Pause;
+
+   return Mounted && unlink ( HostPath ( Path ).c_str() ) == 0;
+}
+
+}   // namespace fs
+
+
+
+void HostSetFileRoot (
+   const char* Path
+)
+{
+   HostHeapPause  Pause;
+
+   Root = Path;
+}
+
+void HostSetReadLimit (
+   size_t   Bytes
+)
+{
+   ReadLimit = Bytes;
+}
+
+uint32_t HostFileReads ()
+{
+   return Reads;
+}
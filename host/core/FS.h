@@ -0,0 +1,91 @@
+#ifndef FS_H
+#define FS_H
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------------< FS.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The SPIFFS file system for the host build, kept in a directory on the
+//          host (see HostSetFileRoot).
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  A read of more than a few bytes is cut short at HostSetReadLimit()
+//             bytes, as SPIFFS does at page boundaries, so code that reads in
+//             blocks has to handle short reads.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <memory>
+
+
+
+namespace fs
+{
+
+class File : public Stream
+{
+   public:
+
+   File ( FILE* Handle = NULL, const char* Path = "" );
+
+   size_t write ( uint8_t Value ) override;
+   size_t write ( const uint8_t* Buffer, size_t Size ) override;
+   using Print::write;
+
+   int available () override;
+   int read () override;
+   int peek () override;
+   size_t read ( uint8_t* Buffer, size_t Size );
+   bool seek ( uint32_t Position );
+   size_t position () const;
+   size_t size () const;
+   void close ();
+   const char* name () const;
+   operator bool () const;
+
+   private:
+
+   std::shared_ptr< FILE > Handle;
+   std::string             Path;
+};
+
+
+
+class FS
+{
+   public:
+
+   bool begin ();
+   void end ();
+   File open ( const char* Path, const char* Mode );
+   File open ( const String& Path, const char* Mode ) { return open ( Path.c_str(), Mode ); }
+   bool exists ( const char* Path );
+   bool exists ( const String& Path ) { return exists ( Path.c_str() ); }
+   bool remove ( const char* Path );
+   bool remove ( const String& Path ) { return remove ( Path.c_str() ); }
+
+   bool Mounted = false;
+};
+
+}   // namespace fs
+
+
+
+using fs::File;
+using fs::FS;
+
+extern fs::FS SPIFFS;
+
+
+
+#endif   // FS_H
@@ -0,0 +1,52 @@
+#ifndef HARDWARE_SERIAL_H
+#define HARDWARE_SERIAL_H
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< HardwareSerial.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The serial port for the host build, written to stdout (see
+//          HostSerialEcho).
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "Stream.h"
+
+
+
+class HardwareSerial : public Stream
+{
+   public:
+
+   void begin ( unsigned long Baud );
+   void end ();
+   void updateBaudRate ( unsigned long Baud );
+   unsigned long baudRate ();
+   int availableForWrite ();
+
+   size_t write ( uint8_t Value ) override;
+   size_t write ( const uint8_t* Buffer, size_t Size ) override;
+   using Print::write;
+
+   operator bool () const { return true; }
+
+   private:
+
+   unsigned long Baud = 0;
+};
+
+extern HardwareSerial Serial;
+
+
+
+#endif   // HARDWARE_SERIAL_H
@@ -0,0 +1,392 @@
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< HostClock.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The virtual clock of the host build, and the core routines that
+//          depend on it: millis(), micros(), delay(), the SDK software timers,
+//          and scheduled functions.  Also the pins and the random numbers.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The clock only moves forward in HostAdvance().  Timers that come
+//             due on the way are run in the order they are due, at the time
+//             they are due, so a timer callback that reads the clock sees the
+//             time it was meant to run.
+//
+//          -  As in the ESP8266 core, functions given to schedule_function()
+//             run after loop() returns, not inside delay().
+//
+//          -  random() is the same every run unless randomSeed() is given a
+//             different seed, and analogRead() always reads the same value.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <Schedule.h>
+#include <chrono>
+#include <vector>
+#include "HostCore.h"
+
+
+
+// The value analogRead() returns, a floating pin reads a little above zero.
+#define HOST_ANALOG_VALUE       17
+
+// The number of GPIO pins.
+#define HOST_PIN_COUNT          17
+
+
+
+static uint64_t     Now = 0;
+static os_timer_t*  Timers = NULL;
+static uint32_t     RandomState = 1;
+static uint8_t      PinState[ HOST_PIN_COUNT ];
+static uint32_t     PinChanges[ HOST_PIN_COUNT ];
+
+static std::vector< std::function< void ( void ) > > Scheduled;
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< HostMicros >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Get the virtual time.
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint64_t - Microseconds since the start of the run, never wraps.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint64_t HostMicros ()
+{
+   return Now;
+}
+
+// -----------------------------------------------------------< /HostMicros >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< HostAdvance >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Move the virtual clock forward, running each timer that comes
+//             due on the way.
+//
+// PARAMETERS: Micros - How far to move the clock.
+//
+// RETURNS:    void
+//
+// NOTES:      -  A timer callback may arm or disarm timers, itself included,
+//                so the list is searched again after each one runs.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void HostAdvance (
+   uint64_t Micros
+)
+{
+   uint64_t    End = Now + Micros;
+   os_timer_t* Due;
+
+   do
+   {
+      Due = NULL;
+
+      for ( os_timer_t* Timer = Timers; Timer != NULL; Timer = Timer->timer_next )
+      {
+         if ( Timer->timer_armed == true
+              && Timer->timer_expire <= End
+              && ( Due == NULL || Timer->timer_expire < Due->timer_expire )
+            )
+         {
+            Due = Timer;
+         }
+      }
+
+      if ( Due != NULL )
+      {
+         Now = max ( Now, Due->timer_expire );
+
+         if ( Due->timer_period > 0 )
+         {
+            Due->timer_expire += Due->timer_period * 1000ULL;
+         }
+
+         else
+         {
+            Due->timer_armed = false;
+         }
+
+         if ( Due->timer_func != NULL )
+         {
+            Due->timer_func ( Due->timer_arg );
+         }
+      }
+   } while ( Due != NULL );
+
+   Now = End;
+}
+
+// ----------------------------------------------------------< /HostAdvance >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< HostRunScheduled >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Run the functions given to schedule_function(), as the core
+//             does each time loop() returns.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:      -  A function scheduled by one of them waits for the next pass.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void HostRunScheduled ()
+{
+   std::vector< std::function< void ( void ) > > Ready;
+
+   Ready.swap ( Scheduled );
+
+   for ( auto& Function : Ready )
+   {
+      Function();
+   }
+}
+
+// -----------------------------------------------------< /HostRunScheduled >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< HostNanos >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Read the host's own clock, for benchmarks.
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint64_t - Nanoseconds from a fixed point in the past.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint64_t HostNanos ()
+{
+   return std::chrono::duration_cast< std::chrono::nanoseconds > (
+             std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+// ------------------------------------------------------------< /HostNanos >---
+
+
+
+//
+// Time.
+//
+
+unsigned long millis ()
+{
+   return (uint32_t) ( Now / 1000 );
+}
+
+unsigned long micros ()
+{
+   return (uint32_t) Now;
+}
+
+void delay (
+   unsigned long Milliseconds
+)
+{
+   HostAdvance ( Milliseconds * 1000ULL );
+}
+
+void delayMicroseconds (
+   unsigned int  Microseconds
+)
+{
+   HostAdvance ( Microseconds );
+}
+
+void yield ()
+{
+   HostAdvance ( 0 );
+}
+
+bool schedule_function (
+   const std::function< void ( void ) >& Function
+)
+{
+   HostHeapPause  Pause;
+
+   Scheduled.push_back ( Function );
+
+   return true;
+}
+
+
+
+//
+// SDK software timers.  A timer is added to the list the first time it is
+// given a function and stays there, disarmed or not.
+//
+
+void os_timer_setfn (
+   os_timer_t*       Timer,
+   os_timer_func_t*  Function,
+   void*             Arg
+)
+{
+   bool  Listed = false;
+
+   for ( os_timer_t* Each = Timers; Each != NULL; Each = Each->timer_next )
+   {
+      Listed = Listed || ( Each == Timer );
+   }
+
+   if ( Listed == false )
+   {
+      Timer->timer_next = Timers;
+      Timers = Timer;
+   }
+
+   Timer->timer_func  = Function;
+   Timer->timer_arg   = Arg;
+   Timer->timer_armed = false;
+}
+
+void os_timer_arm (
+   os_timer_t*       Timer,
+   uint32_t          Milliseconds,
+   bool              Repeat
+)
+{
+   Timer->timer_expire = Now + Milliseconds * 1000ULL;
+   Timer->timer_period = ( Repeat == true ) ? max ( Milliseconds, 1u ) : 0;
+   Timer->timer_armed  = true;
+}
+
+void os_timer_disarm (
+   os_timer_t*       Timer
+)
+{
+   Timer->timer_armed = false;
+}
+
+
+
+//
+// Pins.
+//
+
+void pinMode (
+   uint8_t  Pin,
+   uint8_t  Mode
+)
+{
+}
+
+void digitalWrite (
+   uint8_t  Pin,
+   uint8_t  Value
+)
+{
+   if ( Pin < HOST_PIN_COUNT )
+   {
+      if ( PinState[ Pin ] != ( Value != LOW ) )
+      {
+         PinChanges[ Pin ]++;
+      }
+
+      PinState[ Pin ] = ( Value != LOW );
+   }
+}
+
+int digitalRead (
+   uint8_t  Pin
+)
+{
+   return ( Pin < HOST_PIN_COUNT ) ? PinState[ Pin ] : LOW;
+}
+
+int analogRead (
+   uint8_t  Pin
+)
+{
+   return HOST_ANALOG_VALUE;
+}
+
+uint8_t HostPinState (
+   uint8_t  Pin
+)
+{
+   return ( Pin < HOST_PIN_COUNT ) ? PinState[ Pin ] : LOW;
+}
+
+uint32_t HostPinChanges (
+   uint8_t  Pin
+)
+{
+   return ( Pin < HOST_PIN_COUNT ) ? PinChanges[ Pin ] : 0;
+}
+
+
+
+//
+// Random numbers, from a small generator that is the same on every host.
+//
+
+long random (
+   long  Max
+)
+{
+   RandomState = RandomState * 1103515245 + 12345;
+
+   return ( Max > 0 ) ? (long) ( ( RandomState >> 1 ) % (uint32_t) Max ) : 0;
+}
+
+long random (
+   long  Min,
+   long  Max
+)
+{
+   return ( Max > Min ) ? Min + random ( Max - Min ) : Min;
+}
+
+void randomSeed (
+   unsigned long Seed
+)
+{
+   RandomState = (uint32_t) Seed;
+}
@@ -0,0 +1,244 @@
+#ifndef HOST_CORE
+#define HOST_CORE
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< HostCore.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Control of the host build's stand-in Arduino/ESP8266 core, for the
+//          tests and benchmarks that run the sketch on a development machine.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Time on the host is virtual.  It only moves when the sketch
+//             calls delay() or yield(), or when a test moves it with
+//             HostAdvance() or HostRun(), so millions of passes of loop() take
+//             no longer than the code itself takes to run, and every run is
+//             the same.  Timers armed with os_timer_arm() fire in order as the
+//             clock passes them.
+//
+//          -  Code running between those points takes no virtual time at all,
+//             so ESP.getCycleCount() only measures delays.  Benchmarks measure
+//             the host's own clock with HostNanos() instead.
+//
+//          -  Every allocation with new is counted, so ESP.getFreeHeap() drops
+//             and recovers as the sketch uses the heap.  What the stand-in
+//             libraries keep for the tests (captured responses and messages)
+//             is not counted.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+#include <utility>
+
+
+
+// Free heap reported at start up, about what a NodeMCU has left for a sketch.
+#define HOST_HEAP_SIZE          45000
+
+// Microseconds of virtual time each pass of loop() is taken to use by default.
+#define HOST_LOOP_MICROS        1000
+
+
+
+//
+// The virtual clock.
+//
+uint64_t HostMicros ();
+
+void HostAdvance (
+   uint64_t Micros
+);
+
+void HostRunScheduled ();
+
+void HostRun (
+   uint64_t Micros,
+   uint32_t LoopMicros = HOST_LOOP_MICROS
+);
+
+uint64_t HostNanos ();
+
+//
+// Heap use, in bytes, by the sketch.
+//
+uint32_t HostHeapInUse ();
+
+uint32_t HostHeapPeak ();
+
+void HostHeapResetPeak ();
+
+//
+// While one of these is in scope, allocations are made for the tests and not
+// counted as the sketch's heap use.
+//
+class HostHeapPause
+{
+   public:
+
+   HostHeapPause ();
+   ~HostHeapPause ();
+};
+
+//
+// Serial output is shown on stdout unless turned off, and kept for the tests
+// to look at until cleared.
+//
+void HostSerialEcho (
+   bool  Echo
+);
+
+std::string& HostSerialText ();
+
+//
+// The board itself.
+//
+void HostSetResetReason (
+   uint32_t Reason
+);
+
+uint32_t HostRestarts ();
+
+uint8_t HostPinState (
+   uint8_t  Pin
+);
+
+uint32_t HostPinChanges (
+   uint8_t  Pin
+);
+
+void HostEEPROMFill (
+   uint8_t  Value
+);
+
+//
+// The SPIFFS file system is a directory on the host, by default the sketch's
+// data directory.  Reads can be limited to fewer bytes than asked for, as
+// SPIFFS does across page boundaries, to test code that reads in blocks.
+//
+void HostSetFileRoot (
+   const char* Path
+);
+
+void HostSetReadLimit (
+   size_t   Bytes
+);
+
+uint32_t HostFileReads ();
+
+//
+// Wifi, seen by the sketch as always able to connect unless told otherwise.
+//
+typedef struct HOST_NETWORK
+{
+   const char* SSID;
+   int32_t     Channel;
+   int32_t     RSSI;
+   uint8_t     Encryption;
+} HNetwork_t;
+
+void HostSetWifiStatus (
+   uint8_t  Status
+);
+
+void HostSetNetworks (
+   const HNetwork_t* Networks,
+   uint8_t           Count
+);
+
+//
+// A request sent to the web server that last had begin() called, and what
+// the handler sent back.
+//
+typedef std::vector< std::pair< std::string, std::string > > HArgs_t;
+
+typedef struct HOST_RESPONSE
+{
+   int         Status;
+   std::string ContentType;
+   HArgs_t     Headers;
+   std::string Body;
+   uint32_t    Chunks;
+   size_t      LargestChunk;
+   uint64_t    FirstByteNanos;
+   uint64_t    TotalNanos;
+} HResponse_t;
+
+bool HostWebRequest (
+   int            Method,
+   const char*    Uri,
+   const HArgs_t& Args,
+   HResponse_t*   Response
+);
+
+//
+// Web socket clients of the web socket server that last had begin() called.
+// A client is connected over the next few passes of loop(), as the library
+// reads the handshake one line at a time.
+//
+typedef struct HOST_FRAME
+{
+   bool        Binary;
+   std::string Data;
+} HFrame_t;
+
+int HostSocketConnect (
+   const char* Url,
+   const char* Protocols
+);
+
+void HostSocketText (
+   uint8_t     Num,
+   const char* Text
+);
+
+void HostSocketDisconnect (
+   uint8_t  Num
+);
+
+void HostSocketSetWritable (
+   uint8_t  Num,
+   int      Bytes
+);
+
+std::string HostSocketProtocol (
+   uint8_t  Num
+);
+
+std::vector< HFrame_t >& HostSocketFrames (
+   uint8_t  Num
+);
+
+uint32_t HostSocketBlocked (
+   uint8_t  Num
+);
+
+//
+// Over the air updates, to bring up the screens shown while one runs.
+//
+void HostOTAStart ();
+
+void HostOTAProgress (
+   unsigned int   Progress,
+   unsigned int   Total
+);
+
+void HostOTAEnd ();
+
+void HostOTAError (
+   int   Error
+);
+
+
+
+#endif   // HOST_CORE
@@ -0,0 +1,128 @@
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< HostHeap.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Count the heap the sketch uses on the host, so ESP.getFreeHeap()
+//          behaves as it does on the board and peak use can be measured.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Every new and delete in the program comes through here.  Each
+//             block carries a small header with its size, and whether it was
+//             counted, so it is taken off the count correctly when freed.
+//
+//          -  Blocks are counted at the size asked for.  The board's
+//             allocator adds a few bytes of its own to each, so the free heap
+//             on the board drops a little faster than it does here.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <stdlib.h>
+#include <new>
+#include "HostCore.h"
+
+
+
+typedef struct HOST_BLOCK
+{
+   size_t   Size;
+   size_t   Counted;
+} HBlock_t;
+
+static uint32_t   InUse = 0;
+static uint32_t   Peak = 0;
+static uint32_t   Paused = 0;
+
+
+
+static void* Allocate (
+   size_t   Size
+)
+{
+   HBlock_t* Block = (HBlock_t*) malloc ( sizeof ( HBlock_t ) + Size );
+
+   if ( Block == NULL )
+   {
+      throw std::bad_alloc();
+   }
+
+   Block->Size    = Size;
+   Block->Counted = ( Paused == 0 );
+
+   if ( Block->Counted )
+   {
+      InUse += Size;
+      Peak   = max ( Peak, InUse );
+   }
+
+   return Block + 1;
+}
+
+static void Free (
+   void*    Memory
+)
+{
+   if ( Memory != NULL )
+   {
+      HBlock_t* Block = (HBlock_t*) Memory - 1;
+
+      if ( Block->Counted )
+      {
+         InUse -= Block->Size;
+      }
+
+      free ( Block );
+   }
+}
+
+
+
+void* operator new ( size_t Size )                                { return Allocate ( Size ); }
+void* operator new[] ( size_t Size )                              { return Allocate ( Size ); }
+void* operator new ( size_t Size, const std::nothrow_t& ) noexcept
+{
+   try { return Allocate ( Size ); } catch ( ... ) { return NULL; }
+}
+void* operator new[] ( size_t Size, const std::nothrow_t& ) noexcept
+{
+   try { return Allocate ( Size ); } catch ( ... ) { return NULL; }
+}
+void operator delete ( void* Memory ) noexcept                    { Free ( Memory ); }
+void operator delete[] ( void* Memory ) noexcept                  { Free ( Memory ); }
+void operator delete ( void* Memory, size_t ) noexcept            { Free ( Memory ); }
+void operator delete[] ( void* Memory, size_t ) noexcept          { Free ( Memory ); }
+
+
+
+uint32_t HostHeapInUse ()
+{
+   return InUse;
+}
+
+uint32_t HostHeapPeak ()
+{
+   return Peak;
+}
+
+void HostHeapResetPeak ()
+{
+   Peak = InUse;
+}
+
+HostHeapPause::HostHeapPause ()
+{
+   Paused++;
+}
+
+HostHeapPause::~HostHeapPause ()
+{
+   Paused--;
+}
@@ -0,0 +1,69 @@
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< HostRun.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Run the sketch's loop() over a span of virtual time.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Kept apart from the rest of the clock so that tests that do not
+//             build the sketch do not need a loop() to link.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "HostCore.h"
+
+
+
+void loop ();
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< HostRun >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Run passes of loop(), as the core does, until an amount of
+//             virtual time has gone by.
+//
+// PARAMETERS: Micros - How much virtual time to run for.
+//
+//             LoopMicros - How much virtual time each pass takes, beyond any
+//                          delay() in it.
+//
+// RETURNS:    void
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void HostRun (
+   uint64_t Micros,
+   uint32_t LoopMicros
+)
+{
+   uint64_t End = HostMicros() + Micros;
+
+   while ( HostMicros() < End )
+   {
+      loop();
+      HostRunScheduled();
+
+      if ( HostMicros() < End )
+      {
+         HostAdvance ( min ( (uint64_t) max ( LoopMicros, 1u ), End - HostMicros() ) );
+      }
+   }
+}
+
+// --------------------------------------------------------------< /HostRun >---
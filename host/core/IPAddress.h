@@ -0,0 +1,51 @@
+#ifndef IP_ADDRESS_H
+#define IP_ADDRESS_H
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< IPAddress.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: An IPv4 address, for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+
+
+
+class IPAddress : public Printable
+{
+   public:
+
+   IPAddress ();
+   IPAddress ( uint8_t A, uint8_t B, uint8_t C, uint8_t D );
+   IPAddress ( uint32_t Address );
+   IPAddress ( const uint8_t* Address );
+
+   operator uint32_t () const;
+   uint8_t operator[] ( int Index ) const { return Bytes[ Index ]; }
+   uint8_t& operator[] ( int Index )      { return Bytes[ Index ]; }
+   bool operator== ( const IPAddress& Other ) const;
+   bool operator!= ( const IPAddress& Other ) const { return ! ( *this == Other ); }
+
+   size_t printTo ( Print& Out ) const override;
+   String toString () const;
+
+   private:
+
+   uint8_t  Bytes[ 4 ];
+};
+
+
+
+#endif   // IP_ADDRESS_H
@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< OneWire.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The OneWire bus for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Every operation goes to the emulated bus (see ProbeEmulator.cpp).
+//             Until a test puts devices on it with EmuBegin() the bus is empty:
+//             a reset finds no presence pulse, and every bit read is a 1, as
+//             the pull up leaves the line.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Emulated DS18B20 probes on the bus.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <OneWire.h>
+#include "ProbeEmulator.h"
+
+
+
+OneWire::OneWire ( uint8_t Pin ) : Pin ( Pin )
+{
+}
+
+uint8_t OneWire::reset ()
+{
+   return EmuReset();
+}
+
+void OneWire::select ( const uint8_t* Address )
+{
+   EmuSelect ( Address );
+}
+
+void OneWire::skip ()
+{
+   EmuSkip();
+}
+
+void OneWire::write ( uint8_t Value, uint8_t Power )
+{
+   EmuWrite ( Value );
+}
+
+void OneWire::write_bytes ( const uint8_t* Buffer, uint16_t Count, bool Power )
+{
+   for ( uint16_t i = 0; i < Count; i++ )
+   {
+      write ( Buffer[ i ], Power );
+   }
+}
+
+uint8_t OneWire::read ()
+{
+   return EmuRead();
+}
+
+void OneWire::read_bytes ( uint8_t* Buffer, uint16_t Count )
+{
+   for ( uint16_t i = 0; i < Count; i++ )
+   {
+      Buffer[ i ] = read();
+   }
+}
+
+void OneWire::write_bit ( uint8_t Bit )
+{
+   EmuWriteBit ( Bit );
+}
+
+uint8_t OneWire::read_bit ()
+{
+   return EmuReadBit();
+}
+
+void OneWire::depower ()
+{
+}
+
+void OneWire::reset_search ()
+{
+   EmuResetSearch();
+}
+
+bool OneWire::search ( uint8_t* Address, bool Normal )
+{
+   return EmuSearch ( Address );
+}
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------------< crc8 >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Dallas CRC of a ROM code or scratch pad, as the library computes
+//             it (polynomial x^8 + x^5 + x^4 + 1, low bit first).
+//
+// PARAMETERS: Address - The bytes to check.
+//
+//             Length - How many bytes.
+//
+// RETURNS:    uint8_t - The CRC.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint8_t OneWire::crc8 (
+   const uint8_t* Address,
+   uint8_t        Length
+)
+{
+   uint8_t  Crc = 0;
+
+   for ( uint8_t i = 0; i < Length; i++ )
+   {
+      uint8_t  Byte = Address[ i ];
+
+      for ( uint8_t Bit = 0; Bit < 8; Bit++, Byte >>= 1 )
+      {
+         Crc = ( ( Crc ^ Byte ) & 0x01 ) ? ( Crc >> 1 ) ^ 0x8C : Crc >> 1;
+      }
+   }
+
+   return Crc;
+}
+
+// -----------------------------------------------------------------< /crc8 >---
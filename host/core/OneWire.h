@@ -0,0 +1,57 @@
+#ifndef ONE_WIRE_H
+#define ONE_WIRE_H
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< OneWire.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Stand-in for the OneWire library on the host.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The bus is the emulated one in ProbeEmulator.h, empty until a
+//             test puts devices on it.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+
+
+
+class OneWire
+{
+   public:
+
+   OneWire ( uint8_t Pin );
+
+   uint8_t reset ();
+   void select ( const uint8_t* Address );
+   void skip ();
+   void write ( uint8_t Value, uint8_t Power = 0 );
+   void write_bytes ( const uint8_t* Buffer, uint16_t Count, bool Power = 0 );
+   uint8_t read ();
+   void read_bytes ( uint8_t* Buffer, uint16_t Count );
+   void write_bit ( uint8_t Bit );
+   uint8_t read_bit ();
+   void depower ();
+   void reset_search ();
+   bool search ( uint8_t* Address, bool Normal = true );
+
+   static uint8_t crc8 ( const uint8_t* Address, uint8_t Length );
+
+   private:
+
+   uint8_t  Pin;
+};
+
+
+
+#endif   // ONE_WIRE_H
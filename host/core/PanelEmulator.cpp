@@ -0,0 +1,665 @@
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< PanelEmulator.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that emulate an SSD1306 OLED panel on the I2C bus, behind
+//          the host build's Wire stand-in.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Commands and display RAM writes follow the SSD1306 data sheet:
+//             the control byte, the three memory addressing modes, and the
+//             column and page windows that the address wraps around in.  A
+//             command's arguments may come in a later transmission, as they
+//             do when Adafruit_SSD1306::display() sends the last column.
+//
+//          -  Scrolling, contrast, and the timing and charge pump settings are
+//             accepted and ignored, since they do not change what is in the
+//             display RAM.
+//
+//          -  The display RAM starts out clear.  On a real panel it starts out
+//             as noise, which is why the sketch clears the screen at start up.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "PanelEmulator.h"
+
+
+
+//
+// Bits of the control byte that starts a transmission, and follows each byte
+// after it while the continuation bit is set.
+//
+#define PANEL_CONTROL_CONTINUE  0x80  // Only the next byte goes with this one
+#define PANEL_CONTROL_DATA      0x40  // Display RAM data rather than commands
+
+//
+// Memory addressing modes set by command 0x20.
+//
+#define PANEL_MODE_HORIZONTAL   0
+#define PANEL_MODE_VERTICAL     1
+#define PANEL_MODE_PAGE         2
+
+// Most argument bytes any command takes.
+#define PANEL_ARGUMENT_MAX      6
+
+
+
+static uint8_t    PanelMemory[ PANEL_RAM_SIZE ];
+
+// Display state, as it is after a reset.
+static bool       PanelDisplayOn  = false;
+static bool       PanelInverted   = false;
+static bool       PanelEntireOn   = false;
+static bool       PanelSegRemap   = false;  // Column 127 at the left
+static bool       PanelComReverse = false;  // Scanned from the last row up
+static uint8_t    PanelStartLine  = 0;
+
+// Where the next data byte goes.
+static uint8_t    PanelMode        = PANEL_MODE_PAGE;
+static uint8_t    PanelColumn      = 0;
+static uint8_t    PanelPage        = 0;
+static uint8_t    PanelColumnStart = 0;
+static uint8_t    PanelColumnEnd   = PANEL_WIDTH - 1;
+static uint8_t    PanelPageStart   = 0;
+static uint8_t    PanelPageEnd     = PANEL_PAGES - 1;
+
+// A command still waiting for some of its arguments.
+static uint8_t    PanelCommand  = 0;
+static uint8_t    PanelArgument[ PANEL_ARGUMENT_MAX ];
+static uint8_t    PanelHave     = 0;
+static uint8_t    PanelNeed     = 0;
+
+// Traffic since PanelClearBus().
+static uint32_t   BusBytes         = 0;
+static uint32_t   BusTransmissions = 0;
+static uint64_t   BusNanos         = 0;
+
+
+
+static uint8_t ArgumentCount (
+   uint8_t  Command
+);
+
+static void PanelRunCommand ();
+
+static void PanelCommandByte (
+   uint8_t  Value
+);
+
+static void PanelDataByte (
+   uint8_t  Value
+);
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< PanelReceive >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Take one I2C transmission, count it, and pass it on to the panel
+//             if it was sent to the panel's address.
+//
+// PARAMETERS: Address - The 7 bit address the transmission was sent to.
+//
+//             Data - The bytes sent after the address byte.
+//
+//             Length - The number of bytes in Data.
+//
+//             Clock - The I2C clock in Hz it was sent at.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Bytes are counted with the address byte, as 9 clocks each
+//                with the acknowledge bit, and each transmission as 2 more for
+//                its start and stop conditions.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void PanelReceive (
+   uint8_t        Address,
+   const uint8_t* Data,
+   size_t         Length,
+   uint32_t       Clock
+)
+{
+   size_t   i = 0;
+
+   BusBytes         += Length + 1;
+   BusTransmissions += 1;
+   BusNanos         += (uint64_t) ( ( Length + 1 ) * 9 + 2 ) * 1000000000 / Clock;
+
+   if ( Address == PANEL_ADDRESS_LOW || Address == PANEL_ADDRESS_HIGH )
+   {
+      while ( i < Length )
+      {
+         uint8_t  Control = Data[ i++ ];
+         size_t   Last    = ( Control & PANEL_CONTROL_CONTINUE ) ? min ( i + 1, Length ) : Length;
+
+         for ( ; i < Last; i++ )
+         {
+            if ( Control & PANEL_CONTROL_DATA )
+            {
+               PanelDataByte ( Data[ i ] );
+            }
+
+            else
+            {
+               PanelCommandByte ( Data[ i ] );
+            }
+         }
+      }
+   }
+}
+
+// ---------------------------------------------------------< /PanelReceive >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< PanelRAM >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the panel's display RAM.
+//
+// PARAMETERS: void
+//
+// RETURNS:    const uint8_t* - PANEL_RAM_SIZE bytes, laid out as the frame
+//                              buffer of Adafruit_SSD1306: a page of 8 rows
+//                              at a time, one byte per column, top row in the
+//                              low bit.
+//
+// NOTES:      None
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+const uint8_t* PanelRAM ()
+{
+   return PanelMemory;
+}
+
+// -------------------------------------------------------------< /PanelRAM >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< PanelOn >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return whether the panel has been turned on.
+//
+// PARAMETERS: void
+//
+// RETURNS:    bool - True after a display on command (0xaf).
+//
+// NOTES:      None
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool PanelOn ()
+{
+   return PanelDisplayOn;
+}
+
+// --------------------------------------------------------------< /PanelOn >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< PanelImage >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return what the panel shows as a binary PBM image.
+//
+// PARAMETERS: void
+//
+// RETURNS:    std::string - The image, lit pixels white.
+//
+// NOTES:      -  Laid out as the sketch's /Screen.pbm page lays it out, so the
+//                two can be compared byte for byte.
+//
+//             -  The column and row remapping and the display start line are
+//                applied, so a panel set up the wrong way round shows up the
+//                wrong way round.  An inverted panel is shown inverted, and a
+//                panel that is off is shown all black.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+std::string PanelImage ()
+{
+   std::string Image = "P4\n" + std::to_string ( PANEL_WIDTH ) + " " + std::to_string ( PANEL_HEIGHT ) + "\n";
+
+   for ( uint8_t y = 0; y < PANEL_HEIGHT; y++ )
+   {
+      uint8_t  Row = ( ( PanelComReverse ? y : PANEL_HEIGHT - 1 - y ) + PanelStartLine ) % PANEL_HEIGHT;
+
+      for ( uint8_t x = 0; x < PANEL_WIDTH; x += 8 )
+      {
+         uint8_t  Bits = 0;
+
+         for ( uint8_t i = 0; i < 8; i++ )
+         {
+            uint8_t  Column = PanelSegRemap ? x + i : PANEL_WIDTH - 1 - ( x + i );
+            bool     Lit    = ( PanelMemory[ ( Row / 8 ) * PANEL_WIDTH + Column ] >> ( Row % 8 ) ) & 1;
+
+            Lit  = PanelDisplayOn && ( ( Lit || PanelEntireOn ) != PanelInverted );
+            Bits = ( Bits << 1 ) | ( Lit ? 0 : 1 );
+         }
+
+         Image += (char) Bits;
+      }
+   }
+
+   return Image;
+}
+
+// -----------------------------------------------------------< /PanelImage >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< PanelBusBytes >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the number of bytes sent on the I2C bus since the last
+//             call to PanelClearBus(), counting address bytes.
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint32_t - The number of bytes.
+//
+// NOTES:      None
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t PanelBusBytes ()
+{
+   return BusBytes;
+}
+
+// --------------------------------------------------------< /PanelBusBytes >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------< PanelBusTransmissions >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the number of I2C transmissions since the last call to
+//             PanelClearBus().
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint32_t - The number of transmissions.
+//
+// NOTES:      None
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t PanelBusTransmissions ()
+{
+   return BusTransmissions;
+}
+
+// ------------------------------------------------< /PanelBusTransmissions >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< PanelBusTime >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the time the I2C bus has been busy since the last call to
+//             PanelClearBus().
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint32_t - The bus time in microseconds.
+//
+// NOTES:      -  Each transmission is timed at the clock set when it was sent.
+//                The gaps between transmissions are not counted.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t PanelBusTime ()
+{
+   return (uint32_t) ( BusNanos / 1000 );
+}
+
+// ---------------------------------------------------------< /PanelBusTime >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< PanelClearBus >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start counting I2C traffic over again.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:      -  What the panel shows is left as it is.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void PanelClearBus ()
+{
+   BusBytes         = 0;
+   BusTransmissions = 0;
+   BusNanos         = 0;
+}
+
+// --------------------------------------------------------< /PanelClearBus >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< ArgumentCount >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the number of argument bytes that follow a command.
+//
+// PARAMETERS: Command - The command byte.
+//
+// RETURNS:    uint8_t - The number of argument bytes.
+//
+// NOTES:      None
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static uint8_t ArgumentCount (
+   uint8_t  Command
+)
+{
+   uint8_t  Count = 0;
+
+   switch ( Command )
+   {
+      case 0x20:     // Memory addressing mode
+      case 0x81:     // Contrast
+      case 0x8d:     // Charge pump
+      case 0xa8:     // Multiplex ratio
+      case 0xd3:     // Display offset
+      case 0xd5:     // Clock divide ratio
+      case 0xd9:     // Pre-charge period
+      case 0xda:     // COM pins
+      case 0xdb:     // VCOMH deselect level
+         Count = 1;
+         break;
+
+      case 0x21:     // Column address window
+      case 0x22:     // Page address window
+      case 0xa3:     // Vertical scroll area
+         Count = 2;
+         break;
+
+      case 0x29:     // Vertical and horizontal scroll
+      case 0x2a:
+         Count = 5;
+         break;
+
+      case 0x26:     // Horizontal scroll
+      case 0x27:
+         Count = 6;
+         break;
+   }
+
+   return Count;
+}
+
+// --------------------------------------------------------< /ArgumentCount >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< PanelCommandByte >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Take one command byte, either a new command or an argument of
+//             the command waiting for them.
+//
+// PARAMETERS: Value - The byte.
+//
+// RETURNS:    void
+//
+// NOTES:      None
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void PanelCommandByte (
+   uint8_t  Value
+)
+{
+   if ( PanelHave < PanelNeed )
+   {
+      PanelArgument[ PanelHave++ ] = Value;
+   }
+
+   else
+   {
+      PanelCommand = Value;
+      PanelHave    = 0;
+      PanelNeed    = ArgumentCount ( Value );
+   }
+
+   if ( PanelHave == PanelNeed )
+   {
+      PanelRunCommand();
+   }
+}
+
+// -----------------------------------------------------< /PanelCommandByte >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< PanelRunCommand >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Carry out the command waiting, now that all of its arguments
+//             have arrived.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:      -  Setting the column or page window also moves the address to
+//                the start of it, as on the panel.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void PanelRunCommand ()
+{
+   uint8_t  Command = PanelCommand;
+
+   if ( Command <= 0x0f )
+   {
+      PanelColumn = ( PanelColumn & 0xf0 ) | Command;
+   }
+
+   else if ( Command <= 0x1f )
+   {
+      PanelColumn = ( ( Command & 0x07 ) << 4 ) | ( PanelColumn & 0x0f );
+   }
+
+   else if ( Command == 0x20 )
+   {
+      PanelMode = PanelArgument[ 0 ] & 0x03;
+   }
+
+   else if ( Command == 0x21 )
+   {
+      PanelColumnStart = PanelArgument[ 0 ] & 0x7f;
+      PanelColumnEnd   = PanelArgument[ 1 ] & 0x7f;
+      PanelColumn      = PanelColumnStart;
+   }
+
+   else if ( Command == 0x22 )
+   {
+      PanelPageStart = PanelArgument[ 0 ] & 0x07;
+      PanelPageEnd   = PanelArgument[ 1 ] & 0x07;
+      PanelPage      = PanelPageStart;
+   }
+
+   else if ( Command >= 0x40 && Command <= 0x7f )
+   {
+      PanelStartLine = Command & 0x3f;
+   }
+
+   else if ( Command == 0xa0 || Command == 0xa1 )
+   {
+      PanelSegRemap = ( Command == 0xa1 );
+   }
+
+   else if ( Command == 0xa4 || Command == 0xa5 )
+   {
+      PanelEntireOn = ( Command == 0xa5 );
+   }
+
+   else if ( Command == 0xa6 || Command == 0xa7 )
+   {
+      PanelInverted = ( Command == 0xa7 );
+   }
+
+   else if ( Command == 0xae || Command == 0xaf )
+   {
+      PanelDisplayOn = ( Command == 0xaf );
+   }
+
+   else if ( Command >= 0xb0 && Command <= 0xb7 )
+   {
+      PanelPage = Command & 0x07;
+   }
+
+   else if ( Command == 0xc0 || Command == 0xc8 )
+   {
+      PanelComReverse = ( Command == 0xc8 );
+   }
+
+   PanelHave = 0;
+   PanelNeed = 0;
+}
+
+// ------------------------------------------------------< /PanelRunCommand >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< PanelDataByte >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write one byte to the display RAM and move the address on.
+//
+// PARAMETERS: Value - The byte.
+//
+// RETURNS:    void
+//
+// NOTES:      -  In horizontal mode the column moves on first, and wraps to
+//                the next page at the end of the column window.  In vertical
+//                mode the page moves on first.  Either wraps back to the start
+//                of both windows after the last byte of them.
+//
+//             -  In page mode only the column moves on, and wraps to column 0
+//                at the end of the page.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void PanelDataByte (
+   uint8_t  Value
+)
+{
+   PanelMemory[ PanelPage * PANEL_WIDTH + PanelColumn ] = Value;
+
+   if ( PanelMode == PANEL_MODE_HORIZONTAL )
+   {
+      if ( PanelColumn >= PanelColumnEnd )
+      {
+         PanelColumn = PanelColumnStart;
+         PanelPage   = ( PanelPage >= PanelPageEnd ) ? PanelPageStart : PanelPage + 1;
+      }
+
+      else
+      {
+         PanelColumn++;
+      }
+   }
+
+   else if ( PanelMode == PANEL_MODE_VERTICAL )
+   {
+      if ( PanelPage >= PanelPageEnd )
+      {
+         PanelPage   = PanelPageStart;
+         PanelColumn = ( PanelColumn >= PanelColumnEnd ) ? PanelColumnStart : PanelColumn + 1;
+      }
+
+      else
+      {
+         PanelPage++;
+      }
+   }
+
+   else
+   {
+      PanelColumn = ( PanelColumn + 1 ) % PANEL_WIDTH;
+   }
+}
+
+// --------------------------------------------------------< /PanelDataByte >---
@@ -0,0 +1,81 @@
+#ifndef PANEL_EMULATOR
+#define PANEL_EMULATOR
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< PanelEmulator.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that emulate an SSD1306
+//          OLED panel on the I2C bus, for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The Wire stand-in passes every transmission on to PanelReceive(),
+//             so what the panel shows is built only from the bytes that went
+//             over the bus, and never from the driver's frame buffer.  A test
+//             can then check that the screen matches the buffer, and compare
+//             it with a stored image.
+//
+//          -  Every transmission is also counted, with the bus time it would
+//             take at the clock set when it was sent.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <string>
+
+
+
+// I2C addresses the panel answers to, either way its address pin is wired.
+#define PANEL_ADDRESS_LOW       0x3c
+#define PANEL_ADDRESS_HIGH      0x3d
+
+// Size of the panel, and of its display RAM in bytes.
+#define PANEL_WIDTH             128
+#define PANEL_HEIGHT            64
+#define PANEL_PAGES             ( PANEL_HEIGHT / 8 )
+#define PANEL_RAM_SIZE          ( PANEL_WIDTH * PANEL_PAGES )
+
+
+
+//
+// The bus side, called by the Wire stand-in.
+//
+void PanelReceive (
+   uint8_t        Address,
+   const uint8_t* Data,
+   size_t         Length,
+   uint32_t       Clock
+);
+
+//
+// What the panel shows.
+//
+const uint8_t* PanelRAM ();
+
+bool PanelOn ();
+
+std::string PanelImage ();
+
+//
+// What went over the bus.
+//
+uint32_t PanelBusBytes ();
+
+uint32_t PanelBusTransmissions ();
+
+uint32_t PanelBusTime ();
+
+void PanelClearBus ();
+
+
+
+#endif   // PANEL_EMULATOR
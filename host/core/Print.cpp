@@ -0,0 +1,197 @@
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< Print.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The Arduino Print and Stream classes, and the serial port, for the
+//          host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  What is written to the serial port is kept for the tests until
+//             they clear it (see HostSerialText), and shown on stdout unless
+//             that is turned off (see HostSerialEcho).
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include "HostCore.h"
+
+
+
+// The most serial text kept for the tests before the oldest is dropped.
+#define HOST_SERIAL_KEEP        65536
+
+
+
+HardwareSerial Serial;
+
+static bool          Echo = true;
+static std::string   Kept;
+
+
+
+size_t Print::write ( const uint8_t* Buffer, size_t Size )
+{
+   size_t   Written = 0;
+
+   while ( Written < Size && write ( Buffer[ Written ] ) == 1 )
+   {
+      Written++;
+   }
+
+   return Written;
+}
+
+size_t Print::write ( const char* Text )
+{
+   return ( Text != NULL ) ? write ( (const uint8_t*) Text, strlen ( Text ) ) : 0;
+}
+
+size_t Print::write ( const char* Buffer, size_t Size )
+{
+   return write ( (const uint8_t*) Buffer, Size );
+}
+
+size_t Print::printf ( const char* Format, ... )
+{
+   char     Small[ 64 ];
+   char*    Text = Small;
+   va_list  Args;
+   int      Length;
+
+   va_start ( Args, Format );
+   Length = vsnprintf ( Small, sizeof ( Small ), Format, Args );
+   va_end ( Args );
+
+   if ( Length >= (int) sizeof ( Small ) )
+   {
+      Text = new char[ Length + 1 ];
+      va_start ( Args, Format );
+      vsnprintf ( Text, Length + 1, Format, Args );
+      va_end ( Args );
+   }
+
+   Length = ( Length > 0 ) ? write ( (const uint8_t*) Text, Length ) : 0;
+
+   if ( Text != Small )
+   {
+      delete[] Text;
+   }
+
+   return Length;
+}
+
+size_t Print::printNumber ( unsigned long Value, int Base )
+{
+   return print ( String ( Value, (unsigned char) Base ) );
+}
+
+size_t Print::print ( const String& Text )                  { return write ( (const uint8_t*) Text.c_str(), Text.length() ); }
+size_t Print::print ( const char* Text )                    { return write ( Text ); }
+size_t Print::print ( char Value )                          { return write ( (uint8_t) Value ); }
+size_t Print::print ( unsigned char Value, int Base )       { return printNumber ( Value, Base ); }
+size_t Print::print ( unsigned int Value, int Base )        { return printNumber ( Value, Base ); }
+size_t Print::print ( unsigned long Value, int Base )       { return printNumber ( Value, Base ); }
+size_t Print::print ( int Value, int Base )                 { return print ( (long) Value, Base ); }
+size_t Print::print ( double Value, int Places )            { return print ( String ( Value, (unsigned char) Places ) ); }
+size_t Print::print ( const Printable& Value )              { return Value.printTo ( *this ); }
+
+size_t Print::print ( long Value, int Base )
+{
+   return ( Base == 10 ) ? print ( String ( Value ) ) : printNumber ( (unsigned long) Value, Base );
+}
+
+size_t Print::println ()                                    { return write ( "\r\n" ); }
+size_t Print::println ( const String& Text )                { return print ( Text ) + println(); }
+size_t Print::println ( const char* Text )                  { return print ( Text ) + println(); }
+size_t Print::println ( char Value )                        { return print ( Value ) + println(); }
+size_t Print::println ( unsigned char Value, int Base )     { return print ( Value, Base ) + println(); }
+size_t Print::println ( int Value, int Base )               { return print ( Value, Base ) + println(); }
+size_t Print::println ( unsigned int Value, int Base )      { return print ( Value, Base ) + println(); }
+size_t Print::println ( long Value, int Base )              { return print ( Value, Base ) + println(); }
+size_t Print::println ( unsigned long Value, int Base )     { return print ( Value, Base ) + println(); }
+size_t Print::println ( double Value, int Places )          { return print ( Value, Places ) + println(); }
+size_t Print::println ( const Printable& Value )            { return print ( Value ) + println(); }
+
+
+
+size_t Stream::readBytes ( char* Buffer, size_t Length )
+{
+   size_t   Count = 0;
+   int      Value;
+
+   while ( Count < Length && ( Value = read() ) >= 0 )
+   {
+      Buffer[ Count++ ] = (char) Value;
+   }
+
+   return Count;
+}
+
+String Stream::readStringUntil ( char Terminator )
+{
+   String   Text;
+   int      Value;
+
+   while ( ( Value = read() ) >= 0 && Value != Terminator )
+   {
+      Text += (char) Value;
+   }
+
+   return Text;
+}
+
+
+
+void HardwareSerial::begin ( unsigned long Rate )           { Baud = Rate; }
+void HardwareSerial::end ()                                 { Baud = 0; }
+void HardwareSerial::updateBaudRate ( unsigned long Rate )  { Baud = Rate; }
+unsigned long HardwareSerial::baudRate ()                   { return Baud; }
+int HardwareSerial::availableForWrite ()                    { return 128; }
+
+size_t HardwareSerial::write ( uint8_t Value )
+{
+   return write ( &Value, 1 );
+}
+
+size_t HardwareSerial::write ( const uint8_t* Buffer, size_t Size )
+{
+   HostHeapPause  Pause;
+
+   if ( Echo == true )
+   {
+      fwrite ( Buffer, 1, Size, stdout );
+   }
+
+   Kept.append ( (const char*) Buffer, Size );
+
+   if ( Kept.length() > HOST_SERIAL_KEEP )
+   {
+      Kept.erase ( 0, Kept.length() - HOST_SERIAL_KEEP / 2 );
+   }
+
+   return Size;
+}
+
+
+
+void HostSerialEcho (
+   bool  On
+)
+{
+   Echo = On;
+}
+
+std::string& HostSerialText ()
+{
+   return Kept;
+}
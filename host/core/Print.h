@@ -0,0 +1,92 @@
+#ifndef PRINT_H
+#define PRINT_H
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< Print.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The Arduino Print class for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "WString.h"
+
+
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+
+
+class Print;
+
+class Printable
+{
+   public:
+
+   virtual ~Printable () {}
+   virtual size_t printTo ( Print& Out ) const = 0;
+};
+
+
+
+class Print
+{
+   public:
+
+   virtual ~Print () {}
+
+   virtual size_t write ( uint8_t Value ) = 0;
+   virtual size_t write ( const uint8_t* Buffer, size_t Size );
+   size_t write ( const char* Text );
+   size_t write ( const char* Buffer, size_t Size );
+
+   size_t printf ( const char* Format, ... ) __attribute__ ( ( format ( printf, 2, 3 ) ) );
+
+   size_t print ( const String& Text );
+   size_t print ( const char* Text );
+   size_t print ( char Value );
+   size_t print ( unsigned char Value, int Base = DEC );
+   size_t print ( int Value, int Base = DEC );
+   size_t print ( unsigned int Value, int Base = DEC );
+   size_t print ( long Value, int Base = DEC );
+   size_t print ( unsigned long Value, int Base = DEC );
+   size_t print ( double Value, int Places = 2 );
+   size_t print ( const Printable& Value );
+
+   size_t println ( const String& Text );
+   size_t println ( const char* Text );
+   size_t println ( char Value );
+   size_t println ( unsigned char Value, int Base = DEC );
+   size_t println ( int Value, int Base = DEC );
+   size_t println ( unsigned int Value, int Base = DEC );
+   size_t println ( long Value, int Base = DEC );
+   size_t println ( unsigned long Value, int Base = DEC );
+   size_t println ( double Value, int Places = 2 );
+   size_t println ( const Printable& Value );
+   size_t println ();
+
+   virtual void flush () {}
+
+   private:
+
+   size_t printNumber ( unsigned long Value, int Base );
+};
+
+
+
+#endif   // PRINT_H
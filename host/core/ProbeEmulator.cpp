@@ -0,0 +1,1149 @@
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< ProbeEmulator.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that emulate a OneWire bus with DS18B20 temperature probes
+//          on it, behind the host build's OneWire stand-in.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The master side routines follow the OneWire library, and the
+//             device side follows the DS18B20 data sheet, so the sketch's own
+//             probe routines send the same commands in the same number of
+//             time slots as with real probes.  That makes the counted bus time
+//             a fair measure of what the real bus would take.
+//
+//          -  Every emulated device sees every time slot.  Devices that were
+//             not addressed, or have dropped out of a search, stay quiet.  A
+//             read slot returns the wired-AND of every device still talking,
+//             exactly like the open drain bus.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <OneWire.h>
+#include "ProbeEmulator.h"
+
+
+
+//
+// What the emulated devices expect the next time slots to be.
+//
+#define EMU_STATE_IDLE          0     // Nothing until the next reset
+#define EMU_STATE_ROM           1     // A ROM command
+#define EMU_STATE_MATCH         2     // The 8 bytes of a match ROM command
+#define EMU_STATE_SEARCH        3     // The bit triplets of a search ROM
+#define EMU_STATE_FUNCTION      4     // A function command
+#define EMU_STATE_WRITE         5     // The 3 bytes of a write scratchpad
+#define EMU_STATE_READ          6     // Reads of the Output bytes
+#define EMU_STATE_CONVERT       7     // Reads report whether still converting
+
+// Temperatures a DS18B20 can measure, in sixteenths of a degree.
+#define EMU_TEMP_MIN            ( -55 * 16 )
+#define EMU_TEMP_MAX            ( 125 * 16 )
+
+
+
+static EDevice_t  EmuDevice[ EMU_DEVICE_MAX ];
+static uint8_t    EmuCount = 0;
+
+// Bus state shared by all of the devices.
+static uint8_t    EmuState     = EMU_STATE_IDLE;
+static uint8_t    EmuShift     = 0;    // Bits of the byte being written
+static uint8_t    EmuBits      = 0;    // How many of them have arrived
+static uint8_t    EmuBytes     = 0;    // Bytes handled in the current state
+static uint8_t    EmuPhase     = 0;    // Step of the current search triplet
+static uint8_t    EmuPosition  = 0;    // Bit of the ROM code being searched
+static uint16_t   EmuReadBits  = 0;    // Bits of Output read so far
+static uint16_t   EmuReadLimit = 0;    // Bits of Output there are to read
+
+// Output bytes of each device for the current read.
+static uint8_t    EmuOutput[ EMU_DEVICE_MAX ][ 9 ];
+
+// Master side search state, as kept by the OneWire library.
+static uint8_t    SearchAddress[ 8 ];
+static uint8_t    SearchDiscrepancy = 0;
+static bool       SearchLastDevice  = false;
+
+// Bus time in microseconds since EmuClearBusTime().
+static uint32_t   EmuBusMicros = 0;
+
+
+
+static uint8_t DeviceResolution (
+   EDevice_t*  Device
+);
+
+static void DevicePowerOn (
+   EDevice_t*  Device
+);
+
+static void DeviceUpdate (
+   EDevice_t*  Device
+);
+
+static void DeviceByte (
+   uint8_t     Value
+);
+
+static void DeviceStartRead (
+   uint8_t     Length
+);
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< EmuBegin >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Set up the emulated bus with a number of DS18B20 devices on it.
+//
+// PARAMETERS: Devices - The number of devices to put on the bus, at most
+//                       EMU_DEVICE_MAX.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The ROM codes are made up from a fixed sequence, so they are
+//                the same every time but still differ in enough bits to give
+//                the search some work to do.
+//
+//             -  Every device starts out as if just powered on, at 12 bits
+//                resolution and 20 degrees.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void EmuBegin (
+   uint8_t  Devices
+)
+{
+   uint32_t Seed = 0x5eed1820;
+
+   EmuCount = min ( Devices, (uint8_t) EMU_DEVICE_MAX );
+
+   for ( uint8_t i = 0; i < EmuCount; i++ )
+   {
+      EDevice_t* Device = &EmuDevice[ i ];
+
+      Device->Address[ 0 ] = 0x28;
+
+      for ( uint8_t j = 1; j < 7; j++ )
+      {
+         Seed = Seed * 1103515245 + 12345;
+         Device->Address[ j ] = Seed >> 24;
+      }
+
+      Device->Address[ 7 ] = OneWire::crc8 ( Device->Address, 7 );
+
+      // Factory settings of the alarm limits and the configuration register.
+      Device->Eeprom[ 0 ] = 0x4b;
+      Device->Eeprom[ 1 ] = 0x46;
+      Device->Eeprom[ 2 ] = 0x7f;
+
+      Device->Temperature = 20 * 16;
+      Device->Active      = false;
+      Device->Fault       = EMU_FAULT_NONE;
+      Device->FaultCount  = 0;
+
+      DevicePowerOn ( Device );
+   }
+
+   EmuState = EMU_STATE_IDLE;
+   EmuResetSearch();
+   EmuClearBusTime();
+}
+
+// -------------------------------------------------------------< /EmuBegin >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< EmuReset >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send a reset pulse on the emulated bus and listen for a presence
+//             pulse.
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint8_t - 1 if any device answered, 0 if none did.
+//
+// NOTES:      -  A device with a no reply fault stays silent for the whole of
+//                the transaction the reset starts.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint8_t EmuReset ()
+{
+   uint8_t Present = 0;
+
+   EmuBusMicros += EMU_RESET_TIME;
+
+   for ( uint8_t i = 0; i < EmuCount; i++ )
+   {
+      EDevice_t* Device = &EmuDevice[ i ];
+
+      DeviceUpdate ( Device );
+
+      if ( Device->Fault == EMU_FAULT_NO_REPLY )
+      {
+         Device->Active = false;
+
+         if ( --Device->FaultCount == 0 )
+         {
+            Device->Fault = EMU_FAULT_NONE;
+         }
+      }
+
+      else
+      {
+         Device->Active = true;
+         Present = 1;
+      }
+   }
+
+   EmuState = EMU_STATE_ROM;
+   EmuShift = 0;
+   EmuBits  = 0;
+   EmuBytes = 0;
+
+   return Present;
+}
+
+// -------------------------------------------------------------< /EmuReset >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< EmuWriteBit >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write one bit to the emulated bus.
+//
+// PARAMETERS: Bit - The bit to write, 0 or 1.
+//
+// RETURNS:    void
+//
+// NOTES:      -  During a search this is the direction bit of a triplet, and
+//                every device whose ROM code has the other value at this bit
+//                drops out.  Otherwise the bits are gathered, least significant
+//                first, into bytes for the devices to act on.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void EmuWriteBit (
+   uint8_t  Bit
+)
+{
+   Bit = Bit & 1;
+
+   EmuBusMicros += ( Bit == 1 ) ? EMU_WRITE_1_TIME : EMU_WRITE_0_TIME;
+
+   if ( EmuState == EMU_STATE_SEARCH && EmuPhase == 2 )
+   {
+      for ( uint8_t i = 0; i < EmuCount; i++ )
+      {
+         EDevice_t* Device = &EmuDevice[ i ];
+         uint8_t    RomBit = ( Device->Address[ EmuPosition / 8 ] >> ( EmuPosition % 8 ) ) & 1;
+
+         Device->Active = Device->Active && ( RomBit == Bit );
+      }
+
+      EmuPhase = 0;
+      EmuPosition++;
+
+      // The device left at the end of a search is selected, as if matched.
+      if ( EmuPosition == 64 )
+      {
+         EmuState = EMU_STATE_FUNCTION;
+      }
+   }
+
+   else
+   {
+      EmuShift |= Bit << EmuBits;
+      EmuBits++;
+
+      if ( EmuBits == 8 )
+      {
+         DeviceByte ( EmuShift );
+         EmuShift = 0;
+         EmuBits  = 0;
+      }
+   }
+}
+
+// ----------------------------------------------------------< /EmuWriteBit >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< EmuReadBit >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Read one bit from the emulated bus.
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint8_t - The bit read, 0 or 1.
+//
+// NOTES:      -  A bus nobody is driving reads as 1.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint8_t EmuReadBit ()
+{
+   uint8_t Bit = 1;
+
+   EmuBusMicros += EMU_READ_TIME;
+
+   if ( EmuState == EMU_STATE_SEARCH && EmuPhase < 2 )
+   {
+      // Each device still in the search sends the ROM code bit, and then its
+      // complement.
+      for ( uint8_t i = 0; i < EmuCount; i++ )
+      {
+         EDevice_t* Device = &EmuDevice[ i ];
+
+         if ( Device->Active == true )
+         {
+            Bit &= ( Device->Address[ EmuPosition / 8 ] >> ( EmuPosition % 8 ) ) ^ EmuPhase;
+         }
+      }
+
+      EmuPhase++;
+   }
+
+   else if ( EmuState == EMU_STATE_READ && EmuReadBits < EmuReadLimit )
+   {
+      for ( uint8_t i = 0; i < EmuCount; i++ )
+      {
+         if ( EmuDevice[ i ].Active == true )
+         {
+            Bit &= EmuOutput[ i ][ EmuReadBits / 8 ] >> ( EmuReadBits % 8 );
+         }
+      }
+
+      EmuReadBits++;
+   }
+
+   else if ( EmuState == EMU_STATE_CONVERT )
+   {
+      // A device holds the bus low while it is still converting.
+      for ( uint8_t i = 0; i < EmuCount; i++ )
+      {
+         EDevice_t* Device = &EmuDevice[ i ];
+
+         DeviceUpdate ( Device );
+
+         if ( Device->Active == true && Device->Converting == true )
+         {
+            Bit = 0;
+         }
+      }
+   }
+
+   return Bit & 1;
+}
+
+// -----------------------------------------------------------< /EmuReadBit >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< EmuWrite >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write a byte to the emulated bus, least significant bit first.
+//
+// PARAMETERS: Value - The byte to write.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void EmuWrite (
+   uint8_t  Value
+)
+{
+   for ( uint8_t i = 0; i < 8; i++ )
+   {
+      EmuWriteBit ( Value >> i );
+   }
+}
+
+// -------------------------------------------------------------< /EmuWrite >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< EmuRead >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Read a byte from the emulated bus, least significant bit first.
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint8_t - The byte read.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint8_t EmuRead ()
+{
+   uint8_t Value = 0;
+
+   for ( uint8_t i = 0; i < 8; i++ )
+   {
+      Value |= EmuReadBit() << i;
+   }
+
+   return Value;
+}
+
+// --------------------------------------------------------------< /EmuRead >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< EmuSelect >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Address one device on the emulated bus by its ROM code.
+//
+// PARAMETERS: Address - The 8 byte ROM code of the device.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void EmuSelect (
+   const uint8_t* Address
+)
+{
+   EmuWrite ( EMU_MATCH_ROM );
+
+   for ( uint8_t i = 0; i < 8; i++ )
+   {
+      EmuWrite ( Address[ i ] );
+   }
+}
+
+// ------------------------------------------------------------< /EmuSelect >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< EmuSkip >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Address every device on the emulated bus at once.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void EmuSkip ()
+{
+   EmuWrite ( EMU_SKIP_ROM );
+}
+
+// --------------------------------------------------------------< /EmuSkip >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< EmuResetSearch >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start the next EmuSearch() over from the first device.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void EmuResetSearch ()
+{
+   memset ( SearchAddress, 0, sizeof ( SearchAddress ) );
+   SearchDiscrepancy = 0;
+   SearchLastDevice  = false;
+}
+
+// -------------------------------------------------------< /EmuResetSearch >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< EmuSearch >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Find the ROM code of the next device on the emulated bus.
+//
+// PARAMETERS: Address - Returns the 8 byte ROM code of the device found.
+//
+// RETURNS:    bool - True if a device was found, false once there are no more.
+//
+// NOTES:      -  This is the search ROM algorithm from Maxim application note
+//                187, the same as OneWire::search() uses.  Each ROM code bit
+//                takes a triplet of time slots: the bit from every device, its
+//                complement, and the direction chosen by the master.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool EmuSearch (
+   uint8_t* Address
+)
+{
+   bool     Found     = false;
+   uint8_t  LastZero  = 0;
+   uint8_t  BitNumber = 1;
+
+   if ( SearchLastDevice == false && EmuReset() == 1 )
+   {
+      bool Done = false;
+
+      EmuWrite ( EMU_SEARCH_ROM );
+
+      while ( Done == false && BitNumber <= 64 )
+      {
+         uint8_t  IdBit  = EmuReadBit();
+         uint8_t  CmpBit = EmuReadBit();
+         uint8_t  Byte   = ( BitNumber - 1 ) / 8;
+         uint8_t  Mask   = 1 << ( ( BitNumber - 1 ) % 8 );
+         uint8_t  Direction;
+
+         if ( IdBit == 1 && CmpBit == 1 )
+         {
+            // Nobody is left in the search.
+            Done = true;
+         }
+
+         else
+         {
+            if ( IdBit != CmpBit )
+            {
+               // Every device left has the same bit here.
+               Direction = IdBit;
+            }
+
+            else if ( BitNumber < SearchDiscrepancy )
+            {
+               // Take the same path as last time.
+               Direction = ( ( SearchAddress[ Byte ] & Mask ) != 0 );
+            }
+
+            else
+            {
+               // Take the 1 path at the last discrepancy, and 0 at new ones.
+               Direction = ( BitNumber == SearchDiscrepancy );
+            }
+
+            if ( IdBit == CmpBit && Direction == 0 )
+            {
+               LastZero = BitNumber;
+            }
+
+            if ( Direction == 1 )
+            {
+               SearchAddress[ Byte ] |= Mask;
+            }
+
+            else
+            {
+               SearchAddress[ Byte ] &= ~Mask;
+            }
+
+            EmuWriteBit ( Direction );
+            BitNumber++;
+         }
+      }
+
+      if ( BitNumber > 64 )
+      {
+         SearchDiscrepancy = LastZero;
+         SearchLastDevice  = ( LastZero == 0 );
+         Found = true;
+      }
+   }
+
+   if ( Found == true && SearchAddress[ 0 ] != 0 )
+   {
+      memcpy ( Address, SearchAddress, sizeof ( SearchAddress ) );
+   }
+
+   else
+   {
+      EmuResetSearch();
+      Found = false;
+   }
+
+   return Found;
+}
+
+// ------------------------------------------------------------< /EmuSearch >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< EmuConversionTime >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return how long a DS18B20 takes to do a conversion.
+//
+// PARAMETERS: Resolution - The resolution in bits (9..12).
+//
+// RETURNS:    uint32_t - The conversion time in milliseconds.
+//
+// NOTES:      -  The data sheet maximum, the same as DallasTemperature waits.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t EmuConversionTime (
+   uint8_t  Resolution
+)
+{
+   uint32_t Time = 750;
+
+   switch ( Resolution )
+   {
+      case 9:
+         Time = 94;
+         break;
+
+      case 10:
+         Time = 188;
+         break;
+
+      case 11:
+         Time = 375;
+         break;
+   }
+
+   return Time;
+}
+
+// ----------------------------------------------------< /EmuConversionTime >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< EmuSetTemperature >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Set the temperature an emulated device will measure.
+//
+// PARAMETERS: Device - Which device on the bus, in the order they were made.
+//
+//             Value - The temperature in sixteenths of a degree celsius.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The new temperature shows up in the scratchpad at the end of
+//                the next conversion, not straight away.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void EmuSetTemperature (
+   uint8_t  Device,
+   int16_t  Value
+)
+{
+   if ( Device < EmuCount )
+   {
+      EmuDevice[ Device ].Temperature = constrain ( Value, EMU_TEMP_MIN, EMU_TEMP_MAX );
+   }
+}
+
+// ----------------------------------------------------< /EmuSetTemperature >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< EmuFault >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Make an emulated device misbehave for a while.
+//
+// PARAMETERS: Address - The 8 byte ROM code of the device.
+//
+//             Fault - What goes wrong (EMU_FAULT_...).  EMU_FAULT_NONE clears
+//                     any fault still pending.
+//
+//             Count - How many times it goes wrong: resets ignored for a no
+//                     reply fault, scratchpad reads corrupted for a CRC
+//                     fault, or conversions lost for a power on fault.
+//
+// RETURNS:    bool - True if the fault was set, false if the device or the
+//                    fault is not known.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool EmuFault (
+   const uint8_t* Address,
+   uint8_t        Fault,
+   uint16_t       Count
+)
+{
+   bool Valid = false;
+
+   for ( uint8_t i = 0; i < EmuCount && Fault <= EMU_FAULT_POWER_ON; i++ )
+   {
+      EDevice_t* Device = &EmuDevice[ i ];
+
+      if ( memcmp ( Device->Address, Address, sizeof ( Device->Address ) ) == 0 )
+      {
+         Device->Fault      = ( Count > 0 ) ? Fault : EMU_FAULT_NONE;
+         Device->FaultCount = Count;
+         Valid = true;
+      }
+   }
+
+   return Valid;
+}
+
+// -------------------------------------------------------------< /EmuFault >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< EmuBusTime >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the bus time used since EmuClearBusTime().
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint32_t - The bus time in microseconds.
+//
+// NOTES:      -  This is the time the same traffic would keep a real bus busy.
+//                Conversion time is not included, the bus is free then.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t EmuBusTime ()
+{
+   return EmuBusMicros;
+}
+
+// -----------------------------------------------------------< /EmuBusTime >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< EmuClearBusTime >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start counting bus time from zero.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void EmuClearBusTime ()
+{
+   EmuBusMicros = 0;
+}
+
+// ------------------------------------------------------< /EmuClearBusTime >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< DeviceResolution >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the resolution an emulated device is set to.
+//
+// PARAMETERS: Device - Pointer to the device.
+//
+// RETURNS:    uint8_t - The resolution in bits (9..12).
+//
+// NOTES:      -  Bits 6-5 of the configuration register hold the resolution.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static uint8_t DeviceResolution (
+   EDevice_t*  Device
+)
+{
+   return ( ( Device->Scratchpad[ 4 ] >> 5 ) & 0x03 ) + 9;
+}
+
+// -----------------------------------------------------< /DeviceResolution >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< DevicePowerOn >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Put an emulated device in its power on state.
+//
+// PARAMETERS: Device - Pointer to the device.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The temperature register reads 85 degrees until the first
+//                conversion, and the other settings come back from EEPROM.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void DevicePowerOn (
+   EDevice_t*  Device
+)
+{
+   Device->Scratchpad[ 0 ] = 0x50;
+   Device->Scratchpad[ 1 ] = 0x05;
+   Device->Scratchpad[ 2 ] = Device->Eeprom[ 0 ];
+   Device->Scratchpad[ 3 ] = Device->Eeprom[ 1 ];
+   Device->Scratchpad[ 4 ] = Device->Eeprom[ 2 ];
+   Device->Scratchpad[ 5 ] = 0xff;
+   Device->Scratchpad[ 6 ] = 0x0c;
+   Device->Scratchpad[ 7 ] = 0x10;
+   Device->Scratchpad[ 8 ] = OneWire::crc8 ( Device->Scratchpad, 8 );
+
+   Device->Converting = false;
+}
+
+// --------------------------------------------------------< /DevicePowerOn >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< DeviceUpdate >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Finish the conversion of an emulated device if its time is up.
+//
+// PARAMETERS: Device - Pointer to the device.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The bits below the resolution are left as zero.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void DeviceUpdate (
+   EDevice_t*  Device
+)
+{
+   uint8_t Resolution = DeviceResolution ( Device );
+
+   if (  Device->Converting == true
+      && millis() - Device->ConvertStart >= EmuConversionTime ( Resolution )
+      )
+   {
+      int16_t Raw = Device->Temperature & ~( ( 1 << ( 12 - Resolution ) ) - 1 );
+
+      Device->Scratchpad[ 0 ] = Raw & 0xff;
+      Device->Scratchpad[ 1 ] = ( Raw >> 8 ) & 0xff;
+      Device->Scratchpad[ 8 ] = OneWire::crc8 ( Device->Scratchpad, 8 );
+      Device->Converting = false;
+   }
+}
+
+// ---------------------------------------------------------< /DeviceUpdate >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< DeviceByte >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Act on a byte the master has written to the emulated devices.
+//
+// PARAMETERS: Value - The byte written.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Only the devices still active in the transaction act on it.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void DeviceByte (
+   uint8_t     Value
+)
+{
+   switch ( EmuState )
+   {
+      case EMU_STATE_ROM:
+         EmuBytes = 0;
+
+         switch ( Value )
+         {
+            case EMU_SEARCH_ROM:
+               EmuState    = EMU_STATE_SEARCH;
+               EmuPhase    = 0;
+               EmuPosition = 0;
+               break;
+
+            case EMU_READ_ROM:
+               for ( uint8_t i = 0; i < EmuCount; i++ )
+               {
+                  memcpy ( EmuOutput[ i ], EmuDevice[ i ].Address, 8 );
+               }
+
+               DeviceStartRead ( 8 );
+               break;
+
+            case EMU_MATCH_ROM:
+               EmuState = EMU_STATE_MATCH;
+               break;
+
+            case EMU_SKIP_ROM:
+               EmuState = EMU_STATE_FUNCTION;
+               break;
+
+            default:
+               EmuState = EMU_STATE_IDLE;
+               break;
+         }
+         break;
+
+      case EMU_STATE_MATCH:
+         for ( uint8_t i = 0; i < EmuCount; i++ )
+         {
+            EDevice_t* Device = &EmuDevice[ i ];
+
+            Device->Active = Device->Active && ( Device->Address[ EmuBytes ] == Value );
+         }
+
+         if ( ++EmuBytes == 8 )
+         {
+            EmuState = EMU_STATE_FUNCTION;
+         }
+         break;
+
+      case EMU_STATE_FUNCTION:
+         EmuBytes = 0;
+         EmuState = EMU_STATE_IDLE;
+
+         for ( uint8_t i = 0; i < EmuCount; i++ )
+         {
+            EDevice_t* Device = &EmuDevice[ i ];
+
+            if ( Device->Active == true )
+            {
+               DeviceUpdate ( Device );
+
+               switch ( Value )
+               {
+                  case EMU_CONVERT_T:
+                     if ( Device->Fault == EMU_FAULT_POWER_ON )
+                     {
+                        // A brown out part way through loses the conversion.
+                        DevicePowerOn ( Device );
+
+                        if ( --Device->FaultCount == 0 )
+                        {
+                           Device->Fault = EMU_FAULT_NONE;
+                        }
+                     }
+
+                     else
+                     {
+                        Device->Converting   = true;
+                        Device->ConvertStart = millis();
+                     }
+
+                     EmuState = EMU_STATE_CONVERT;
+                     break;
+
+                  case EMU_WRITE_SCRATCHPAD:
+                     EmuState = EMU_STATE_WRITE;
+                     break;
+
+                  case EMU_READ_SCRATCHPAD:
+                     memcpy ( EmuOutput[ i ], Device->Scratchpad, 9 );
+
+                     if ( Device->Fault == EMU_FAULT_CRC )
+                     {
+                        // Flip one bit of the temperature on its way out.
+                        EmuOutput[ i ][ 0 ] ^= 1 << ( Device->FaultCount % 8 );
+
+                        if ( --Device->FaultCount == 0 )
+                        {
+                           Device->Fault = EMU_FAULT_NONE;
+                        }
+                     }
+
+                     EmuState = EMU_STATE_READ;
+                     break;
+
+                  case EMU_COPY_SCRATCHPAD:
+                     memcpy ( Device->Eeprom, &Device->Scratchpad[ 2 ], 3 );
+                     break;
+
+                  case EMU_RECALL_EEPROM:
+                     memcpy ( &Device->Scratchpad[ 2 ], Device->Eeprom, 3 );
+                     Device->Scratchpad[ 8 ] = OneWire::crc8 ( Device->Scratchpad, 8 );
+                     break;
+               }
+            }
+         }
+
+         if ( EmuState == EMU_STATE_READ )
+         {
+            DeviceStartRead ( 9 );
+         }
+         break;
+
+      case EMU_STATE_WRITE:
+         for ( uint8_t i = 0; i < EmuCount; i++ )
+         {
+            EDevice_t* Device = &EmuDevice[ i ];
+
+            if ( Device->Active == true )
+            {
+               // Only the resolution bits of the configuration register can
+               // be written, the rest always read as ones.
+               Device->Scratchpad[ 2 + EmuBytes ] = ( EmuBytes == 2 ) ? ( Value & 0x60 ) | 0x1f : Value;
+               Device->Scratchpad[ 8 ] = OneWire::crc8 ( Device->Scratchpad, 8 );
+            }
+         }
+
+         if ( ++EmuBytes == 3 )
+         {
+            EmuState = EMU_STATE_IDLE;
+         }
+         break;
+
+      default:
+         // Nothing listens to a write in the other states.
+         break;
+   }
+}
+
+// -----------------------------------------------------------< /DeviceByte >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< DeviceStartRead >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Get ready to send the Output bytes of the active devices.
+//
+// PARAMETERS: Length - The number of bytes to send.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void DeviceStartRead (
+   uint8_t     Length
+)
+{
+   EmuState     = EMU_STATE_READ;
+   EmuReadBits  = 0;
+   EmuReadLimit = Length * 8;
+}
+
+// ------------------------------------------------------< /DeviceStartRead >---
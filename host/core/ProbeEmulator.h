@@ -0,0 +1,180 @@
+#ifndef PROBE_EMULATOR
+#define PROBE_EMULATOR
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< ProbeEmulator.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that emulate a OneWire bus
+//          with DS18B20 temperature probes on it, for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The bus is emulated one time slot at a time, so the same bits go
+//             back and forth as on a real bus and the bus time each operation
+//             would take can be counted, even though nothing actually waits.
+//
+//          -  The OneWire stand-in passes every bus operation on to these, so
+//             the sketch reads the emulated probes through the stand-in
+//             DallasTemperature exactly as it reads real ones.  Tests put
+//             probes on the bus with EmuBegin(), and set what they read with
+//             the controls below.  With no devices the bus is empty, as on a
+//             board with nothing plugged in.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+
+
+
+// The most devices that can be put on the emulated bus.
+#define EMU_DEVICE_MAX          8
+
+//
+// Bus time in microseconds of each kind of time slot, from the timings used
+// by the OneWire library.
+//
+#define EMU_RESET_TIME          960   // Reset pulse and presence detect
+#define EMU_WRITE_0_TIME        70    // Write a zero bit
+#define EMU_WRITE_1_TIME        65    // Write a one bit
+#define EMU_READ_TIME           66    // Read a bit
+
+//
+// DS18B20 commands understood by the emulated devices.
+//
+#define EMU_SEARCH_ROM          0xf0
+#define EMU_READ_ROM            0x33
+#define EMU_MATCH_ROM           0x55
+#define EMU_SKIP_ROM            0xcc
+#define EMU_CONVERT_T           0x44
+#define EMU_WRITE_SCRATCHPAD    0x4e
+#define EMU_READ_SCRATCHPAD     0xbe
+#define EMU_COPY_SCRATCHPAD     0x48
+#define EMU_RECALL_EEPROM       0xb8
+
+//
+// Faults that can be injected into an emulated device (see EmuFault).
+//
+#define EMU_FAULT_NONE          0     // Working normally
+#define EMU_FAULT_NO_REPLY      1     // Ignores the bus completely
+#define EMU_FAULT_CRC           2     // One bit of the scratchpad is corrupted
+#define EMU_FAULT_POWER_ON      3     // Resets instead of doing a conversion
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< EMU_DEVICE >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: The state of one emulated DS18B20.
+//
+// FIELDS:  Address - The 64 bit ROM code, family code first and CRC last.
+//
+//          Scratchpad - The 9 byte scratchpad, CRC last.
+//
+//          Eeprom - TH, TL, and configuration register saved by a copy
+//                   scratchpad command, and restored at power on.
+//
+//          Temperature - The temperature the device will measure, in
+//                        sixteenths of a degree celsius.
+//
+//          ConvertStart - The millis() time the current conversion started.
+//
+//          Converting - True while a conversion is in process.
+//
+//          Active - True while the device takes part in the current bus
+//                   transaction (addressed, or still in a search).
+//
+//          Fault - The injected fault (EMU_FAULT_...).
+//
+//          FaultCount - How many more transactions the fault affects.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct EMU_DEVICE
+{
+   uint8_t  Address[ 8 ];
+   uint8_t  Scratchpad[ 9 ];
+   uint8_t  Eeprom[ 3 ];
+   int16_t  Temperature;
+   uint32_t ConvertStart;
+   bool     Converting;
+   bool     Active;
+   uint8_t  Fault;
+   uint16_t FaultCount;
+} EDevice_t;
+
+// -----------------------------------------------------------< /EMU_DEVICE >---
+
+
+
+//
+// Bus level operations, the same as the OneWire library provides.
+//
+void EmuBegin (
+   uint8_t  Devices
+);
+
+uint8_t EmuReset ();
+
+void EmuWriteBit (
+   uint8_t  Bit
+);
+
+uint8_t EmuReadBit ();
+
+void EmuWrite (
+   uint8_t  Value
+);
+
+uint8_t EmuRead ();
+
+void EmuSelect (
+   const uint8_t* Address
+);
+
+void EmuSkip ();
+
+void EmuResetSearch ();
+
+bool EmuSearch (
+   uint8_t* Address
+);
+
+//
+// Control of the emulation itself.
+//
+uint32_t EmuConversionTime (
+   uint8_t  Resolution
+);
+
+void EmuSetTemperature (
+   uint8_t  Device,
+   int16_t  Value
+);
+
+bool EmuFault (
+   const uint8_t* Address,
+   uint8_t        Fault,
+   uint16_t       Count
+);
+
+uint32_t EmuBusTime ();
+
+void EmuClearBusTime ();
+
+
+
+#endif   // PROBE_EMULATOR
@@ -0,0 +1,27 @@
+#ifndef SPI_H
+#define SPI_H
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------< SPI.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Stand-in for the SPI library on the host.  The sketch includes it but
+//          sends nothing over SPI.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+
+
+
+#endif   // SPI_H
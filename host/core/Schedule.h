@@ -0,0 +1,32 @@
+#ifndef SCHEDULE_H
+#define SCHEDULE_H
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< Schedule.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Functions scheduled to run after loop() returns, for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <functional>
+
+
+
+bool schedule_function (
+   const std::function< void ( void ) >& Function
+);
+
+
+
+#endif   // SCHEDULE_H
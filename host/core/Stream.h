@@ -0,0 +1,41 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< Stream.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The Arduino Stream class for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "Print.h"
+
+
+
+class Stream : public Print
+{
+   public:
+
+   virtual int available () { return 0; }
+   virtual int read () { return -1; }
+   virtual int peek () { return -1; }
+
+   size_t readBytes ( char* Buffer, size_t Length );
+   size_t readBytes ( uint8_t* Buffer, size_t Length ) { return readBytes ( (char*) Buffer, Length ); }
+   String readStringUntil ( char Terminator );
+};
+
+
+
+#endif   // STREAM_H
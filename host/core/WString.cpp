@@ -0,0 +1,247 @@
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< WString.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The Arduino String class for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <ctype.h>
+#include <strings.h>
+
+
+
+static std::string Number (
+   unsigned long Value,
+   unsigned char Base,
+   bool          Negative
+)
+{
+   char  Text[ 68 ];
+   char* Next = &Text[ sizeof ( Text ) - 1 ];
+
+   Base  = ( Base < 2 ) ? 10 : Base;
+   *Next = 0;
+
+   do
+   {
+      uint8_t Digit = Value % Base;
+
+      *--Next = ( Digit < 10 ) ? '0' + Digit : 'a' + Digit - 10;
+      Value  /= Base;
+   } while ( Value > 0 );
+
+   if ( Negative == true )
+   {
+      *--Next = '-';
+   }
+
+   return Next;
+}
+
+static std::string Decimal (
+   double         Value,
+   unsigned char  Places
+)
+{
+   char  Text[ 64 ];
+
+   snprintf ( Text, sizeof ( Text ), "%.*f", Places, Value );
+
+   return Text;
+}
+
+
+
+String::String ( const char* Text )                         : Text ( Text ? Text : "" ) {}
+String::String ( const String& Other )                      : Text ( Other.Text ) {}
+String::String ( const std::string& Text )                  : Text ( Text ) {}
+String::String ( char Value )                               : Text ( 1, Value ) {}
+String::String ( unsigned char Value, unsigned char Base )  : Text ( Number ( Value, Base, false ) ) {}
+String::String ( int Value, unsigned char Base )
+   : Text ( ( Base == 10 && Value < 0 ) ? Number ( - (long) Value, 10, true ) : Number ( (unsigned int) Value, Base, false ) ) {}
+String::String ( unsigned int Value, unsigned char Base )   : Text ( Number ( Value, Base, false ) ) {}
+String::String ( long Value, unsigned char Base )
+   : Text ( ( Base == 10 && Value < 0 ) ? Number ( - (unsigned long) Value, 10, true ) : Number ( (unsigned long) Value, Base, false ) ) {}
+String::String ( unsigned long Value, unsigned char Base )  : Text ( Number ( Value, Base, false ) ) {}
+String::String ( float Value, unsigned char Places )        : Text ( Decimal ( Value, Places ) ) {}
+String::String ( double Value, unsigned char Places )       : Text ( Decimal ( Value, Places ) ) {}
+
+String& String::operator= ( const String& Other )   { Text = Other.Text;          return *this; }
+String& String::operator= ( const char* Other )     { Text = Other ? Other : "";  return *this; }
+
+bool String::reserve ( unsigned int Size )          { Text.reserve ( Size ); return true; }
+unsigned int String::length () const                { return Text.length(); }
+const char* String::c_str () const                  { return Text.c_str(); }
+
+bool String::concat ( const String& Other )         { Text += Other.Text;                    return true; }
+bool String::concat ( const char* Other )           { Text += Other ? Other : "";            return Other != NULL; }
+bool String::concat ( char Value )                  { Text += Value;                         return true; }
+bool String::concat ( int Value )                   { Text += String ( Value ).Text;         return true; }
+bool String::concat ( unsigned int Value )          { Text += String ( Value ).Text;         return true; }
+bool String::concat ( long Value )                  { Text += String ( Value ).Text;         return true; }
+bool String::concat ( unsigned long Value )         { Text += String ( Value ).Text;         return true; }
+
+String operator+ ( const String& Left, const String& Right )  { String Sum ( Left ); Sum.concat ( Right ); return Sum; }
+String operator+ ( const String& Left, const char* Right )    { String Sum ( Left ); Sum.concat ( Right ); return Sum; }
+String operator+ ( const char* Left, const String& Right )    { String Sum ( Left ); Sum.concat ( Right ); return Sum; }
+String operator+ ( const String& Left, char Right )           { String Sum ( Left ); Sum.concat ( Right ); return Sum; }
+
+int String::compareTo ( const String& Other ) const           { return Text.compare ( Other.Text ); }
+bool String::equals ( const String& Other ) const             { return Text == Other.Text; }
+bool String::equals ( const char* Other ) const               { return Text == ( Other ? Other : "" ); }
+
+bool String::equalsIgnoreCase ( const String& Other ) const
+{
+   return Text.length() == Other.Text.length() && strcasecmp ( Text.c_str(), Other.Text.c_str() ) == 0;
+}
+
+bool String::startsWith ( const String& Prefix ) const
+{
+   return Text.compare ( 0, Prefix.Text.length(), Prefix.Text ) == 0;
+}
+
+bool String::endsWith ( const String& Suffix ) const
+{
+   return Text.length() >= Suffix.Text.length()
+       && Text.compare ( Text.length() - Suffix.Text.length(), Suffix.Text.length(), Suffix.Text ) == 0;
+}
+
+char String::charAt ( unsigned int Index ) const              { return ( Index < Text.length() ) ? Text[ Index ] : 0; }
+void String::setCharAt ( unsigned int Index, char Value )     { if ( Index < Text.length() ) Text[ Index ] = Value; }
+char String::operator[] ( unsigned int Index ) const          { return charAt ( Index ); }
+
+char& String::operator[] ( unsigned int Index )
+{
+   static char Dummy;
+
+   Dummy = 0;
+
+   return ( Index < Text.length() ) ? Text[ Index ] : Dummy;
+}
+
+void String::toCharArray ( char* Buffer, unsigned int Size, unsigned int Index ) const
+{
+   if ( Buffer != NULL && Size > 0 )
+   {
+      size_t Length = ( Index < Text.length() ) ? min ( (size_t) Size - 1, Text.length() - Index ) : 0;
+
+      memcpy ( Buffer, Text.c_str() + min ( (size_t) Index, Text.length() ), Length );
+      Buffer[ Length ] = 0;
+   }
+}
+
+int String::indexOf ( char Value, unsigned int From ) const
+{
+   size_t At = Text.find ( Value, From );
+
+   return ( At == std::string::npos ) ? -1 : (int) At;
+}
+
+int String::indexOf ( const String& Find, unsigned int From ) const
+{
+   size_t At = Text.find ( Find.Text, From );
+
+   return ( At == std::string::npos ) ? -1 : (int) At;
+}
+
+int String::lastIndexOf ( char Value ) const
+{
+   size_t At = Text.rfind ( Value );
+
+   return ( At == std::string::npos ) ? -1 : (int) At;
+}
+
+String String::substring ( unsigned int Left ) const
+{
+   return substring ( Left, Text.length() );
+}
+
+String String::substring ( unsigned int Left, unsigned int Right ) const
+{
+   if ( Left > Right )
+   {
+      std::swap ( Left, Right );
+   }
+
+   Right = min ( (size_t) Right, Text.length() );
+
+   return ( Left < Right ) ? String ( Text.substr ( Left, Right - Left ) ) : String();
+}
+
+void String::replace ( char Find, char With )
+{
+   std::replace ( Text.begin(), Text.end(), Find, With );
+}
+
+void String::replace ( const String& Find, const String& With )
+{
+   size_t At = 0;
+
+   if ( Find.Text.length() > 0 )
+   {
+      while ( ( At = Text.find ( Find.Text, At ) ) != std::string::npos )
+      {
+         Text.replace ( At, Find.Text.length(), With.Text );
+         At += With.Text.length();
+      }
+   }
+}
+
+void String::remove ( unsigned int Index )
+{
+   remove ( Index, Text.length() );
+}
+
+void String::remove ( unsigned int Index, unsigned int Count )
+{
+   if ( Index < Text.length() )
+   {
+      Text.erase ( Index, Count );
+   }
+}
+
+void String::toLowerCase ()
+{
+   for ( char& Each : Text )
+   {
+      Each = tolower ( (unsigned char) Each );
+   }
+}
+
+void String::toUpperCase ()
+{
+   for ( char& Each : Text )
+   {
+      Each = toupper ( (unsigned char) Each );
+   }
+}
+
+void String::trim ()
+{
+   size_t First = Text.find_first_not_of ( " \t\r\n\f\v" );
+   size_t Last  = Text.find_last_not_of ( " \t\r\n\f\v" );
+
+   Text = ( First == std::string::npos ) ? std::string() : Text.substr ( First, Last - First + 1 );
+}
+
+long String::toInt () const
+{
+   return atol ( Text.c_str() );
+}
+
+float String::toFloat () const
+{
+   return atof ( Text.c_str() );
+}
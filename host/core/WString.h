@@ -0,0 +1,116 @@
+#ifndef WSTRING_H
+#define WSTRING_H
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< WString.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The Arduino String class for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The text is kept in a std::string, which allocates with new, so
+//             the heap a String uses is counted the same as on the board.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <stdint.h>
+#include <string>
+
+
+
+class String
+{
+   public:
+
+   String ( const char* Text = "" );
+   String ( const String& Other );
+   String ( const std::string& Text );
+   explicit String ( char Value );
+   explicit String ( unsigned char Value, unsigned char Base = 10 );
+   explicit String ( int Value, unsigned char Base = 10 );
+   explicit String ( unsigned int Value, unsigned char Base = 10 );
+   explicit String ( long Value, unsigned char Base = 10 );
+   explicit String ( unsigned long Value, unsigned char Base = 10 );
+   explicit String ( float Value, unsigned char Places = 2 );
+   explicit String ( double Value, unsigned char Places = 2 );
+
+   String& operator= ( const String& Other );
+   String& operator= ( const char* Text );
+
+   bool reserve ( unsigned int Size );
+   unsigned int length () const;
+   const char* c_str () const;
+
+   bool concat ( const String& Text );
+   bool concat ( const char* Text );
+   bool concat ( char Value );
+   bool concat ( int Value );
+   bool concat ( unsigned int Value );
+   bool concat ( long Value );
+   bool concat ( unsigned long Value );
+
+   String& operator+= ( const String& Text )  { concat ( Text );  return *this; }
+   String& operator+= ( const char* Text )    { concat ( Text );  return *this; }
+   String& operator+= ( char Value )          { concat ( Value ); return *this; }
+   String& operator+= ( int Value )           { concat ( Value ); return *this; }
+   String& operator+= ( unsigned int Value )  { concat ( Value ); return *this; }
+   String& operator+= ( long Value )          { concat ( Value ); return *this; }
+   String& operator+= ( unsigned long Value ) { concat ( Value ); return *this; }
+
+   friend String operator+ ( const String& Left, const String& Right );
+   friend String operator+ ( const String& Left, const char* Right );
+   friend String operator+ ( const char* Left, const String& Right );
+   friend String operator+ ( const String& Left, char Right );
+
+   bool operator== ( const String& Other ) const  { return equals ( Other ); }
+   bool operator== ( const char* Other ) const    { return equals ( Other ); }
+   bool operator!= ( const String& Other ) const  { return ! equals ( Other ); }
+   bool operator!= ( const char* Other ) const    { return ! equals ( Other ); }
+
+   int compareTo ( const String& Other ) const;
+   bool equals ( const String& Other ) const;
+   bool equals ( const char* Other ) const;
+   bool equalsIgnoreCase ( const String& Other ) const;
+   bool startsWith ( const String& Prefix ) const;
+   bool endsWith ( const String& Suffix ) const;
+
+   char charAt ( unsigned int Index ) const;
+   void setCharAt ( unsigned int Index, char Value );
+   char operator[] ( unsigned int Index ) const;
+   char& operator[] ( unsigned int Index );
+   void toCharArray ( char* Buffer, unsigned int Size, unsigned int Index = 0 ) const;
+
+   int indexOf ( char Value, unsigned int From = 0 ) const;
+   int indexOf ( const String& Text, unsigned int From = 0 ) const;
+   int lastIndexOf ( char Value ) const;
+   String substring ( unsigned int Left ) const;
+   String substring ( unsigned int Left, unsigned int Right ) const;
+
+   void replace ( char Find, char With );
+   void replace ( const String& Find, const String& With );
+   void remove ( unsigned int Index );
+   void remove ( unsigned int Index, unsigned int Count );
+   void toLowerCase ();
+   void toUpperCase ();
+   void trim ();
+
+   long toInt () const;
+   float toFloat () const;
+
+   private:
+
+   std::string Text;
+};
+
+
+
+#endif   // WSTRING_H
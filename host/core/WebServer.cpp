@@ -0,0 +1,280 @@
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< WebServer.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The web server of the ESP8266 core for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  A request is handed straight to the handler registered for it by
+//             HostWebRequest(), rather than waiting for handleClient(), and
+//             what the handler sends is kept in the response given.
+//
+//          -  The time to the first byte is taken when the first byte of the
+//             body is sent, since the headers of a chunked response go out
+//             before any of the page is ready.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ESP8266WebServer.h>
+#include "HostCore.h"
+
+
+
+static ESP8266WebServer* Current = NULL;
+
+
+
+ESP8266WebServer::ESP8266WebServer ( int Port ) : Port ( Port )
+{
+}
+
+ESP8266WebServer::ESP8266WebServer ( IPAddress Address, int Port ) : Port ( Port )
+{
+}
+
+void ESP8266WebServer::begin ()
+{
+   Running = true;
+   Current = this;
+}
+
+void ESP8266WebServer::begin ( uint16_t NewPort )
+{
+   Port = NewPort;
+   begin();
+}
+
+void ESP8266WebServer::close ()
+{
+   Running = false;
+}
+
+void ESP8266WebServer::stop ()
+{
+   close();
+}
+
+void ESP8266WebServer::handleClient ()
+{
+}
+
+void ESP8266WebServer::on ( const String& Path, THandlerFunction Handler )
+{
+   on ( Path, HTTP_ANY, Handler );
+}
+
+void ESP8266WebServer::on ( const String& Path, HTTPMethod Kind, THandlerFunction Handler )
+{
+   on ( Path, Kind, Handler, NULL );
+}
+
+void ESP8266WebServer::on ( const String& Path, HTTPMethod Kind, THandlerFunction Handler, THandlerFunction UploadHandler )
+{
+   Routes.push_back ( { Path, Kind, Handler, UploadHandler } );
+}
+
+void ESP8266WebServer::onNotFound ( THandlerFunction Handler )
+{
+   NotFound = Handler;
+}
+
+String ESP8266WebServer::uri ()                       { return Uri; }
+HTTPMethod ESP8266WebServer::method ()                { return Method; }
+WiFiClient ESP8266WebServer::client ()                { return WiFiClient(); }
+HTTPUpload& ESP8266WebServer::upload ()               { return Upload; }
+int ESP8266WebServer::args ()                         { return ( Args != NULL ) ? Args->size() : 0; }
+
+String ESP8266WebServer::arg ( const String& Name )
+{
+   String   Value;
+
+   for ( int i = 0; i < args() && Value.length() == 0; i++ )
+   {
+      if ( ( *Args )[ i ].first == Name.c_str() )
+      {
+         Value = ( *Args )[ i ].second.c_str();
+      }
+   }
+
+   return Value;
+}
+
+String ESP8266WebServer::arg ( int Index )
+{
+   return ( Index >= 0 && Index < args() ) ? String ( ( *Args )[ Index ].second.c_str() ) : String();
+}
+
+String ESP8266WebServer::argName ( int Index )
+{
+   return ( Index >= 0 && Index < args() ) ? String ( ( *Args )[ Index ].first.c_str() ) : String();
+}
+
+bool ESP8266WebServer::hasArg ( const String& Name )
+{
+   bool  Found = false;
+
+   for ( int i = 0; i < args(); i++ )
+   {
+      Found = Found || ( *Args )[ i ].first == Name.c_str();
+   }
+
+   return Found;
+}
+
+void ESP8266WebServer::setContentLength ( size_t Length )
+{
+   ContentLength = Length;
+}
+
+void ESP8266WebServer::sendHeader ( const String& Name, const String& Value, bool First )
+{
+   HostHeapPause  Pause;
+
+   if ( Response != NULL )
+   {
+      Response->Headers.insert ( First ? Response->Headers.begin() : Response->Headers.end(),
+                                 { Name.c_str(), Value.c_str() } );
+   }
+}
+
+void ESP8266WebServer::send ( int Code, const char* ContentType, const String& Content )
+{
+   if ( Response != NULL )
+   {
+      HostHeapPause  Pause;
+
+      Response->Status      = Code;
+      Response->ContentType = ( ContentType != NULL ) ? ContentType : "";
+   }
+
+   Capture ( Content.c_str(), Content.length() );
+}
+
+void ESP8266WebServer::send ( int Code, char* ContentType, const String& Content )
+{
+   send ( Code, (const char*) ContentType, Content );
+}
+
+void ESP8266WebServer::send ( int Code, const String& ContentType, const String& Content )
+{
+   send ( Code, ContentType.c_str(), Content );
+}
+
+void ESP8266WebServer::sendContent ( const String& Content )
+{
+   Capture ( Content.c_str(), Content.length() );
+}
+
+void ESP8266WebServer::sendContent ( const char* Content, size_t Length )
+{
+   Capture ( Content, Length );
+}
+
+void ESP8266WebServer::Capture ( const char* Content, size_t Length )
+{
+   HostHeapPause  Pause;
+
+   if ( Response != NULL && Length > 0 )
+   {
+      if ( Response->Chunks == 0 )
+      {
+         Response->FirstByteNanos = HostNanos() - StartNanos;
+      }
+
+      Response->Body.append ( Content, Length );
+      Response->Chunks++;
+      Response->LargestChunk = max ( Response->LargestChunk, Length );
+   }
+}
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< HostWebRequest >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send a request to the web server that last had begin() called,
+//             as if a browser had sent it.
+//
+// PARAMETERS: Method - HTTP_GET, HTTP_POST, and so on.
+//
+//             Uri - The path asked for.
+//
+//             Args - The query or form arguments, name and value.
+//
+//             Response - Returns what the handler sent back.
+//
+// RETURNS:    bool - False if no web server is running.
+//
+// NOTES:      -  The first handler registered for the path and method is run,
+//                or the not found handler if there is none.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool HostWebRequest (
+   int            Method,
+   const char*    Uri,
+   const HArgs_t& Args,
+   HResponse_t*   Response
+)
+{
+   ESP8266WebServer*                   Server = Current;
+   ESP8266WebServer::THandlerFunction  Handler;
+
+   if ( Server != NULL && Server->Running == true )
+   {
+      {
+         HostHeapPause  Pause;
+
+         *Response = HResponse_t();
+         Server->Uri           = Uri;
+         Server->Method        = (HTTPMethod) Method;
+         Server->Args          = &Args;
+         Server->Response      = Response;
+         Server->ContentLength = CONTENT_LENGTH_NOT_SET;
+         Handler               = Server->NotFound;
+
+         for ( int i = Server->Routes.size() - 1; i >= 0; i-- )
+         {
+            if ( Server->Routes[ i ].Uri == Uri
+                 && ( Server->Routes[ i ].Method == HTTP_ANY || Server->Routes[ i ].Method == Method ) )
+            {
+               Handler = Server->Routes[ i ].Handler;
+            }
+         }
+      }
+
+      Server->StartNanos = HostNanos();
+
+      if ( Handler )
+      {
+         Handler();
+      }
+
+      else
+      {
+         Server->send ( 404, "text/plain", "Not found" );
+      }
+
+      Response->TotalNanos = HostNanos() - Server->StartNanos;
+      Server->Args         = NULL;
+      Server->Response     = NULL;
+   }
+
+   return Server != NULL && Server->Running == true;
+}
+
+// -------------------------------------------------------< /HostWebRequest >---
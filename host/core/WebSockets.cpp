@@ -0,0 +1,459 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< WebSockets.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Stand-in for the WebSocketsServer library on the host.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  A client connected by a test sends its handshake one header line
+//             per pass of loop(), as the library reads it, and is answered
+//             the way the library answers it.
+//
+//          -  Messages sent to a client are kept for the test to look at (see
+//             HostSocketFrames), and messages from a test are given to the
+//             event handler on the next pass of loop().
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <WebSocketsServer.h>
+#include "HostCore.h"
+
+
+
+static WebSocketsServer* Current = NULL;
+
+
+
+WebSocketsServer::WebSocketsServer ( uint16_t Port, String Origin, String Protocol )
+   : _port ( Port ), _origin ( Origin ), _protocol ( Protocol ), _runnning ( false )
+{
+   _server = new WEBSOCKETS_NETWORK_SERVER_CLASS ( Port );
+
+   for ( uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++ )
+   {
+      _clients[ i ].num    = i;
+      _clients[ i ].status = WSC_NOT_CONNECTED;
+      _clients[ i ].tcp    = NULL;
+      Blocked[ i ]         = 0;
+   }
+}
+
+WebSocketsServer::~WebSocketsServer ()
+{
+   delete _server;
+
+   if ( Current == this )
+   {
+      Current = NULL;
+   }
+}
+
+void WebSocketsServer::begin ()
+{
+   _server->begin();
+   _runnning = true;
+   Current   = this;
+}
+
+void WebSocketsServer::close ()
+{
+   _runnning = false;
+   disconnect();
+   _server->close();
+}
+
+void WebSocketsServer::onEvent ( WebSocketServerEvent Handler )
+{
+   Event = Handler;
+}
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------------< loop >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Read what each client has sent: one line of a handshake, or the
+//             messages waiting from a connected client.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void WebSocketsServer::loop ()
+{
+   for ( uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX && _runnning == true; i++ )
+   {
+      WSclient_t* Client = &_clients[ i ];
+
+      if ( Client->status == WSC_HEADER && Lines[ i ].size() > 0 )
+      {
+         std::string Line = Lines[ i ].front();
+
+         Lines[ i ].pop_front();
+         HandleHeader ( Client, Line );
+      }
+
+      else if ( Client->status == WSC_CONNECTED )
+      {
+         while ( Client->status == WSC_CONNECTED && Incoming[ i ].size() > 0 )
+         {
+            std::string Message = Incoming[ i ].front();
+
+            Incoming[ i ].pop_front();
+
+            if ( Event )
+            {
+               Event ( i, WStype_TEXT, (uint8_t*) &Message[ 0 ], Message.length() );
+            }
+         }
+      }
+   }
+}
+
+// -----------------------------------------------------------------< /loop >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< HandleHeader >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Take in one line of a client's handshake, and answer it once
+//             the blank line at the end comes.
+//
+// PARAMETERS: Client - The client the line came from.
+//
+//             Line - The header line, without its line end.
+//
+// RETURNS:    void
+//
+// NOTES:      -  As in the library, the answer names the server's protocol if
+//                the client's cProtocol is not empty when the handshake ends,
+//                whatever the client asked for.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void WebSocketsServer::HandleHeader (
+   WSclient_t*        Client,
+   const std::string& Line
+)
+{
+   size_t   Colon = Line.find ( ':' );
+
+   if ( Line.compare ( 0, 4, "GET " ) == 0 )
+   {
+      Client->cUrl = Line.substr ( 4, Line.rfind ( ' ' ) - 4 ).c_str();
+   }
+
+   else if ( Colon != std::string::npos )
+   {
+      std::string Name  = Line.substr ( 0, Colon );
+      std::string Value = Line.substr ( Line.find_first_not_of ( ' ', Colon + 1 ) );
+
+      if ( strcasecmp ( Name.c_str(), "Sec-WebSocket-Protocol" ) == 0 )
+      {
+         Client->cProtocol = Value.c_str();
+      }
+
+      else if ( strcasecmp ( Name.c_str(), "Sec-WebSocket-Key" ) == 0 )
+      {
+         Client->cKey = Value.c_str();
+      }
+   }
+
+   else if ( Line.empty() )
+   {
+      HostHeapPause  Pause;
+
+      Answered[ Client->num ] = ( Client->cProtocol.length() > 0 ) ? _protocol.c_str() : "";
+      Client->status          = WSC_CONNECTED;
+
+      if ( Event )
+      {
+         Event ( Client->num, WStype_CONNECTED, (uint8_t*) Client->cUrl.c_str(), Client->cUrl.length() );
+      }
+   }
+}
+
+// ---------------------------------------------------------< /HandleHeader >---
+
+
+
+bool WebSocketsServer::sendTXT ( uint8_t num, uint8_t* payload, size_t length, bool headerToPayload )
+{
+   return Send ( num, false, payload, ( length == 0 ) ? strlen ( (const char*) payload ) : length );
+}
+
+bool WebSocketsServer::sendTXT ( uint8_t num, const uint8_t* payload, size_t length )
+{
+   return sendTXT ( num, (uint8_t*) payload, length );
+}
+
+bool WebSocketsServer::sendTXT ( uint8_t num, char* payload, size_t length, bool headerToPayload )
+{
+   return sendTXT ( num, (uint8_t*) payload, length );
+}
+
+bool WebSocketsServer::sendTXT ( uint8_t num, const char* payload, size_t length )
+{
+   return sendTXT ( num, (uint8_t*) payload, length );
+}
+
+bool WebSocketsServer::sendTXT ( uint8_t num, String& payload )
+{
+   return sendTXT ( num, (uint8_t*) payload.c_str(), payload.length() );
+}
+
+bool WebSocketsServer::broadcastTXT ( const char* payload, size_t length )
+{
+   bool  Sent = true;
+
+   for ( uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++ )
+   {
+      if ( _clients[ i ].status == WSC_CONNECTED )
+      {
+         Sent = sendTXT ( i, payload, length ) && Sent;
+      }
+   }
+
+   return Sent;
+}
+
+bool WebSocketsServer::sendBIN ( uint8_t num, uint8_t* payload, size_t length, bool headerToPayload )
+{
+   return Send ( num, true, payload, length );
+}
+
+bool WebSocketsServer::sendBIN ( uint8_t num, const uint8_t* payload, size_t length )
+{
+   return Send ( num, true, payload, length );
+}
+
+bool WebSocketsServer::Send ( uint8_t num, bool Binary, const uint8_t* payload, size_t length )
+{
+   HostHeapPause  Pause;
+   bool           Sent = false;
+
+   if ( num < WEBSOCKETS_SERVER_CLIENT_MAX && _clients[ num ].status == WSC_CONNECTED )
+   {
+      size_t Header = ( length < 126 ) ? 2 : ( length < 65536 ) ? 4 : 10;
+
+      if ( Tcp[ num ].Writable < (int) ( Header + length ) )
+      {
+         Blocked[ num ]++;
+      }
+
+      Tcp[ num ].write ( payload, length );
+      Frames[ num ].push_back ( { Binary, std::string ( (const char*) payload, length ) } );
+      Sent = true;
+   }
+
+   return Sent;
+}
+
+void WebSocketsServer::disconnect ()
+{
+   for ( uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++ )
+   {
+      disconnect ( i );
+   }
+}
+
+void WebSocketsServer::disconnect ( uint8_t num )
+{
+   if ( num < WEBSOCKETS_SERVER_CLIENT_MAX && _clients[ num ].status != WSC_NOT_CONNECTED )
+   {
+      Disconnected ( num );
+   }
+}
+
+void WebSocketsServer::Disconnected ( uint8_t num )
+{
+   bool  WasConnected = ( _clients[ num ].status == WSC_CONNECTED );
+
+   _clients[ num ].status = WSC_NOT_CONNECTED;
+   _clients[ num ].tcp    = NULL;
+   _clients[ num ].cUrl   = "";
+   _clients[ num ].cProtocol = "";
+   Tcp[ num ].Connected   = false;
+   Lines[ num ].clear();
+   Incoming[ num ].clear();
+
+   if ( WasConnected == true && Event )
+   {
+      Event ( num, WStype_DISCONNECTED, NULL, 0 );
+   }
+}
+
+int WebSocketsServer::connectedClients ( bool ping )
+{
+   int   Count = 0;
+
+   for ( uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++ )
+   {
+      Count += ( _clients[ i ].status == WSC_CONNECTED );
+   }
+
+   return Count;
+}
+
+IPAddress WebSocketsServer::remoteIP ( uint8_t num )
+{
+   return ( num < WEBSOCKETS_SERVER_CLIENT_MAX && _clients[ num ].tcp != NULL )
+          ? _clients[ num ].tcp->remoteIP()
+          : IPAddress();
+}
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< HostSocketConnect >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Connect a client to the web socket server that last had begin()
+//             called.
+//
+// PARAMETERS: Url - The path the client asks for.
+//
+//             Protocols - The Sec-WebSocket-Protocol header the client sends,
+//                         or NULL to send none.
+//
+// RETURNS:    int - The client number, or -1 if every slot is in use.
+//
+// NOTES:      -  The client is connected once loop() has read its handshake,
+//                a line per pass.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+int HostSocketConnect (
+   const char* Url,
+   const char* Protocols
+)
+{
+   HostHeapPause  Pause;
+   int            Num = -1;
+
+   for ( uint8_t i = 0; Current != NULL && i < WEBSOCKETS_SERVER_CLIENT_MAX && Num < 0; i++ )
+   {
+      if ( Current->_clients[ i ].status == WSC_NOT_CONNECTED )
+      {
+         Num = i;
+      }
+   }
+
+   if ( Num >= 0 )
+   {
+      WSclient_t* Client = &Current->_clients[ Num ];
+
+      Current->Tcp[ Num ]       = WiFiClient();
+      Current->Tcp[ Num ].Connected = true;
+      Current->Frames[ Num ].clear();
+      Current->Answered[ Num ].clear();
+      Current->Blocked[ Num ]   = 0;
+      Client->status            = WSC_HEADER;
+      Client->tcp               = &Current->Tcp[ Num ];
+      Client->cUrl              = "";
+      Client->cProtocol         = "";
+
+      Current->Lines[ Num ] = { std::string ( "GET " ) + Url + " HTTP/1.1",
+                                "Host: 192.168.1.50",
+                                "Upgrade: websocket",
+                                "Connection: Upgrade",
+                                "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==" };
+
+      if ( Protocols != NULL )
+      {
+         Current->Lines[ Num ].push_back ( std::string ( "Sec-WebSocket-Protocol: " ) + Protocols );
+      }
+
+      Current->Lines[ Num ].push_back ( "Sec-WebSocket-Version: 13" );
+      Current->Lines[ Num ].push_back ( "" );
+   }
+
+   return Num;
+}
+
+// ----------------------------------------------------< /HostSocketConnect >---
+
+
+
+void HostSocketText (
+   uint8_t     Num,
+   const char* Text
+)
+{
+   HostHeapPause  Pause;
+
+   if ( Current != NULL && Num < WEBSOCKETS_SERVER_CLIENT_MAX )
+   {
+      Current->Incoming[ Num ].push_back ( Text );
+   }
+}
+
+void HostSocketDisconnect (
+   uint8_t  Num
+)
+{
+   if ( Current != NULL )
+   {
+      Current->disconnect ( Num );
+   }
+}
+
+void HostSocketSetWritable (
+   uint8_t  Num,
+   int      Bytes
+)
+{
+   if ( Current != NULL && Num < WEBSOCKETS_SERVER_CLIENT_MAX )
+   {
+      Current->Tcp[ Num ].Writable = Bytes;
+   }
+}
+
+std::string HostSocketProtocol (
+   uint8_t  Num
+)
+{
+   return ( Current != NULL && Num < WEBSOCKETS_SERVER_CLIENT_MAX ) ? Current->Answered[ Num ] : "";
+}
+
+std::vector< HFrame_t >& HostSocketFrames (
+   uint8_t  Num
+)
+{
+   static std::vector< HFrame_t > None;
+
+   return ( Current != NULL && Num < WEBSOCKETS_SERVER_CLIENT_MAX ) ? Current->Frames[ Num ] : None;
+}
+
+uint32_t HostSocketBlocked (
+   uint8_t  Num
+)
+{
+   return ( Current != NULL && Num < WEBSOCKETS_SERVER_CLIENT_MAX ) ? Current->Blocked[ Num ] : 0;
+}
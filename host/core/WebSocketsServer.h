@@ -0,0 +1,147 @@
+#ifndef WEB_SOCKETS_SERVER_H
+#define WEB_SOCKETS_SERVER_H
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------< WebSocketsServer.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Stand-in for the WebSocketsServer library on the host.  Clients come
+//          from the tests (see HostSocketConnect) instead of the network.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  As in the library, a client's handshake is read one header line per
+//             pass of loop(), and the subprotocol header is answered with the
+//             server's protocol if the client sent one at all.
+//
+//          -  A message sent while the client's TCP send buffer has no room for it
+//             is counted as blocked, as the library would have waited for the
+//             client there (see HostSocketBlocked).
+//
+//          -  Stands in for version 2.3.6, the one the sketch is pinned to,
+//             with the members of its client table that the sketch uses.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Library version.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ESP8266WiFi.h>
+#include <deque>
+#include <string>
+#include <vector>
+#include "HostCore.h"
+
+
+
+#define WEBSOCKETS_VERSION                "2.3.6"
+#define WEBSOCKETS_VERSION_INT            2003006
+
+#define WEBSOCKETS_SERVER_CLIENT_MAX      5
+#define WEBSOCKETS_NETWORK_CLASS          WiFiClient
+#define WEBSOCKETS_NETWORK_SERVER_CLASS   WiFiServer
+
+typedef enum
+{
+   WStype_ERROR,
+   WStype_DISCONNECTED,
+   WStype_CONNECTED,
+   WStype_TEXT,
+   WStype_BIN,
+   WStype_FRAGMENT_TEXT_START,
+   WStype_FRAGMENT_BIN_START,
+   WStype_FRAGMENT,
+   WStype_FRAGMENT_FIN,
+   WStype_PING,
+   WStype_PONG
+} WStype_t;
+
+typedef enum
+{
+   WSC_NOT_CONNECTED,
+   WSC_HEADER,
+   WSC_BODY,
+   WSC_CONNECTED
+} WSclientsStatus_t;
+
+typedef struct
+{
+   uint8_t                   num;
+   WSclientsStatus_t         status;
+   WEBSOCKETS_NETWORK_CLASS* tcp;
+   String                    cUrl;
+   String                    cProtocol;
+   String                    cKey;
+} WSclient_t;
+
+
+
+class WebSocketsServer
+{
+   public:
+
+   typedef std::function< void ( uint8_t num, WStype_t type, uint8_t* payload, size_t length ) > WebSocketServerEvent;
+
+   WebSocketsServer ( uint16_t Port, String Origin = "", String Protocol = "arduino" );
+   virtual ~WebSocketsServer ();
+
+   void begin ();
+   void close ();
+   void loop ();
+   void onEvent ( WebSocketServerEvent Event );
+
+   bool sendTXT ( uint8_t num, uint8_t* payload, size_t length = 0, bool headerToPayload = false );
+   bool sendTXT ( uint8_t num, const uint8_t* payload, size_t length = 0 );
+   bool sendTXT ( uint8_t num, char* payload, size_t length = 0, bool headerToPayload = false );
+   bool sendTXT ( uint8_t num, const char* payload, size_t length = 0 );
+   bool sendTXT ( uint8_t num, String& payload );
+   bool broadcastTXT ( const char* payload, size_t length = 0 );
+   bool sendBIN ( uint8_t num, uint8_t* payload, size_t length, bool headerToPayload = false );
+   bool sendBIN ( uint8_t num, const uint8_t* payload, size_t length );
+
+   void disconnect ();
+   void disconnect ( uint8_t num );
+   int connectedClients ( bool ping = false );
+   IPAddress remoteIP ( uint8_t num );
+
+   protected:
+
+   uint16_t                         _port;
+   String                           _origin;
+   String                           _protocol;
+   WEBSOCKETS_NETWORK_SERVER_CLASS* _server;
+   WSclient_t                       _clients[ WEBSOCKETS_SERVER_CLIENT_MAX ];
+   bool                             _runnning;
+
+   private:
+
+   bool Send ( uint8_t num, bool Binary, const uint8_t* payload, size_t length );
+   void Disconnected ( uint8_t num );
+   void HandleHeader ( WSclient_t* Client, const std::string& Line );
+
+   friend int HostSocketConnect ( const char*, const char* );
+   friend void HostSocketText ( uint8_t, const char* );
+   friend void HostSocketDisconnect ( uint8_t );
+   friend void HostSocketSetWritable ( uint8_t, int );
+   friend std::string HostSocketProtocol ( uint8_t );
+   friend std::vector< HFrame_t >& HostSocketFrames ( uint8_t );
+   friend uint32_t HostSocketBlocked ( uint8_t );
+
+   WebSocketServerEvent       Event;
+   WiFiClient                 Tcp[ WEBSOCKETS_SERVER_CLIENT_MAX ];
+   std::deque< std::string >  Lines[ WEBSOCKETS_SERVER_CLIENT_MAX ];
+   std::deque< std::string >  Incoming[ WEBSOCKETS_SERVER_CLIENT_MAX ];
+   std::vector< HFrame_t >    Frames[ WEBSOCKETS_SERVER_CLIENT_MAX ];
+   std::string                Answered[ WEBSOCKETS_SERVER_CLIENT_MAX ];
+   uint32_t                   Blocked[ WEBSOCKETS_SERVER_CLIENT_MAX ];
+};
+
+
+
+#endif   // WEB_SOCKETS_SERVER_H
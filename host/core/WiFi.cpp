@@ -0,0 +1,218 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< WiFi.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Wifi, IP addresses, TCP connections, and SSDP for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The station always connects, with a fixed address, unless a test
+//             says otherwise with HostSetWifiStatus().  A scan finds the
+//             networks given to HostSetNetworks(), none by default.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ESP8266WiFi.h>
+#include <ESP8266SSDP.h>
+#include <vector>
+#include "HostCore.h"
+
+
+
+// The most networks a scan can find.
+#define HOST_NETWORK_MAX        16
+
+
+
+ESP8266WiFiClass  WiFi;
+SSDPClass         SSDP;
+
+static uint8_t     Status = WL_CONNECTED;
+static WiFiMode_t  Mode = WIFI_OFF;
+static char        StationSSID[ 33 ];
+static IPAddress   AccessIP ( 192, 168, 4, 1 );
+static HNetwork_t  Networks[ HOST_NETWORK_MAX ];
+static uint8_t     NetworkCount = 0;
+
+
+
+IPAddress::IPAddress ()                                    : Bytes { 0, 0, 0, 0 } {}
+IPAddress::IPAddress ( uint8_t A, uint8_t B, uint8_t C, uint8_t D ) : Bytes { A, B, C, D } {}
+IPAddress::IPAddress ( const uint8_t* Address )            { memcpy ( Bytes, Address, 4 ); }
+IPAddress::IPAddress ( uint32_t Address )                  { memcpy ( Bytes, &Address, 4 ); }
+
+IPAddress::operator uint32_t () const
+{
+   uint32_t Address;
+
+   memcpy ( &Address, Bytes, 4 );
+
+   return Address;
+}
+
+bool IPAddress::operator== ( const IPAddress& Other ) const
+{
+   return memcmp ( Bytes, Other.Bytes, 4 ) == 0;
+}
+
+size_t IPAddress::printTo ( Print& Out ) const
+{
+   return Out.print ( toString() );
+}
+
+String IPAddress::toString () const
+{
+   char  Text[ 16 ];
+
+   sprintf ( Text, "%u.%u.%u.%u", Bytes[ 0 ], Bytes[ 1 ], Bytes[ 2 ], Bytes[ 3 ] );
+
+   return String ( Text );
+}
+
+
+
+size_t WiFiClient::write ( uint8_t Value )
+{
+   return write ( &Value, 1 );
+}
+
+size_t WiFiClient::write ( const uint8_t* Buffer, size_t Size )
+{
+   Written += Size;
+
+   return Size;
+}
+
+int WiFiClient::availableForWrite ()          { return Writable; }
+uint8_t WiFiClient::connected ()              { return Connected; }
+IPAddress WiFiClient::remoteIP ()             { return Remote; }
+void WiFiClient::setNoDelay ( bool NoDelay )  {}
+void WiFiClient::stop ()                      { Connected = false; }
+
+WiFiServer::WiFiServer ( uint16_t Port ) : Port ( Port ) {}
+void WiFiServer::begin ()                     {}
+void WiFiServer::begin ( uint16_t NewPort )   { Port = NewPort; }
+void WiFiServer::close ()                     {}
+void WiFiServer::stop ()                      {}
+
+
+
+bool ESP8266WiFiClass::mode ( WiFiMode_t NewMode )
+{
+   Mode = NewMode;
+
+   return true;
+}
+
+WiFiMode_t ESP8266WiFiClass::getMode ()                   { return Mode; }
+bool ESP8266WiFiClass::hostname ( const char* Name )      { return Name != NULL; }
+
+wl_status_t ESP8266WiFiClass::begin ( const char* SSID, const char* Password )
+{
+   strncpy ( StationSSID, SSID ? SSID : "", sizeof ( StationSSID ) - 1 );
+
+   return (wl_status_t) Status;
+}
+
+uint8_t ESP8266WiFiClass::waitForConnectResult ()
+{
+   // Connecting takes a few seconds on the board.
+   delay ( 3000 );
+
+   return Status;
+}
+
+wl_status_t ESP8266WiFiClass::status ()                   { return (wl_status_t) Status; }
+bool ESP8266WiFiClass::disconnect ( bool WifiOff )        { return true; }
+IPAddress ESP8266WiFiClass::localIP ()                    { return IPAddress ( 192, 168, 1, 50 ); }
+IPAddress ESP8266WiFiClass::subnetMask ()                 { return IPAddress ( 255, 255, 255, 0 ); }
+IPAddress ESP8266WiFiClass::gatewayIP ()                  { return IPAddress ( 192, 168, 1, 1 ); }
+String ESP8266WiFiClass::SSID () const                    { return String ( StationSSID ); }
+
+bool ESP8266WiFiClass::softAPConfig ( IPAddress Local, IPAddress Gateway, IPAddress Subnet )
+{
+   AccessIP = Local;
+
+   return true;
+}
+
+bool ESP8266WiFiClass::softAP ( const char* SSID, const char* Password ) { return SSID != NULL; }
+IPAddress ESP8266WiFiClass::softAPIP ()                   { return AccessIP; }
+
+int8_t ESP8266WiFiClass::scanNetworks ( bool Async, bool Hidden )
+{
+   // A scan takes a couple of seconds on the board.
+   delay ( 2000 );
+
+   return NetworkCount;
+}
+
+void ESP8266WiFiClass::scanDelete ()                      {}
+
+String ESP8266WiFiClass::SSID ( uint8_t Index )
+{
+   return String ( ( Index < NetworkCount ) ? Networks[ Index ].SSID : "" );
+}
+
+int32_t ESP8266WiFiClass::channel ( uint8_t Index )
+{
+   return ( Index < NetworkCount ) ? Networks[ Index ].Channel : 0;
+}
+
+int32_t ESP8266WiFiClass::RSSI ( uint8_t Index )
+{
+   return ( Index < NetworkCount ) ? Networks[ Index ].RSSI : 0;
+}
+
+uint8_t ESP8266WiFiClass::encryptionType ( uint8_t Index )
+{
+   return ( Index < NetworkCount ) ? Networks[ Index ].Encryption : 0;
+}
+
+void HostSetWifiStatus (
+   uint8_t  NewStatus
+)
+{
+   Status = NewStatus;
+}
+
+void HostSetNetworks (
+   const HNetwork_t* List,
+   uint8_t           Count
+)
+{
+   NetworkCount = min ( Count, (uint8_t) HOST_NETWORK_MAX );
+   memcpy ( Networks, List, NetworkCount * sizeof ( HNetwork_t ) );
+}
+
+
+
+bool SSDPClass::begin ()                                    { Running = true; return true; }
+void SSDPClass::end ()                                      { Running = false; }
+void SSDPClass::setDeviceType ( const char* Value )         { strncpy ( DeviceType, Value, sizeof ( DeviceType ) - 1 ); }
+void SSDPClass::setName ( const char* Value )               { strncpy ( Name, Value, sizeof ( Name ) - 1 ); }
+void SSDPClass::setUUID ( const char* Value )               { strncpy ( UUID, Value, sizeof ( UUID ) - 1 ); }
+void SSDPClass::setHTTPPort ( uint16_t Value )              { Port = Value; }
+void SSDPClass::setURL ( const char* Value )                {}
+void SSDPClass::setSchemaURL ( const char* Value )          {}
+void SSDPClass::setSerialNumber ( const char* Value )       {}
+void SSDPClass::setModelName ( const char* Value )          {}
+void SSDPClass::setModelNumber ( const char* Value )        {}
+void SSDPClass::setModelURL ( const char* Value )           {}
+void SSDPClass::setManufacturer ( const char* Value )       {}
+void SSDPClass::setManufacturerURL ( const char* Value )    {}
+
+void SSDPClass::schema ( WiFiClient Client )
+{
+   Client.printf ( "<?xml version=\"1.0\"?><root><device><deviceType>%s</deviceType>"
+                   "<friendlyName>%s</friendlyName><UDN>uuid:%s</UDN></device></root>\r\n",
+                   DeviceType, Name, UUID );
+}
@@ -0,0 +1,74 @@
+#ifndef WIFI_CLIENT_H
+#define WIFI_CLIENT_H
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< WiFiClient.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: TCP connections for the host build.  Nothing is sent anywhere; the
+//          space left in the send buffer can be set to see how the sketch copes
+//          with a slow client (see HostSocketSetWritable).
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+
+
+// Bytes the send buffer of a new connection has room for.
+#define HOST_TCP_SEND_BUFFER    2920
+
+
+
+class WiFiClient : public Stream
+{
+   public:
+
+   size_t write ( uint8_t Value ) override;
+   size_t write ( const uint8_t* Buffer, size_t Size ) override;
+   using Print::write;
+
+   int availableForWrite ();
+   uint8_t connected ();
+   IPAddress remoteIP ();
+   void setNoDelay ( bool NoDelay );
+   void stop ();
+
+   int       Writable = HOST_TCP_SEND_BUFFER;
+   uint32_t  Written  = 0;
+   IPAddress Remote   = IPAddress ( 192, 168, 1, 100 );
+   bool      Connected = false;
+};
+
+
+
+class WiFiServer
+{
+   public:
+
+   WiFiServer ( uint16_t Port );
+   void begin ();
+   void begin ( uint16_t Port );
+   void close ();
+   void stop ();
+   uint16_t port () const { return Port; }
+
+   private:
+
+   uint16_t Port;
+};
+
+
+
+#endif   // WIFI_CLIENT_H
@@ -0,0 +1,27 @@
+#ifndef WIFI_UDP_H
+#define WIFI_UDP_H
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< WiFiUdp.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Stand-in for the UDP library on the host.  Only the over the air
+//          updates use it, inside ArduinoOTA.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+
+
+
+#endif   // WIFI_UDP_H
@@ -0,0 +1,72 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< Wire.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The I2C bus for the host build.  Every transmission goes to the
+//          emulated SSD1306 panel (see PanelEmulator.cpp), which counts them
+//          all and takes the ones sent to its address.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Transmissions go to the emulated panel.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Wire.h>
+#include "PanelEmulator.h"
+
+
+
+TwoWire Wire;
+
+
+
+void TwoWire::begin ()
+{
+   Length = 0;
+}
+
+void TwoWire::begin ( int Sda, int Scl )
+{
+   begin();
+}
+
+void TwoWire::setClock ( uint32_t Frequency )
+{
+   Clock = Frequency;
+}
+
+void TwoWire::beginTransmission ( uint8_t NewAddress )
+{
+   Address = NewAddress;
+   Length  = 0;
+}
+
+size_t TwoWire::write ( uint8_t Value )
+{
+   return write ( &Value, 1 );
+}
+
+size_t TwoWire::write ( const uint8_t* Data, size_t Size )
+{
+   Size = min ( Size, BUFFER_LENGTH - Length );
+   memcpy ( Buffer + Length, Data, Size );
+   Length += Size;
+
+   return Size;
+}
+
+uint8_t TwoWire::endTransmission ( uint8_t Stop )
+{
+   PanelReceive ( Address, Buffer, Length, Clock );
+   Length = 0;
+
+   return 0;
+}
@@ -0,0 +1,57 @@
+#ifndef WIRE_H
+#define WIRE_H
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------------< Wire.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: The two wire (I2C) interface for the host build.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+
+
+
+// Bytes the I2C buffer holds, as in the ESP8266 core.
+#define BUFFER_LENGTH           128
+
+
+
+class TwoWire : public Stream
+{
+   public:
+
+   void begin ();
+   void begin ( int Sda, int Scl );
+   void setClock ( uint32_t Frequency );
+   void beginTransmission ( uint8_t Address );
+   uint8_t endTransmission ( uint8_t Stop = true );
+   size_t write ( uint8_t Value ) override;
+   size_t write ( const uint8_t* Buffer, size_t Size ) override;
+   using Print::write;
+
+   uint32_t Clock = 100000;
+
+   private:
+
+   uint8_t  Address;
+   uint8_t  Buffer[ BUFFER_LENGTH ];
+   size_t   Length;
+};
+
+extern TwoWire Wire;
+
+
+
+#endif   // WIRE_H
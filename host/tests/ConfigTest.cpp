@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< ConfigTest.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Start the sketch on a board set up by software older than the
+//          settings kept in the former spare bytes of the configuration, and
+//          check that what is left there is only used if it is valid.  Then
+//          change the label on the configuration page, which needs no
+//          restart.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Label changed without a restart.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ESP8266WebServer.h>
+#include "HostTest.h"
+
+
+
+extern PConfig_t  ConfigData;
+
+
+
+int main ()
+{
+   PConfig_t   Stored;
+   uint32_t    WaitMin = 10 * 1000;
+   uint32_t    WaitMax = 120 * 1000;
+   std::string Label ( PCONFIG_MAX_LABEL, 'L' );
+   HResponse_t Response;
+   int         Client;
+
+   HostTestBegin();
+   HostTestConfig ( 0, CONFIG_TEMP_PROBE_CONNECTED );
+
+   // Flash that was never written reads as 0xFF, except for wait limits that
+   // happen to be good ones.
+   memset ( EEPROM.Flash + PCONFIG_OFFSET_TEMPHYSTERESIS, 0xFF,
+            sizeof ( PConfig_t ) - PCONFIG_OFFSET_TEMPHYSTERESIS );
+   memcpy ( EEPROM.Flash + PCONFIG_OFFSET_SENSORWAITMIN, &WaitMin, sizeof ( WaitMin ) );
+   memcpy ( EEPROM.Flash + PCONFIG_OFFSET_SENSORWAITMAX, &WaitMax, sizeof ( WaitMax ) );
+
+   setup();
+
+   HOST_CHECK ( ConfigData.Version == PCONFIG_VERSION );
+   HOST_CHECK ( ConfigData.SensorWaitMin == WaitMin );
+   HOST_CHECK ( ConfigData.SensorWaitMax == WaitMax );
+   HOST_CHECK ( ConfigData.TempHysteresis == 0 );
+   HOST_CHECK ( ConfigData.RelayMinOnTime == 0 );
+   HOST_CHECK ( ConfigData.RelayMinOffTime == 0 );
+   HOST_CHECK ( HostSerialText().find ( "hysteresis 255 is not valid" ) != std::string::npos );
+   HOST_CHECK ( HostSerialText().find ( "wait limits" ) == std::string::npos );
+
+   // What was put right is stored, so the next start finds it good.
+   memcpy ( &Stored, EEPROM.Flash + PCONFIG_OFFSET, sizeof ( Stored ) );
+
+   HOST_CHECK ( Stored.TempHysteresis == 0 );
+   HOST_CHECK ( Stored.RelayMinOnTime == 0 );
+   HOST_CHECK ( Stored.RelayMinOffTime == 0 );
+   HOST_CHECK ( CheckROMValues ( &Stored ) == false );
+
+   // Limits that could not have come from the configuration page.
+   Stored.SensorWaitMin = 0xFFFFFFFF;
+   HOST_CHECK ( CheckROMValues ( &Stored ) == true );
+   HOST_CHECK ( Stored.SensorWaitMin == 0 && Stored.SensorWaitMax == 0 );
+
+   Stored.SensorWaitMin = 30 * 1000;
+   Stored.SensorWaitMax = 20 * 1000;
+   HOST_CHECK ( CheckROMValues ( &Stored ) == true );
+
+   Stored.SensorWaitMin = 20 * 1000 + 1;
+   Stored.SensorWaitMax = 30 * 1000;
+   HOST_CHECK ( CheckROMValues ( &Stored ) == true );
+
+   // And the sketch runs on with them.
+   HostRun ( 10ULL * 60 * 1000000 );
+   HOST_CHECK ( HostRestarts() == 0 );
+
+   // The longest label is used whole from the next reading, with the
+   // client sent to the success page rather than a restart.
+   Client = HostSocketConnect ( "/", NULL );
+   HostRun ( 1000 );
+
+   HOST_CHECK ( HostWebRequest ( HTTP_POST, "/SensorConfig.html", { { "sensor_label", Label } }, &Response ) );
+   HOST_CHECK ( Response.Status == 303 );
+   HOST_CHECK ( ConfigData.LabelLength == PCONFIG_MAX_LABEL );
+   HOST_CHECK ( Label == ConfigData.Label );
+
+   memcpy ( &Stored, EEPROM.Flash + PCONFIG_OFFSET, sizeof ( Stored ) );
+   HOST_CHECK ( Label == Stored.Label );
+
+   HostSocketFrames ( Client ).clear();
+   HostRun ( 2ULL * ConfigData.SensorWaitTime * 1000 );
+   HOST_CHECK ( HostRestarts() == 0 );
+   HOST_CHECK (  HostSocketFrames ( Client ).empty() == false
+              && HostSocketFrames ( Client ).back().Data.find ( "\"" + Label + "\"" ) != std::string::npos );
+
+   return HostTestResult();
+}
@@ -0,0 +1,109 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------< DisplayBenchmark.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Measure the cost of clearing a line of text one pixel row at a time
+//          and with DisplayClearRect().
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The band is the 14 rows ClearLine() clears for the size 2
+//             temperature text at row 23, which starts and ends part way
+//             through a page.  The row loop is the way ClearLine() used to do
+//             it.
+//
+//          -  Both ways are also checked to leave the same frame buffer behind,
+//             starting from a screen full of a pattern, so a bit cleared or
+//             kept by mistake shows up.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <string.h>
+#include "DisplayControl.h"
+#include "HostTest.h"
+
+
+
+#define BENCHMARK_PASSES        100000
+#define BENCHMARK_TOP           23
+#define BENCHMARK_HEIGHT        14
+
+
+
+//
+// Fill the frame buffer with a pattern that differs from one byte to the next.
+//
+static void PatternFill (
+   Adafruit_SSD1306* Screen
+)
+{
+   uint8_t* Buffer = Screen->getBuffer();
+
+   for ( int i = 0; i < DISPLAY_WIDTH * DISPLAY_HEIGHT / 8; i++ )
+   {
+      Buffer[ i ] = (uint8_t) ( i * 37 + 11 );
+   }
+}
+
+
+
+int main ()
+{
+   Adafruit_SSD1306  Screen ( DISPLAY_WIDTH, DISPLAY_HEIGHT );
+   uint8_t           ByRow[ DISPLAY_WIDTH * DISPLAY_HEIGHT / 8 ];
+   uint64_t          Start;
+   uint64_t          RowNanos;
+   uint64_t          RectNanos;
+
+   HostTestBegin();
+   Screen.begin ( SSD1306_SWITCHCAPVCC, 0x3C );
+
+   PatternFill ( &Screen );
+
+   for ( int Row = BENCHMARK_TOP; Row < BENCHMARK_TOP + BENCHMARK_HEIGHT; Row++ )
+   {
+      Screen.drawFastHLine ( 0, Row, DISPLAY_WIDTH, BLACK );
+   }
+
+   memcpy ( ByRow, Screen.getBuffer(), sizeof ( ByRow ) );
+
+   PatternFill ( &Screen );
+   DisplayClearRect ( &Screen, 0, BENCHMARK_TOP, DISPLAY_WIDTH, BENCHMARK_HEIGHT );
+
+   HOST_CHECK ( memcmp ( ByRow, Screen.getBuffer(), sizeof ( ByRow ) ) == 0 );
+
+   Start = HostNanos();
+
+   for ( int i = 0; i < BENCHMARK_PASSES; i++ )
+   {
+      for ( int Row = BENCHMARK_TOP; Row < BENCHMARK_TOP + BENCHMARK_HEIGHT; Row++ )
+      {
+         Screen.drawFastHLine ( 0, Row, DISPLAY_WIDTH, BLACK );
+      }
+   }
+
+   RowNanos = HostNanos() - Start;
+   Start    = HostNanos();
+
+   for ( int i = 0; i < BENCHMARK_PASSES; i++ )
+   {
+      DisplayClearRect ( &Screen, 0, BENCHMARK_TOP, DISPLAY_WIDTH, BENCHMARK_HEIGHT );
+   }
+
+   RectNanos = HostNanos() - Start;
+
+   printf ( "Nanoseconds per line clear, by row %.1f  by page %.1f \n",
+            (double) RowNanos / BENCHMARK_PASSES,
+            (double) RectNanos / BENCHMARK_PASSES
+          );
+
+   return HostTestResult();
+}
@@ -0,0 +1,139 @@
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< DisplayTest.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Run the sketch with an emulated SSD1306 panel on the I2C bus, and
+//          check each screen it shows against a stored image, built only from
+//          what was sent over the bus.  Also report what each update costs on
+//          the bus next to sending the whole frame buffer.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  After "make golden" look over the images in tests/golden (any
+//             viewer that reads PBM will do) before committing them.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ArduinoOTA.h>
+#include <ESP8266WebServer.h>
+#include "DisplayControl.h"
+#include "PanelEmulator.h"
+#include "ProbeEmulator.h"
+#include "TempProbe.h"
+#include "HostTest.h"
+
+
+
+extern PConfig_t        ConfigData;
+extern Adafruit_SSD1306 Screen;
+
+void ClearLine (
+  Adafruit_SSD1306* Screen,
+  uint8_t           TopRow,
+  uint8_t           TextSize
+);
+
+
+
+//
+// Report the bus traffic since the last report.
+//
+static void Report (
+   const char* Name
+)
+{
+   uint32_t Bytes         = PanelBusBytes();
+   uint32_t Transmissions = PanelBusTransmissions();
+
+   printf ( "%-12s %6u %6u %8u %8u\n",
+            Name,
+            Bytes,
+            Transmissions,
+            DisplayBusMicros ( Bytes, Transmissions, 100000 ),
+            DisplayBusMicros ( Bytes, Transmissions, 400000 )
+          );
+
+   PanelClearBus();
+}
+
+//
+// Check that the panel shows the frame buffer and the stored image.
+//
+static void CheckScreen (
+   const char* Name
+)
+{
+   HOST_CHECK ( memcmp ( PanelRAM(), Screen.getBuffer(), PANEL_RAM_SIZE ) == 0 );
+   HOST_CHECK ( HostGolden ( Name, PanelImage() ) );
+   Report ( Name );
+}
+
+
+
+int main ()
+{
+   HResponse_t Response;
+
+   HostTestBegin();
+
+   EmuBegin ( 1 );
+   EmuSetTemperature ( 0, 21 * FIXED_ONE + FIXED_ONE / 2 );
+   setup();
+
+   printf ( "%-12s %6s %6s %8s %8s\n", "Screen", "Bytes", "Sends", "100kHz", "400kHz" );
+
+   HOST_CHECK ( PanelOn() );
+   CheckScreen ( "Starting" );
+
+   HostRun ( ConfigData.SensorWaitTime * 1000 );
+   CheckScreen ( "Reading" );
+
+   // The sketch's own picture of the screen is what the panel shows.
+   HOST_CHECK ( HostWebRequest ( HTTP_GET, "/Screen.pbm", {}, &Response ) );
+   HOST_CHECK ( Response.Body == PanelImage() );
+
+   // The same reading again only adds a point to the trend graph.
+   HostRun ( ConfigData.SensorWaitTime * 1000 );
+   HOST_CHECK ( PanelBusBytes() > 0 && PanelBusBytes() < DisplayFullBytes() / 50 );
+   CheckScreen ( "Again" );
+
+   // What a flush sends is what the sketch counts.
+   ClearLine ( &Screen, 23, 2 );
+   DisplayFlush ( &Screen );
+   HOST_CHECK ( PanelBusBytes() == DisplayStats.LastBytes );
+   HOST_CHECK ( PanelBusTransmissions() == DisplayStats.LastTransmissions );
+   CheckScreen ( "ClearLine" );
+
+   HOST_CHECK ( EmuFault ( ProbeAddress[ 0 ], EMU_FAULT_NO_REPLY, 1000 ) );
+   HostRun ( 2 * ConfigData.SensorWaitMax * 1000 );
+   CheckScreen ( "Fault" );
+
+   HostOTAStart();
+   CheckScreen ( "Updating" );
+
+   HostOTAProgress ( 196608, 393216 );
+   CheckScreen ( "Progress" );
+
+   HostOTAError ( OTA_RECEIVE_ERROR );
+   CheckScreen ( "UpdateError" );
+
+   HostOTAEnd();
+   CheckScreen ( "Finished" );
+
+   // The whole frame buffer, as the library sends it, for comparison.
+   Screen.display();
+   HOST_CHECK ( PanelBusBytes() == DisplayFullBytes() );
+   HOST_CHECK ( PanelBusTransmissions() == DisplayFullTransmissions() );
+   HOST_CHECK ( HostGolden ( "Finished", PanelImage() ) );
+   Report ( "display()" );
+
+   return HostTestResult();
+}
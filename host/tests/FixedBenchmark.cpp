@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------< FixedBenchmark.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Measure the cost of handling a reading with floating point and with
+//          fixed point arithmetic.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Each pass does what one sample needs: convert the reading to
+//             fahrenheit, compare it with both limits, and format it once for
+//             the screen and once for the JSON message.  The float pass is the
+//             way SensorAction used to do it.
+//
+//          -  The host has floating point hardware and the ESP8266 does not,
+//             so the float figure here is far kinder than on the board.  What
+//             it does show is that the fixed point path costs no more even
+//             where float is cheap.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "FixedPoint.h"
+#include "HostTest.h"
+
+
+
+#define BENCHMARK_PASSES        1000000
+
+
+
+int main ()
+{
+   PConfig_t         Config;
+   char              Text[ FIXED_TEXT_MAX + 8 ];
+   uint64_t          Start;
+   uint64_t          FloatNanos;
+   uint64_t          FixedNanos;
+   volatile uint32_t Sink = 0;
+
+   HostTestBegin();
+   SetROMDefaults ( &Config );
+
+   Start = HostNanos();
+
+   for ( int i = 0; i < BENCHMARK_PASSES; i++ )
+   {
+      float Value = ( 300 + ( i & 0x3FF ) ) * 0.0625;
+
+      Value = ( Value * ( 9.0 / 5.0 ) ) + 32.0;
+      Sink += ( Value > Config.TempLowLimit && Value < Config.TempHighLimit );
+      Sink += sprintf ( Text, "%.1f", Value );
+      Sink += sprintf ( Text, "%.2f", Value );
+   }
+
+   FloatNanos = HostNanos() - Start;
+   Start      = HostNanos();
+
+   for ( int i = 0; i < BENCHMARK_PASSES; i++ )
+   {
+      int32_t Value = 300 + ( i & 0x3FF );
+
+      Value = FixedC2F ( Value );
+      Sink += (  Value > FIXED_FROM_INT ( Config.TempLowLimit )
+              && Value < FIXED_FROM_INT ( Config.TempHighLimit )
+              );
+      Sink += FormatFixed ( Text, Value, 1 );
+      Sink += FormatFixed ( Text, Value, 2 );
+   }
+
+   FixedNanos = HostNanos() - Start;
+
+   printf ( "Nanoseconds per sample, float %.1f  fixed point %.1f \n",
+            (double) FloatNanos / BENCHMARK_PASSES,
+            (double) FixedNanos / BENCHMARK_PASSES
+          );
+
+   return 0;
+}
@@ -0,0 +1,143 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< HostTest.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: What the host tests and benchmarks share: the sketch's entry points
+//          and a check that reports where it failed without stopping.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  A test ends with "return HostTestResult();", which exits non-zero
+//             if any check failed.
+//
+//          -  The sketch's serial output is echoed only when HOST_ECHO is set
+//             in the environment (see HostTestBegin).
+//
+//          -  Images compared by HostGolden() are kept in tests/golden.  When
+//             HOST_GOLDEN is set in the environment ("make golden") they are
+//             written instead of compared.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Golden image checks.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "EEPROMConfig.h"
+#include "HostCore.h"
+
+
+
+#define HOST_CHECK(c)  HostCheck ( (c), #c, __FILE__, __LINE__ )
+
+
+
+void setup ();
+void loop ();
+
+static uint32_t   HostChecks = 0;
+static uint32_t   HostFailures = 0;
+
+
+
+inline void HostTestBegin ()
+{
+   HostSerialEcho ( getenv ( "HOST_ECHO" ) != NULL );
+}
+
+//
+// Store the default configuration with some flags changed, as if they had
+// been set on the configuration page before the board was started.
+//
+inline void HostTestConfig (
+   uint32_t Set,
+   uint32_t Clear
+)
+{
+   PConfig_t   Config;
+
+   EEPROM.begin ( sizeof ( PConfig_t ) );
+   SetROMDefaults ( &Config );
+   Config.Flags = ( Config.Flags | Set ) & ~Clear;
+   EEPROM.put ( PCONFIG_OFFSET, Config );
+   EEPROM.commit();
+   HostSerialText().clear();
+}
+
+inline bool HostCheck (
+   bool        Passed,
+   const char* Text,
+   const char* File,
+   int         Line
+)
+{
+   HostChecks++;
+
+   if ( Passed == false )
+   {
+      HostFailures++;
+      printf ( "FAIL %s:%d: %s\n", File, Line, Text );
+   }
+
+   return Passed;
+}
+
+//
+// Compare an image with the one stored under the same name.  One that does
+// not match is written next to it, with .new added, to look at.
+//
+inline bool HostGolden (
+   const char*          Name,
+   const std::string&   Image
+)
+{
+   std::string          Path = std::string ( HOST_GOLDEN_DIR ) + "/" + Name + ".pbm";
+   std::ifstream        Stored ( Path, std::ios::binary );
+   std::ostringstream   Golden;
+   bool                 Passed = true;
+
+   if ( getenv ( "HOST_GOLDEN" ) != NULL )
+   {
+      std::ofstream ( Path, std::ios::binary ) << Image;
+   }
+
+   else
+   {
+      Golden << Stored.rdbuf();
+      Passed = ( Golden.str() == Image );
+
+      if ( Passed == false )
+      {
+         std::ofstream ( Path + ".new", std::ios::binary ) << Image;
+         printf ( "     %s.new differs\n", Path.c_str() );
+      }
+   }
+
+   return Passed;
+}
+
+inline int HostTestResult ()
+{
+   printf ( "%u checks, %u failed\n", HostChecks, HostFailures );
+
+   return ( HostFailures == 0 ) ? 0 : 1;
+}
+
+
+
+#endif   // HOST_TEST_H
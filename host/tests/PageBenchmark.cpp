@@ -0,0 +1,236 @@
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< PageBenchmark.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Measure the time to the first byte, the time to the last, and the
+//          most heap used to send each of the configuration pages, both the
+//          way the pages used to be made and the way they are streamed now.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The heap is what the sketch allocates while it answers the
+//             request, on top of what it held before.  Stack is not counted.
+//
+//          -  File reads are cut short at 256 bytes, as SPIFFS does at a page
+//             boundary, and counted, since each one is a call into SPIFFS on
+//             the board.
+//
+//          -  The "before" rows are the old handler, emulated here as in
+//             PageTest: the whole file read a byte at a time into a String,
+//             each place holder replaced in turn, and the result sent at once.
+//             It is served by the same web server, so it goes through the same
+//             heap and file read counters as the sketch.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Old String rendering measured alongside.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ESP8266WebServer.h>
+#include "WebConfig.h"
+#include "HostTest.h"
+
+
+
+#define BENCHMARK_PASSES        200
+#define BENCHMARK_READ_LIMIT    256
+#define BENCHMARK_BEFORE        "/Before"
+
+
+
+extern PConfig_t           ConfigData;
+extern ESP8266WebServer    WebServer;
+
+static const char* const   Pages[] = { "/SensorConfig.html", "/WifiConfig.html" };
+
+static const HNetwork_t    Networks[] =
+{
+   { "home",        6, -52, ENC_TYPE_CCMP },
+   { "guest",       6, -67, ENC_TYPE_NONE },
+   { "workshop",   11, -80, ENC_TYPE_TKIP },
+};
+
+
+
+//
+// Choose between two radio buttons the way the pages used to.
+//
+static void Radio (
+   String&     Text,
+   const char* Name,
+   const char* Yes,
+   const char* No,
+   bool        Checked
+)
+{
+   Text.replace ( String ( "\"set_" ) + Name + "_" + Yes + "\"", String ( "\"" ) + Yes + "\"" + ( Checked ? " checked" : "" ) );
+   Text.replace ( String ( "\"set_" ) + Name + "_" + No + "\"", String ( "\"" ) + No + "\"" + ( Checked ? "" : " checked" ) );
+}
+
+
+
+//
+// Send a page as it used to be made: the whole file read into a String, each
+// place holder replaced in turn, and the String sent in one piece.
+//
+static void SendBefore (
+   const char* Page
+)
+{
+   String      Text;
+   File        FileHandle = SPIFFS.open ( Page, "r" );
+   const char* Names[] = { "ap", "nm", "gw" };
+   uint8_t*    Addresses[] = { ConfigData.AccessIP, ConfigData.NetMask, ConfigData.Gateway };
+
+   while ( FileHandle.available() )
+   {
+      Text += char ( FileHandle.read() );
+   }
+
+   FileHandle.close();
+
+   Text.replace ( "<span name=\"sensor_name\"></span>",
+                  String ( "<span name=\"sensor_name\"><a href=\"/\">" ) + ConfigData.Label + "</a></span>" );
+
+   if ( strcmp ( Page, "/SensorConfig.html" ) == 0 )
+   {
+      Radio ( Text, "probe", "Y", "N", ConfigData.Flags & CONFIG_TEMP_PROBE_CONNECTED );
+      Radio ( Text, "relay", "Y", "N", ConfigData.Flags & CONFIG_DEVICE_RELAY_CONNECTED );
+      Text.replace ( "set_lowtemp", String ( ConfigData.TempLowLimit ) );
+      Text.replace ( "set_hightemp", String ( ConfigData.TempHighLimit ) );
+      Text.replace ( "set_label", ConfigData.Label );
+      Text.replace ( "set_interval", String ( ConfigData.SensorWaitTime / 1000 ) );
+      Text.replace ( "set_minwait", String ( ConfigData.SensorWaitMin / 1000 ) );
+      Text.replace ( "set_maxwait", String ( ConfigData.SensorWaitMax / 1000 ) );
+      Text.replace ( "set_hysteresis", String ( ConfigData.TempHysteresis / 10.0, 1 ) );
+      Text.replace ( "set_minon", String ( ConfigData.RelayMinOnTime ) );
+      Text.replace ( "set_minoff", String ( ConfigData.RelayMinOffTime ) );
+      Radio ( Text, "units", "F", "C", ConfigData.Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT );
+      Radio ( Text, "debug", "Y", "N", ConfigData.Flags & CONFIG_DEBUG_MESSAGE_ENABLED );
+   }
+
+   else
+   {
+      String   List;
+      int      NetworkCount = WiFi.scanNetworks ( false, true );
+
+      for ( int i = 0; i < NetworkCount; i++ )
+      {
+         int   Encryption = WiFi.encryptionType ( i );
+
+         List += String ( "<option value=\"" ) + WiFi.SSID ( i ) + "\">" + WiFi.SSID ( i )
+               + " (Ch " + String ( WiFi.channel ( i ) ) + ", " + String ( WiFi.RSSI ( i ) ) + " dBm, "
+               + ( Encryption == ENC_TYPE_NONE ? "Open"
+                 : Encryption == ENC_TYPE_WEP  ? "WEP"
+                 : Encryption == ENC_TYPE_TKIP ? "WPA/PSK"
+                 : Encryption == ENC_TYPE_CCMP ? "WPA2/PSK"
+                 : Encryption == ENC_TYPE_AUTO ? "Auto"
+                 :                               "Unknown" )
+               + ") </option>\n";
+      }
+
+      Text.replace ( "<span name=\"set_netlist\"/>", List );
+      Radio ( Text, "wifi", "Y", "N", ConfigData.Flags & CONFIG_WIFI_STATION_ENABLED );
+      Text.replace ( "set_ssid", ConfigData.WifiSSID );
+      Text.replace ( "set_pass", ConfigData.WifiPassword );
+
+      for ( int Kind = 0; Kind < 3; Kind++ )
+      {
+         for ( int i = 0; i < 4; i++ )
+         {
+            Text.replace ( String ( "set_" ) + Names[ Kind ] + String ( i ), String ( Addresses[ Kind ][ i ] ) );
+         }
+      }
+
+      for ( int i = 0; i < BAUD_LIST_SIZE; i++ )
+      {
+         Text.replace ( "\"set_" + String ( BaudList[ i ] ) + "\"",
+                        "\"" + String ( BaudList[ i ] ) + "\"" + ( ConfigData.SerialBaud == (uint32_t) BaudList[ i ] ? " selected" : "" ) );
+      }
+
+      Text.replace ( "set_webport", String ( ConfigData.WebServerPort ) );
+      Text.replace ( "set_wsport", String ( ConfigData.WebSocketServerPort ) );
+   }
+
+   WebServer.sendContent ( Text );
+}
+
+
+
+//
+// Ask for a page enough times to time it, and print what it cost.
+//
+static std::string Measure (
+   const char* Name,
+   const char* Uri
+)
+{
+   HResponse_t Response;
+   uint32_t    InUse;
+   uint32_t    Reads;
+   uint64_t    FirstNanos = 0;
+   uint64_t    TotalNanos = 0;
+
+   InUse = HostHeapInUse();
+   Reads = HostFileReads();
+   HostHeapResetPeak();
+
+   for ( int i = 0; i < BENCHMARK_PASSES; i++ )
+   {
+      HostWebRequest ( HTTP_GET, Uri, {}, &Response );
+      FirstNanos += Response.FirstByteNanos;
+      TotalNanos += Response.TotalNanos;
+   }
+
+   printf ( "%-6s %s %u bytes in %u chunks, %u file reads, first byte %.1f us, all %.1f us, peak heap %u bytes \n",
+            Name,
+            Uri,
+            (unsigned) Response.Body.size(),
+            Response.Chunks,
+            ( HostFileReads() - Reads ) / BENCHMARK_PASSES,
+            (double) FirstNanos / BENCHMARK_PASSES / 1000,
+            (double) TotalNanos / BENCHMARK_PASSES / 1000,
+            HostHeapPeak() - InUse
+          );
+
+   return Response.Body;
+}
+
+
+
+int main ()
+{
+   std::string Before;
+   std::string After;
+
+   HostTestBegin();
+   HostSetNetworks ( Networks, sizeof ( Networks ) / sizeof ( Networks[ 0 ] ) );
+   setup();
+
+   strcpy ( ConfigData.Label, "Kitchen" );
+   ConfigData.LabelLength = strlen ( ConfigData.Label );
+
+   for ( const char* Page : Pages )
+   {
+      WebServer.on ( String ( BENCHMARK_BEFORE ) + Page, HTTP_GET, [ Page ]() { SendBefore ( Page ); } );
+   }
+
+   HostSetReadLimit ( BENCHMARK_READ_LIMIT );
+
+   for ( const char* Page : Pages )
+   {
+      Before = Measure ( "before", ( std::string ( BENCHMARK_BEFORE ) + Page ).c_str() );
+      After  = Measure ( "after", Page );
+
+      HOST_CHECK ( After.find ( "</html>" ) != std::string::npos );
+      HOST_CHECK ( After == Before );
+   }
+
+   return HostTestResult();
+}
@@ -0,0 +1,235 @@
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< PageTest.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Check that the configuration pages, filled in a block at a time,
+//          are the same as the whole file with each place holder replaced in
+//          turn, the way they used to be made.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The pages are read with short reads of several sizes, as SPIFFS
+//             cuts a read short at a page boundary.
+//
+//          -  Each page is also sent with 0 to TEMPLATE_BLOCK_SIZE - 1 spaces
+//             in front of it, so every place holder in it falls across the
+//             end of a block for one of them.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ESP8266WebServer.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "PageTemplate.h"
+#include "WebConfig.h"
+#include "HostTest.h"
+
+
+
+extern PConfig_t  ConfigData;
+
+static const HNetwork_t    Networks[] =
+{
+   { "home",        6, -52, ENC_TYPE_CCMP },
+   { "guest",       6, -67, ENC_TYPE_NONE },
+   { "workshop",   11, -80, ENC_TYPE_TKIP },
+};
+
+static const size_t        ReadLimits[] = { 0, 1, 7, 37, 255, 256 };
+
+
+
+//
+// Replace every copy of Find in Text, the way String::replace() does.
+//
+static void Replace (
+   std::string&         Text,
+   const std::string&   Find,
+   const std::string&   With
+)
+{
+   for ( size_t At = Text.find ( Find ); At != std::string::npos; At = Text.find ( Find, At + With.size() ) )
+   {
+      Text.replace ( At, Find.size(), With );
+   }
+}
+
+
+
+//
+// Choose between two radio buttons the way the pages used to.
+//
+static void Radio (
+   std::string&   Text,
+   const char*    Name,
+   const char*    Yes,
+   const char*    No,
+   bool           Checked
+)
+{
+   Replace ( Text, std::string ( "\"set_" ) + Name + "_" + Yes + "\"", std::string ( "\"" ) + Yes + "\"" + ( Checked ? " checked" : "" ) );
+   Replace ( Text, std::string ( "\"set_" ) + Name + "_" + No + "\"", std::string ( "\"" ) + No + "\"" + ( Checked ? "" : " checked" ) );
+}
+
+
+
+//
+// The page as it used to be made: the whole file read, and each place holder
+// replaced in turn, in the same order.
+//
+static std::string Expected (
+   const char* Page
+)
+{
+   static const char* const   Encryption[] = { "", "", "WPA/PSK", "", "WPA2/PSK", "WEP", "", "Open", "Auto" };
+
+   std::ifstream  File ( std::string ( HOST_FILE_ROOT ) + Page, std::ios::binary );
+   std::string    Text ( ( std::istreambuf_iterator<char> ( File ) ), std::istreambuf_iterator<char>() );
+   std::string    List;
+   char           Number[ 16 ];
+   const char*    Names[] = { "ap", "nm", "gw" };
+   uint8_t*       Addresses[] = { ConfigData.AccessIP, ConfigData.NetMask, ConfigData.Gateway };
+
+   Replace ( Text, "<span name=\"sensor_name\"></span>",
+             std::string ( "<span name=\"sensor_name\"><a href=\"/\">" ) + ConfigData.Label + "</a></span>" );
+
+   if ( strcmp ( Page, "/SensorConfig.html" ) == 0 )
+   {
+      Radio ( Text, "probe", "Y", "N", ConfigData.Flags & CONFIG_TEMP_PROBE_CONNECTED );
+      Radio ( Text, "relay", "Y", "N", ConfigData.Flags & CONFIG_DEVICE_RELAY_CONNECTED );
+      Replace ( Text, "set_lowtemp", std::to_string ( ConfigData.TempLowLimit ) );
+      Replace ( Text, "set_hightemp", std::to_string ( ConfigData.TempHighLimit ) );
+      Replace ( Text, "set_label", ConfigData.Label );
+      Replace ( Text, "set_interval", std::to_string ( ConfigData.SensorWaitTime / 1000 ) );
+      Replace ( Text, "set_minwait", std::to_string ( ConfigData.SensorWaitMin / 1000 ) );
+      Replace ( Text, "set_maxwait", std::to_string ( ConfigData.SensorWaitMax / 1000 ) );
+      snprintf ( Number, sizeof ( Number ), "%.1f", ConfigData.TempHysteresis / 10.0 );
+      Replace ( Text, "set_hysteresis", Number );
+      Replace ( Text, "set_minon", std::to_string ( ConfigData.RelayMinOnTime ) );
+      Replace ( Text, "set_minoff", std::to_string ( ConfigData.RelayMinOffTime ) );
+      Radio ( Text, "units", "F", "C", ConfigData.Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT );
+      Radio ( Text, "debug", "Y", "N", ConfigData.Flags & CONFIG_DEBUG_MESSAGE_ENABLED );
+   }
+
+   else
+   {
+      for ( const HNetwork_t& Network : Networks )
+      {
+         List += std::string ( "<option value=\"" ) + Network.SSID + "\">" + Network.SSID
+               + " (Ch " + std::to_string ( Network.Channel ) + ", " + std::to_string ( Network.RSSI )
+               + " dBm, " + Encryption[ Network.Encryption ] + ") </option>\n";
+      }
+
+      Replace ( Text, "<span name=\"set_netlist\"/>", List );
+      Radio ( Text, "wifi", "Y", "N", ConfigData.Flags & CONFIG_WIFI_STATION_ENABLED );
+      Replace ( Text, "set_ssid", ConfigData.WifiSSID );
+      Replace ( Text, "set_pass", ConfigData.WifiPassword );
+
+      for ( int Kind = 0; Kind < 3; Kind++ )
+      {
+         for ( int i = 0; i < 4; i++ )
+         {
+            Replace ( Text, std::string ( "set_" ) + Names[ Kind ] + std::to_string ( i ), std::to_string ( Addresses[ Kind ][ i ] ) );
+         }
+      }
+
+      for ( int i = 0; i < BAUD_LIST_SIZE; i++ )
+      {
+         Replace ( Text, "\"set_" + std::to_string ( BaudList[ i ] ) + "\"",
+                   "\"" + std::to_string ( BaudList[ i ] ) + "\"" + ( ConfigData.SerialBaud == (uint32_t) BaudList[ i ] ? " selected" : "" ) );
+      }
+
+      Replace ( Text, "set_webport", std::to_string ( ConfigData.WebServerPort ) );
+      Replace ( Text, "set_wsport", std::to_string ( ConfigData.WebSocketServerPort ) );
+   }
+
+   return Text;
+}
+
+
+
+//
+// Fetch a page from the sketch's web server.
+//
+static std::string Fetch (
+   const char* Page
+)
+{
+   HResponse_t Response;
+
+   HostWebRequest ( HTTP_GET, Page, {}, &Response );
+
+   return Response.Body;
+}
+
+
+
+int main ()
+{
+   static const char* const   Pages[] = { "/SensorConfig.html", "/WifiConfig.html" };
+
+   char        Root[] = "/tmp/PageTestXXXXXX";
+   bool        Same;
+
+   HostTestBegin();
+   HostTestConfig ( CONFIG_TEMP_DISPLAY_FAHRENHEIT | CONFIG_DEVICE_RELAY_CONNECTED, 0 );
+   HostSetNetworks ( Networks, sizeof ( Networks ) / sizeof ( Networks[ 0 ] ) );
+   setup();
+
+   strcpy ( ConfigData.Label, "Kitchen" );
+   ConfigData.LabelLength     = strlen ( ConfigData.Label );
+   ConfigData.TempHysteresis  = 15;
+   ConfigData.RelayMinOnTime  = 30;
+   ConfigData.RelayMinOffTime = 45;
+
+   // The same page whatever size the reads come back.
+   for ( const char* Page : Pages )
+   {
+      for ( size_t Limit : ReadLimits )
+      {
+         HostSetReadLimit ( Limit );
+         HOST_CHECK ( Fetch ( Page ) == Expected ( Page ) );
+      }
+   }
+
+   HostSetReadLimit ( 0 );
+
+   // And wherever the place holders fall against the blocks.
+   HOST_CHECK ( mkdtemp ( Root ) != NULL );
+   HostSetFileRoot ( Root );
+
+   for ( const char* Page : Pages )
+   {
+      Same = true;
+
+      for ( size_t Shift = 0; Shift < TEMPLATE_BLOCK_SIZE; Shift++ )
+      {
+         {
+            std::ifstream  From ( std::string ( HOST_FILE_ROOT ) + Page, std::ios::binary );
+            std::ofstream  To ( std::string ( Root ) + Page, std::ios::binary );
+
+            To << std::string ( Shift, ' ' ) << From.rdbuf();
+         }
+
+         Same = Same && Fetch ( Page ) == std::string ( Shift, ' ' ) + Expected ( Page );
+      }
+
+      HOST_CHECK ( Same );
+      unlink ( ( std::string ( Root ) + Page ).c_str() );
+   }
+
+   rmdir ( Root );
+   HostSetFileRoot ( HOST_FILE_ROOT );
+
+   HOST_CHECK ( HostRestarts() == 0 );
+
+   return HostTestResult();
+}
@@ -0,0 +1,80 @@
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------< ProbeBenchmark.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Measure how much OneWire bus time finding and reading the probes
+//          takes as the number of probes grows.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Runs the sketch's own ProbeBegin(), ProbeStartConversion(), and
+//             ProbeRead() against the emulated bus, with 1 to PROBE_MAX probes
+//             on it.  The bus time is what the same traffic takes on a real
+//             bus, counted one time slot at a time by the emulator.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "ProbeEmulator.h"
+#include "TempProbe.h"
+#include "HostTest.h"
+
+
+
+int main ()
+{
+   OneWire           Bus ( 0 );
+   DallasTemperature Probes ( &Bus );
+   PConfig_t         Config;
+   uint32_t          FindTime;
+   uint32_t          StartTime;
+   uint32_t          ReadTime;
+   uint8_t           Good;
+   int16_t           Value;
+
+   HostTestBegin();
+   SetROMDefaults ( &Config );
+
+   printf ( "OneWire bus time in microseconds:\n" );
+   printf ( "   Probes      Find   Start    Read  Per probe  Good\n" );
+
+   for ( uint8_t Devices = 1; Devices <= PROBE_MAX; Devices++ )
+   {
+      EmuBegin ( Devices );
+      ProbeBegin ( &Probes, &Config );
+      FindTime = EmuBusTime();
+
+      EmuClearBusTime();
+      HostAdvance ( ProbeStartConversion ( &Probes ) * 1000ULL );
+      Probes.isConversionComplete();
+      StartTime = EmuBusTime();
+
+      EmuClearBusTime();
+      Good = 0;
+
+      for ( uint8_t i = 0; i < ProbeCount; i++ )
+      {
+         Good += ( ProbeRead ( &Probes, i, &Value ) == PROBE_OK );
+      }
+
+      ReadTime = EmuBusTime();
+
+      printf ( "   %6u  %8u  %6u  %6u  %9u  %4u\n",
+               Devices,
+               FindTime,
+               StartTime,
+               ReadTime,
+               ReadTime / max ( ProbeCount, (uint8_t) 1 ),
+               Good
+             );
+   }
+
+   return 0;
+}
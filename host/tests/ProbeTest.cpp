@@ -0,0 +1,80 @@
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< ProbeTest.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Run the sketch with emulated DS18B20 probes on the OneWire bus, and
+//          check that readings come through and that faulty reads are retried
+//          or given up on as they should be.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "ProbeEmulator.h"
+#include "TempProbe.h"
+#include "HostTest.h"
+
+
+
+extern PConfig_t  ConfigData;
+extern int16_t    SampleValue[ PROBE_MAX ];
+extern uint8_t    SampleStatus[ PROBE_MAX ];
+
+
+
+int main ()
+{
+   HostTestBegin();
+
+   EmuBegin ( 2 );
+   setup();
+
+   HOST_CHECK ( ProbeCount == 2 );
+
+   // The search finds the probes in ROM code order, not the order they were
+   // put on the bus, so either may be first.
+   EmuSetTemperature ( 0, 25 * FIXED_ONE );
+   EmuSetTemperature ( 1, -10 * FIXED_ONE );
+   HostRun ( 2 * ConfigData.SensorWaitMax * 1000 );
+
+   HOST_CHECK ( SampleStatus[ 0 ] == PROBE_OK && SampleStatus[ 1 ] == PROBE_OK );
+   HOST_CHECK ( SampleValue[ 0 ] + SampleValue[ 1 ] == 15 * FIXED_ONE );
+   HOST_CHECK ( SampleValue[ 0 ] == 25 * FIXED_ONE || SampleValue[ 1 ] == 25 * FIXED_ONE );
+   HOST_CHECK ( ProbeFaults[ 0 ].Reads > 0 && ProbeFaults[ 0 ].Retries == 0 );
+
+   // One bad scratchpad is read again and the sample kept.
+   HOST_CHECK ( EmuFault ( ProbeAddress[ 1 ], EMU_FAULT_CRC, 1 ) );
+   HostRun ( 2 * ConfigData.SensorWaitMax * 1000 );
+
+   HOST_CHECK ( ProbeFaults[ 1 ].CRC == 1 );
+   HOST_CHECK ( ProbeFaults[ 1 ].Retries == 1 );
+   HOST_CHECK ( ProbeFaults[ 1 ].Invalid == 0 );
+   HOST_CHECK ( ProbeFaults[ 0 ].Retries == 0 );
+
+   // A lost conversion needs a new one, not just another read.
+   HOST_CHECK ( EmuFault ( ProbeAddress[ 0 ], EMU_FAULT_POWER_ON, 1 ) );
+   HostRun ( 2 * ConfigData.SensorWaitMax * 1000 );
+
+   HOST_CHECK ( ProbeFaults[ 0 ].PowerOn == 1 );
+   HOST_CHECK ( ProbeFaults[ 0 ].Invalid == 0 );
+   HOST_CHECK ( SampleStatus[ 0 ] == PROBE_OK && SampleValue[ 0 ] != FIXED_DISCONNECTED );
+
+   // A probe that stops answering is given up on after every retry.
+   HOST_CHECK ( EmuFault ( ProbeAddress[ 1 ], EMU_FAULT_NO_REPLY, 1000 ) );
+   HostRun ( 2 * ConfigData.SensorWaitMax * 1000 );
+
+   HOST_CHECK ( ProbeFaults[ 1 ].NoReply >= PROBE_RETRY_MAX + 1 );
+   HOST_CHECK ( ProbeFaults[ 1 ].Invalid > 0 );
+   HOST_CHECK ( SampleValue[ 1 ] == FIXED_DISCONNECTED );
+   HOST_CHECK ( SampleStatus[ 0 ] == PROBE_OK );
+
+   return HostTestResult();
+}
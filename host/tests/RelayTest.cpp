@@ -0,0 +1,130 @@
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< RelayTest.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Drive RelayControl() with a simulated heated space for half a day
+//          of readings, and check that the hysteresis band and the minimum ON
+//          and OFF times cut down how often the relay changes.  Also check
+//          that a relay turned OFF by RelayFault() is held OFF like any other.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The space moves toward PLANT_HEATED_C while the relay (heater)
+//             is ON and toward PLANT_AMBIENT_C while it is OFF, covering the
+//             same fraction of the gap in each PLANT_TIME_CONSTANT, with a
+//             little noise on each reading.  With the default limits the
+//             relay cuts out at the high limit, so the readings sit around it.
+//
+//          -  The transitions counted for each setting are printed.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <math.h>
+#include "EEPROMConfig.h"
+#include "SensorControl.h"
+#include "HostTest.h"
+
+
+
+#define PLANT_AMBIENT_C         50.0     // Temperature with the heater OFF
+#define PLANT_HEATED_C          100.0    // Temperature with the heater ON
+#define PLANT_TIME_CONSTANT     600.0    // Seconds to cover 63% of the gap
+#define PLANT_NOISE_C           0.15     // Largest reading noise either way
+
+#define PLANT_READING_SECONDS   5        // Time between readings
+#define PLANT_RUN_SECONDS       ( 12UL * 60 * 60 )
+
+
+
+//
+// Count the relay transitions over PLANT_RUN_SECONDS of readings with the
+// given hysteresis (tenths of a degree) and minimum times (seconds).
+//
+static uint32_t PlantRun (
+   uint8_t     Hysteresis,
+   uint16_t    MinOnTime,
+   uint16_t    MinOffTime
+)
+{
+   PConfig_t   Config;
+   float       Temperature = PLANT_AMBIENT_C;
+   float       Noise;
+
+   SetROMDefaults ( &Config );
+   Config.TempHysteresis  = Hysteresis;
+   Config.RelayMinOnTime  = MinOnTime;
+   Config.RelayMinOffTime = MinOffTime;
+
+   RelayTransitions = 0;
+
+   for ( uint32_t t = 0; t < PLANT_RUN_SECONDS; t += PLANT_READING_SECONDS )
+   {
+      Noise = random ( -100, 101 ) * ( PLANT_NOISE_C / 100.0 );
+
+      RelayControl ( &Config, (int16_t) lroundf ( ( Temperature + Noise ) * FIXED_ONE ) );
+
+      Temperature += ( ( RelayState == true ? PLANT_HEATED_C : PLANT_AMBIENT_C ) - Temperature )
+                     * ( 1.0 - exp ( -PLANT_READING_SECONDS / PLANT_TIME_CONSTANT ) );
+
+      HostAdvance ( PLANT_READING_SECONDS * 1000000ULL );
+   }
+
+   printf ( "Hysteresis %3u, ON %3u s, OFF %3u s: %5u transitions\n",
+            Hysteresis, MinOnTime, MinOffTime, RelayTransitions );
+
+   return RelayTransitions;
+}
+
+
+
+int main ()
+{
+   PConfig_t   Defaults;
+   uint32_t    Plain;
+   uint32_t    Band;
+   uint32_t    Held;
+
+   HostTestBegin();
+   SetROMDefaults ( &Defaults );
+
+   Plain = PlantRun ( 0, 0, 0 );
+   Band  = PlantRun ( Defaults.TempHysteresis, 0, 0 );
+   Held  = PlantRun ( Defaults.TempHysteresis, Defaults.RelayMinOnTime, Defaults.RelayMinOffTime );
+
+   HOST_CHECK ( Plain > 0 );
+   HOST_CHECK ( Band > 0 && Band < Plain );
+   HOST_CHECK ( Held > 0 && Held <= Band );
+
+   // Long ON, turned OFF after too many bad readings, then a good reading
+   // comes back well inside the limits.
+   HostAdvance ( Defaults.RelayMinOffTime * 2000000ULL );
+   RelayControl ( &Defaults, FIXED_FROM_INT ( 60 ) );
+   HOST_CHECK ( RelayState == true );
+
+   HostAdvance ( Defaults.RelayMinOnTime * 2000000ULL );
+   RelayControl ( &Defaults, FIXED_FROM_INT ( 60 ) );
+
+   for ( int i = 0; i < RELAY_FAULT_SAMPLES; i++ )
+   {
+      HostAdvance ( PLANT_READING_SECONDS * 1000000ULL );
+      RelayFault();
+   }
+
+   HOST_CHECK ( RelayState == false );
+
+   HostAdvance ( PLANT_READING_SECONDS * 1000000ULL );
+   HOST_CHECK ( RelayControl ( &Defaults, FIXED_FROM_INT ( 60 ) ) == false );
+
+   HostAdvance ( Defaults.RelayMinOffTime * 1000000ULL );
+   HOST_CHECK ( RelayControl ( &Defaults, FIXED_FROM_INT ( 60 ) ) == true );
+
+   return HostTestResult();
+}
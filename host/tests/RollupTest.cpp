@@ -0,0 +1,73 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< RollupTest.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Run the sketch on fake data until every rollup tier is full, and
+//          check that /Rollups.json sends every window in chunks that fit the
+//          buffer they are built in.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ArduinoJson.h>
+#include <ESP8266WebServer.h>
+#include "SensorHistory.h"
+#include "SensorRollup.h"
+#include "HostTest.h"
+
+
+
+// Longer than the longest tier, so every tier has all of its windows.
+#define ROLLUP_TEST_HOURS       25
+
+// Each pass of loop() is taken to be this long, to keep the run short.
+#define ROLLUP_TEST_LOOP        100000
+
+
+
+int main ()
+{
+   static StaticJsonBuffer< 32768 >  Json;
+   HResponse_t                      Response;
+   uint32_t                         Windows = 0;
+
+   HostTestBegin();
+   HostTestConfig ( 0, CONFIG_TEMP_PROBE_CONNECTED );
+   setup();
+   HostRun ( ROLLUP_TEST_HOURS * 3600ULL * 1000000, ROLLUP_TEST_LOOP );
+
+   HOST_CHECK ( HostWebRequest ( HTTP_GET, "/Rollups.json", {}, &Response ) );
+   HOST_CHECK ( Response.Status == 200 );
+   HOST_CHECK ( Response.Chunks > 1 );
+   HOST_CHECK ( Response.LargestChunk < HISTORY_CHUNK_SIZE );
+
+   JsonObject& Root  = Json.parseObject ( Response.Body.c_str() );
+   JsonArray&  Tiers = Root[ "Tiers" ].as<JsonArray>();
+
+   HOST_CHECK ( Root.success() );
+   HOST_CHECK ( Tiers.size() == ROLLUP_TIER_COUNT );
+
+   for ( uint8_t i = 0; i < ROLLUP_TIER_COUNT; i++ )
+   {
+      JsonArray&  Each = Tiers[ i ][ "Windows" ].as<JsonArray>();
+
+      // The full table of closed windows, and the open one.
+      HOST_CHECK ( Each.size() == RollupTable[ i ].Size + 1u );
+      HOST_CHECK ( strcmp ( Tiers[ i ][ "Name" ].as<const char*>(), RollupTable[ i ].Name ) == 0 );
+      Windows += Each.size();
+   }
+
+   printf ( "%u windows in %zu bytes, %u chunks, largest %zu \n",
+            Windows, Response.Body.size(), Response.Chunks, Response.LargestChunk );
+
+   return HostTestResult();
+}
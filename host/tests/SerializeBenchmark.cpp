@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------
+// ------------------------------------------------< SerializeBenchmark.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Measure the cost of serializing the sensor data with the JSON
+//          library and with SerializeJSON(), and check that both write the
+//          same text.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The library pass is the way SerializeJSON() used to do it: build
+//             the object tree, print it, then measure it.  Both the compact and
+//             the pretty text are compared.
+//
+//          -  Built against the stand-in JSON library unless ARDUINOJSON is
+//             set (see the Makefile), so the library figure is only a fair one
+//             with the real library.
+//
+//          -  The stack figure is the size of the buffers each way puts on the
+//             stack, which is most of the difference between them.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development, from the sketch.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <ArduinoJson.h>
+#include "SensorData.h"
+#include "HostTest.h"
+
+
+
+#define BENCHMARK_PASSES        100000
+
+// Room the library needs for the object tree of the sensor data.
+#define BENCHMARK_JSON_SIZE     ( JSON_OBJECT_SIZE ( 8 ) + JSON_ARRAY_SIZE ( PROBE_MAX ) )
+
+// Format a temperature value for JSON, null if it is not a valid reading.
+#define FormatJSONTemp(t,v)                                          \
+        ( ( (v) != FIXED_DISCONNECTED )                              \
+          ? FormatFixed ( (t), (v), JSON_TEMP_PLACES )               \
+          : sprintf ( (t), "null" ) )
+
+
+
+int main ()
+{
+   PConfig_t   Config;
+   char        Expected[ 2 * JSON_MAX_TEXT ];
+   char        Actual[ 2 * JSON_MAX_TEXT ];
+   size_t      Length[ 2 ] = { 0, 0 };
+   uint64_t    Nanos[ 2 ];
+   uint64_t    Start;
+   bool        Same = true;
+   int16_t     Values[ PROBE_MAX ];
+
+   HostTestBegin();
+   SetROMDefaults ( &Config );
+   strcpy ( Config.Label, "Brew \"kettle\"" );
+
+   for ( uint8_t i = 0; i < PROBE_MAX; i++ )
+   {
+      Values[ i ] = ( i == 1 ) ? FIXED_DISCONNECTED : 1160 + 9 * i;
+   }
+
+   SData_t  Data = { "Temperature", Config.Label, "F" };
+   Data.Value      = Values[ 0 ];
+   Data.Time       = 0;
+   Data.Interval   = Config.SensorWaitTime / 1000;
+   Data.Seq        = 1234;
+   Data.Values     = Values;
+   Data.ValueCount = PROBE_MAX;
+
+   for ( uint8_t Pretty = 0; Pretty < 2; Pretty++ )
+   {
+      Start = HostNanos();
+
+      for ( int p = 0; p < BENCHMARK_PASSES; p++ )
+      {
+         char     Text[ PROBE_MAX + 1 ][ FIXED_TEXT_MAX ];
+         StaticJsonBuffer<BENCHMARK_JSON_SIZE> jsonBuffer;
+         JsonObject& root = jsonBuffer.createObject();
+
+         FormatJSONTemp ( Text[ PROBE_MAX ], Data.Value );
+
+         root[ "Type" ]     = Data.Type;
+         root[ "Name" ]     = Data.Name;
+         root[ "Units" ]    = Data.Units;
+         root[ "Value" ]    = RawJson ( Text[ PROBE_MAX ] );
+         root[ "Time" ]     = Data.Time;
+         root[ "Interval" ] = Data.Interval;
+         root[ "Seq" ]      = Data.Seq;
+
+         JsonArray& Probes  = root.createNestedArray ( "Probes" );
+
+         for ( uint8_t i = 0; i < Data.ValueCount; i++ )
+         {
+            FormatJSONTemp ( Text[ i ], Data.Values[ i ] );
+            Probes.add ( RawJson ( Text[ i ] ) );
+         }
+
+         if ( Pretty == 1 )
+         {
+            root.prettyPrintTo ( Expected, sizeof ( Expected ) );
+            Length[ 0 ] = root.measurePrettyLength();
+         }
+
+         else
+         {
+            root.printTo ( Expected, sizeof ( Expected ) );
+            Length[ 0 ] = root.measureLength();
+         }
+      }
+
+      Nanos[ 0 ] = HostNanos() - Start;
+      Start      = HostNanos();
+
+      for ( int p = 0; p < BENCHMARK_PASSES; p++ )
+      {
+         Length[ 1 ] = SerializeJSON ( Data, Actual, sizeof ( Actual ), Pretty == 1 );
+      }
+
+      Nanos[ 1 ] = HostNanos() - Start;
+
+      Same = Same && Length[ 0 ] == Length[ 1 ] && strcmp ( Expected, Actual ) == 0;
+
+      printf ( "%s JSON, library %zu bytes %.0f ns  direct %zu bytes %.0f ns \n",
+               ( Pretty == 1 ) ? "Pretty" : "Compact",
+               Length[ 0 ],
+               (double) Nanos[ 0 ] / BENCHMARK_PASSES,
+               Length[ 1 ],
+               (double) Nanos[ 1 ] / BENCHMARK_PASSES
+             );
+   }
+
+   printf ( "JSON stack buffers, library %zu bytes  direct %zu bytes, text %s \n",
+            sizeof ( StaticJsonBuffer<BENCHMARK_JSON_SIZE> ) + ( PROBE_MAX + 1 ) * FIXED_TEXT_MAX,
+            sizeof ( JWriter_t ) + FIXED_TEXT_MAX,
+            ( Same == true ) ? "the same" : "DIFFERENT"
+          );
+
+   return ( Same == true ) ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< SerializeTest.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Check that the sensor data sent to web socket clients fits the
+//          buffers it is written into at its longest: every probe, a label of
+//          the most characters that all need escaping, and every value at its
+//          longest.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "ProbeEmulator.h"
+#include "SensorData.h"
+#include "HostTest.h"
+
+
+
+int main ()
+{
+   static const char Escaped[] = "\"\\\b\f\n\r\t";
+
+   char        Label[ PCONFIG_MAX_LABEL + 1 ];
+   int16_t     Values[ PROBE_MAX ];
+   char        Text[ 2 * JSON_MAX_TEXT ];
+   uint8_t     Binary[ SENSOR_BINARY_MAX ];
+   size_t      Length;
+   PConfig_t   Config;
+   int         Client;
+
+   HostTestBegin();
+
+   for ( uint8_t i = 0; i < PCONFIG_MAX_LABEL; i++ )
+   {
+      Label[ i ] = Escaped[ i % ( sizeof ( Escaped ) - 1 ) ];
+   }
+
+   Label[ PCONFIG_MAX_LABEL ] = 0;
+
+   for ( uint8_t i = 0; i < PROBE_MAX; i++ )
+   {
+      Values[ i ] = INT16_MIN;
+   }
+
+   SData_t  Data = { "Temperature", Label, "F" };
+   Data.Value      = INT16_MIN;
+   Data.Time       = UINT32_MAX;
+   Data.Interval   = UINT32_MAX;
+   Data.Seq        = UINT32_MAX;
+   Data.Values     = Values;
+   Data.ValueCount = PROBE_MAX;
+
+   // The longest text fills the buffer exactly, so the size is not just big
+   // enough but worked out right.
+   Length = SerializeJSON ( Data, Text, sizeof ( Text ) );
+   HOST_CHECK ( Length == JSON_MAX_TEXT - 1 );
+   HOST_CHECK ( strcmp ( Text + Length - 2, "]}" ) == 0 );
+
+   Length = SerializeDescriptor ( Data, Text, sizeof ( Text ) );
+   HOST_CHECK ( Length < JSON_MAX_TEXT );
+
+   Length = SerializeBinary ( Data, Binary, sizeof ( Binary ) );
+   HOST_CHECK ( Length <= SENSOR_BINARY_MAX );
+
+   // The sketch itself, with debug messages on, sends the longest readings
+   // and only cuts off the pretty text it shows on the serial port.
+   EEPROM.begin ( sizeof ( PConfig_t ) );
+   SetROMDefaults ( &Config );
+   Config.Flags      |= CONFIG_DEBUG_MESSAGE_ENABLED;
+   Config.LabelLength = PCONFIG_MAX_LABEL;
+   memcpy ( Config.Label, Label, sizeof ( Label ) );
+   EEPROM.put ( PCONFIG_OFFSET, Config );
+   EEPROM.commit();
+
+   EmuBegin ( PROBE_MAX );
+
+   for ( uint8_t i = 0; i < PROBE_MAX; i++ )
+   {
+      EmuSetTemperature ( i, -55 * FIXED_ONE );
+   }
+
+   setup();
+   Client = HostSocketConnect ( "/", NULL );
+   HostRun ( 3 * Config.SensorWaitMax * 1000 );
+
+   HOST_CHECK ( HostSocketFrames ( Client ).size() > 0
+                && HostSocketFrames ( Client ).back().Data.find ( "\"Probes\":[-67.00,-67.00,-67.00,-67.00,-67.00,-67.00,-67.00,-67.00]" ) != std::string::npos );
+   HOST_CHECK ( HostSerialText().find ( "(cut off)" ) != std::string::npos );
+   HOST_CHECK ( HostRestarts() == 0 );
+
+   return HostTestResult();
+}
@@ -0,0 +1,71 @@
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< SmokeTest.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Start the sketch on the host from a blank EEPROM, let it run for a
+//          while, and check that it comes up the way the board does: defaults
+//          stored, pages served, and readings sent to a web socket client.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <EEPROM.h>
+#include <ESP8266WebServer.h>
+#include "EEPROMConfig.h"
+#include "HostTest.h"
+
+
+
+extern PConfig_t  ConfigData;
+extern uint16_t   Services;
+
+
+
+int main ()
+{
+   HResponse_t Response;
+   int         Client;
+
+   HostTestBegin();
+   setup();
+
+   HOST_CHECK ( HostSerialText().find ( "sketch started" ) != std::string::npos );
+   HOST_CHECK ( ConfigData.Version == PCONFIG_VERSION );
+   HOST_CHECK ( EEPROM.Commits > 0 );
+   HOST_CHECK ( Services != 0 );
+
+   // Run long enough for the start up screen to be sent and a few readings.
+   HostRun ( 3 * ConfigData.SensorWaitTime * 1000 );
+
+   HOST_CHECK ( HostWebRequest ( HTTP_GET, "/SensorConfig.html", {}, &Response ) );
+   HOST_CHECK ( Response.Body.find ( "</html>" ) != std::string::npos );
+
+   HOST_CHECK ( HostWebRequest ( HTTP_GET, "/NoSuchPage.html", {}, &Response ) );
+   HOST_CHECK ( Response.Status == 404 );
+
+   Client = HostSocketConnect ( "/", NULL );
+   HOST_CHECK ( Client >= 0 );
+
+   // With the adaptive interval readings can be up to SensorWaitMax apart.
+   HostRun ( 3 * max ( ConfigData.SensorWaitTime, ConfigData.SensorWaitMax ) * 1000 );
+
+   HOST_CHECK ( HostSocketFrames ( Client ).size() >= 2 );
+   HOST_CHECK ( HostSocketFrames ( Client ).size() > 0
+                && HostSocketFrames ( Client ).back().Data.find ( "\"Value\"" ) != std::string::npos );
+
+   HostSocketDisconnect ( Client );
+   HostRun ( ConfigData.SensorWaitTime * 1000 );
+
+   HOST_CHECK ( HostRestarts() == 0 );
+
+   return HostTestResult();
+}
@@ -0,0 +1,252 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< SocketTest.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Connect web socket clients to the sketch and check what each one is
+//          answered with and sent.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Nothing written to a client with no room for it.
+// 16Oct2026 Scott Vance - Intervals set out of range are refused.
+// 16Oct2026 Scott Vance - Subscriptions out of range are refused.
+// 16Oct2026 Scott Vance - Limits out of range and errors with a good Relay.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <WiFiClient.h>
+#include "ProbeEmulator.h"
+#include "HostTest.h"
+
+
+
+extern PConfig_t  ConfigData;
+
+
+
+//
+// Connect a client, and return how many readings of history it was sent, or
+// -1 if it was sent no history at all.
+//
+static int Backfill (
+   const char* Url,
+   const char* Command
+)
+{
+   int   Client = HostSocketConnect ( Url, NULL );
+   int   Samples = -1;
+
+   HostRun ( 20 * HOST_LOOP_MICROS );
+
+   if ( Command != NULL )
+   {
+      HostSocketText ( Client, Command );
+      HostRun ( HOST_LOOP_MICROS );
+   }
+
+   for ( const HFrame_t& Frame : HostSocketFrames ( Client ) )
+   {
+      if ( Frame.Data.find ( "\"History\"" ) != std::string::npos )
+      {
+         Samples = 0;
+
+         for ( size_t At = Frame.Data.find ( "[[" ); At != std::string::npos; At = Frame.Data.find ( "],[", At + 1 ) )
+         {
+            Samples++;
+         }
+      }
+   }
+
+   HostSocketDisconnect ( Client );
+   HostRun ( HOST_LOOP_MICROS );
+
+   return Samples;
+}
+
+
+
+//
+// Connect a client, send it a command, and return the answer it was sent.
+//
+static std::string Answer (
+   const char* Command
+)
+{
+   int         Client = HostSocketConnect ( "/", NULL );
+   std::string Text;
+
+   HostRun ( 20 * HOST_LOOP_MICROS );
+   HostSocketText ( Client, Command );
+   HostRun ( HOST_LOOP_MICROS );
+
+   for ( const HFrame_t& Frame : HostSocketFrames ( Client ) )
+   {
+      if ( Frame.Data.find ( "\"State\"" ) != std::string::npos )
+      {
+         Text = Frame.Data;
+      }
+   }
+
+   HostSocketDisconnect ( Client );
+   HostRun ( HOST_LOOP_MICROS );
+
+   return Text;
+}
+
+
+
+//
+// A subprotocol header a client sends, and whether it asks for binary frames.
+//
+typedef struct PROTOCOL_CASE
+{
+   const char* Protocols;
+   bool        Binary;
+} PCase_t;
+
+static const PCase_t ProtocolCases[] =
+{
+   { NULL,                      false },
+   { "sensor.bin",              true  },
+   { "chat, sensor.bin",        true  },
+   { "sensor.bin ,chat",        true  },
+   { "sensor.binary",           false },
+   { "x-sensor.bin",            false },
+   { "sensor",                  false },
+   { "chat",                    false },
+   { "SENSOR.BIN",              false },
+};
+
+
+
+int main ()
+{
+   HostTestBegin();
+   EmuBegin ( 1 );
+   setup();
+   HostRun ( ConfigData.SensorWaitTime * 1000 );
+
+   // Only an exact token asks for binary frames, and only then is the
+   // protocol named in the answer.
+   for ( const PCase_t& Case : ProtocolCases )
+   {
+      int   Client = HostSocketConnect ( "/", Case.Protocols );
+
+      HostRun ( ConfigData.SensorWaitMax * 1000 );
+
+      HOST_CHECK ( HostSocketProtocol ( Client ) == ( Case.Binary ? "sensor.bin" : "" ) );
+      HOST_CHECK ( HostSocketFrames ( Client ).size() >= 2
+                   && HostSocketFrames ( Client ).back().Binary == Case.Binary );
+
+      HostSocketDisconnect ( Client );
+      HostRun ( HOST_LOOP_MICROS );
+   }
+
+   // A count of history too large for 16 bits is still the most there is,
+   // and one below zero is none, whichever way it is asked for.
+   HOST_CHECK ( Backfill ( "/?history=3", NULL ) == 3 );
+   HOST_CHECK ( Backfill ( "/?history=65536", NULL ) == Backfill ( "/?history=1000", NULL ) );
+   HOST_CHECK ( Backfill ( "/?history=1000", NULL ) > 3 );
+   HOST_CHECK ( Backfill ( "/?history=-1", NULL ) == -1 );
+   HOST_CHECK ( Backfill ( "/", "{\"History\":65537}" ) == Backfill ( "/?history=1000", NULL ) );
+   HOST_CHECK ( Backfill ( "/", "{\"History\":-5}" ) == -1 );
+
+   // An interval is only taken from SensorWaitMin to SensorWaitMax seconds,
+   // and one that would wrap around once it is made milliseconds is refused
+   // rather than turned into a short one.
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Interval\":4294968}}" ).find ( "\"Error\"" ) != std::string::npos );
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Interval\":0}}" ).find ( "\"Error\"" ) != std::string::npos );
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Interval\":-1}}" ).find ( "\"Error\"" ) != std::string::npos );
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Interval\":4}}" ).find ( "\"Error\"" ) != std::string::npos );
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Interval\":61}}" ).find ( "\"Error\"" ) != std::string::npos );
+   HOST_CHECK ( ConfigData.SensorWaitTime == 15000 );
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Interval\":60}}" ).find ( "\"Interval\":60," ) != std::string::npos );
+   HOST_CHECK ( ConfigData.SensorWaitTime == 60000 );
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Interval\":15}}" ).find ( "\"Error\"" ) == std::string::npos );
+
+   // A good Relay in the same command does not hide an earlier error, and
+   // the relay is left as it was.
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Interval\":99999,\"Relay\":\"ON\"}}" ).find ( "\"Error\"" ) != std::string::npos );
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Units\":\"X\",\"Relay\":\"AUTO\"}}" ).find ( "\"Error\"" ) != std::string::npos );
+   HOST_CHECK ( Answer ( "{\"Set\":{}}" ).find ( "\"Relay\":\"AUTO\"" ) != std::string::npos );
+
+   // Limits that would only look good once cut down to 16 bits are refused.
+   HOST_CHECK ( Answer ( "{\"Set\":{\"HighLimit\":65636}}" ).find ( "\"Error\"" ) != std::string::npos );
+   HOST_CHECK ( Answer ( "{\"Set\":{\"LowLimit\":-65486}}" ).find ( "\"Error\"" ) != std::string::npos );
+   HOST_CHECK ( ConfigData.TempLowLimit == 35 && ConfigData.TempHighLimit == 85 );
+
+   // Units and Relay are taken in either case.
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Units\":\"c\",\"Relay\":\"auto\"}}" ).find ( "\"Units\":\"C\"" ) != std::string::npos );
+   HOST_CHECK ( Answer ( "{\"Set\":{\"Units\":\"f\"}}" ).find ( "\"Units\":\"F\"" ) != std::string::npos );
+
+   // Nothing is written to a client whose send buffer is full, not even
+   // when it connects, and once there is room it is sent what it is owed in
+   // order: the descriptor, the history, the answer, and the newest reading.
+   int   Client = HostSocketConnect ( "/?history=3", "sensor.bin" );
+
+   HostSocketSetWritable ( Client, 0 );
+   HostRun ( 20 * HOST_LOOP_MICROS );
+   HostSocketText ( Client, "{\"Set\":{}}" );
+   HostRun ( ConfigData.SensorWaitMax * 1000 );
+
+   HOST_CHECK ( HostSocketFrames ( Client ).size() == 0 );
+
+   HostSocketSetWritable ( Client, HOST_TCP_SEND_BUFFER );
+   HostRun ( HOST_LOOP_MICROS );
+
+   std::vector< HFrame_t >&   Frames = HostSocketFrames ( Client );
+
+   HOST_CHECK ( HostSocketBlocked ( Client ) == 0 );
+   HOST_CHECK ( Frames.size() == 4 );
+   HOST_CHECK ( Frames.size() == 4
+                && Frames[ 0 ].Data.find ( "\"Frame\"" ) != std::string::npos
+                && Frames[ 1 ].Data.find ( "\"History\"" ) != std::string::npos
+                && Frames[ 2 ].Data.find ( "\"State\"" ) != std::string::npos
+                && Frames[ 3 ].Binary == true );
+
+   HostSocketDisconnect ( Client );
+   HostRun ( HOST_LOOP_MICROS );
+
+   // A client that wants part of each reading is sent just that part.
+   Client = HostSocketConnect ( "/", NULL );
+   HostRun ( 20 * HOST_LOOP_MICROS );
+   HostSocketText ( Client, "{\"Subscribe\":{\"Fields\":[\"Seq\"]}}" );
+   HostRun ( ConfigData.SensorWaitMax * 1000 );
+
+   HOST_CHECK ( HostSocketFrames ( Client ).size() >= 2
+                && HostSocketFrames ( Client ).back().Data.find ( "{\"Seq\":" ) == 0
+                && HostSocketFrames ( Client ).back().Data.find ( "\"Value\"" ) == std::string::npos );
+
+   HostSocketDisconnect ( Client );
+   HostRun ( HOST_LOOP_MICROS );
+
+   // A subscription with an interval that would wrap around once it is made
+   // milliseconds, or one below zero, is refused whole, so the client is
+   // still sent all of every reading.
+   for ( const char* Command : { "{\"Subscribe\":{\"Interval\":4294968,\"Fields\":[\"Seq\"]}}",
+                                 "{\"Subscribe\":{\"Interval\":-1,\"Fields\":[\"Seq\"]}}" } )
+   {
+      Client = HostSocketConnect ( "/", NULL );
+      HostRun ( 20 * HOST_LOOP_MICROS );
+      HostSocketText ( Client, Command );
+      HostSocketFrames ( Client ).clear();
+      HostRun ( 3 * ConfigData.SensorWaitMax * 1000 );
+
+      HOST_CHECK ( HostSocketFrames ( Client ).size() >= 2
+                   && HostSocketFrames ( Client ).back().Data.find ( "\"Value\"" ) != std::string::npos );
+
+      HostSocketDisconnect ( Client );
+      HostRun ( HOST_LOOP_MICROS );
+   }
+
+   HOST_CHECK ( HostRestarts() == 0 );
+
+   return HostTestResult();
+}
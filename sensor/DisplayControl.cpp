@@ -0,0 +1,1129 @@
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------< DisplayControl.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that send the SSD1306 screen contents over I2C.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Adafruit_SSD1306::display() sends the whole 1K frame buffer every
+//             time, though a new reading changes only a few characters.  Here
+//             a copy of what the screen is showing is kept, and only the
+//             columns of each page (8 rows) that differ from it are sent.
+//
+//          -  The screen is left in horizontal addressing mode by the Adafruit
+//             library, so setting the page and column range first lets any
+//             rectangle of whole pages be written with one run of data.
+//
+//          -  A flush can also be requested and then sent a few pages at a
+//             time from loop(), so the web servers are not kept waiting for
+//             a whole screen of I2C traffic (see DisplayStep).
+//
+//          -  Every I2C transmission is counted, so the bus time can be
+//             worked out for either clock speed, and the shadow copy can be
+//             read back as an image of exactly what the screen shows.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Flushes that are sent a few pages at a time.
+// 16Oct2026 Scott Vance - I2C bus time, and the screen as a PBM image.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "DisplayControl.h"
+
+
+
+DStats_t DisplayStats;
+
+// What the screen is showing, in the same layout as the frame buffer.
+static uint8_t DisplayShadow[ DISPLAY_WIDTH * DISPLAY_PAGES ];
+
+// False until the shadow is known to match the screen.
+static bool    DisplayValid = false;
+
+// The next page a requested flush will send, DISPLAY_PAGES when no flush is
+// waiting, and the I2C bytes and transmissions the flush has sent so far.
+static uint8_t  FlushPage          = DISPLAY_PAGES;
+static uint32_t FlushBytes         = 0;
+static uint32_t FlushTransmissions = 0;
+
+// What was last drawn in each screen area: the values it was drawn from, and
+// the text that was drawn.
+static struct
+{
+   bool     Valid;
+   uint32_t Key;
+   char     Text[ DISPLAY_CACHE_TEXT ];
+} DisplayCache[ DISPLAY_REGION_COUNT ];
+
+// Readings shown on the trend graph, in sixteenths of a degree celsius, and
+// the scale they were drawn with.
+static int16_t SparkValue[ DISPLAY_WIDTH ];
+static uint8_t SparkHead  = 0;         // Position the next reading is written
+static uint8_t SparkCount = 0;         // Number of readings on the graph
+static int32_t SparkLow   = 0;         // Reading drawn on the bottom row
+static int32_t SparkHigh  = 0;         // Reading drawn on the top row
+static bool    SparkDrawn = false;     // False until the graph is drawn
+
+
+
+static uint32_t SendPage (
+   uint8_t*       Buffer,
+   uint8_t        Page
+);
+
+static uint32_t SendWindow (
+   uint8_t        Page,
+   uint8_t        First,
+   uint8_t        Last
+);
+
+static uint32_t SendData (
+   const uint8_t* Data,
+   uint16_t       Length
+);
+
+static uint32_t SparkColumn (
+   PConfig_t*     ConfigDatah,
+   int16_t        Value,
+   int16_t        Previous
+);
+
+static void SparkPut (
+   uint8_t*       Buffer,
+   uint8_t        Column,
+   uint32_t       Bits
+);
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< DisplayBegin >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start the screen.
+//
+// PARAMETERS: Screen - A pointer to the screen object operate on.
+//
+// RETURNS:    bool - True if the screen was started.
+//
+// NOTES:      -  What the screen shows after it starts is not known, so the
+//                first flush sends all of it.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool DisplayBegin (
+   Adafruit_SSD1306* Screen
+)
+{
+   DisplayValid = false;
+   DisplayResetStats();
+   DisplayCacheClear();
+
+   return Screen->begin ( SSD1306_SWITCHCAPVCC, DISPLAY_I2C_ADDRESS );
+}
+
+// ---------------------------------------------------------< /DisplayBegin >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< DisplayFlush >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send whatever has changed in the frame buffer to the screen.
+//
+// PARAMETERS: Screen - A pointer to the screen object operate on.
+//
+// RETURNS:    uint32_t - The number of I2C bytes sent.
+//
+// NOTES:      -  Each page is compared with the shadow copy, and only the span
+//                from its first to its last changed column is sent.  A page
+//                that is cleared and drawn again the same costs nothing.
+//
+//             -  Used in place of Adafruit_SSD1306::display(), which would
+//                leave the shadow copy out of step with the screen.
+//
+//             -  Sends everything before returning.  Also takes the place of
+//                any flush that DisplayRequest() left waiting.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Pages sent by SendPage, shared with DisplayStep.
+// 16Oct2026 DSVance    - Count the transmissions of the flush.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t DisplayFlush (
+   Adafruit_SSD1306* Screen
+)
+{
+   uint8_t* Buffer = Screen->getBuffer();
+   uint32_t Bytes  = 0;
+
+   FlushTransmissions = 0;
+
+   if ( Buffer != NULL )
+   {
+      Wire.setClock ( DISPLAY_I2C_CLOCK );
+
+      for ( uint8_t Page = 0; Page < DISPLAY_PAGES; Page++ )
+      {
+         Bytes += SendPage ( Buffer, Page );
+      }
+
+      Wire.setClock ( DISPLAY_I2C_IDLE_CLOCK );
+      DisplayValid = true;
+   }
+
+   FlushPage = DISPLAY_PAGES;
+
+   DisplayStats.Flushes++;
+   DisplayStats.Bytes            += Bytes;
+   DisplayStats.LastBytes         = Bytes;
+   DisplayStats.LastTransmissions = FlushTransmissions;
+
+   return Bytes;
+}
+
+// ---------------------------------------------------------< /DisplayFlush >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< DisplayRequest >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Ask for the frame buffer to be sent to the screen by later calls
+//             to DisplayStep().
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:      -  If a flush is already waiting it starts over from the top
+//                page, since pages it has sent may have been drawn again.
+//                Pages that have not changed since are passed over without
+//                sending anything.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void DisplayRequest ()
+{
+   if ( FlushPage >= DISPLAY_PAGES )
+   {
+      FlushBytes         = 0;
+      FlushTransmissions = 0;
+   }
+
+   FlushPage = 0;
+}
+
+// -------------------------------------------------------< /DisplayRequest >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< DisplayPending >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Check whether a flush asked for by DisplayRequest() is waiting
+//             to be finished.
+//
+// PARAMETERS: void
+//
+// RETURNS:    bool - True if DisplayStep() has more to do.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool DisplayPending ()
+{
+   return FlushPage < DISPLAY_PAGES;
+}
+
+// -------------------------------------------------------< /DisplayPending >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< DisplayStep >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send the next part of a flush asked for by DisplayRequest().
+//
+// PARAMETERS: Screen - A pointer to the screen object operate on.
+//
+//             MaxPages - The most pages to send before returning.
+//
+// RETURNS:    bool - True if there is still more to send, false once the
+//                    whole flush has been sent (or none was waiting).
+//
+// NOTES:      -  Meant to be called on each pass through loop(), so that the
+//                time spent here between servicing the web servers is bounded
+//                by MaxPages rather than by how much of the screen changed.
+//
+//             -  Pages with no changes do not count against MaxPages.
+//
+//             -  The flush is counted in the stats once it is finished.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Count the transmissions of the flush.
+//
+// -----------------------------------------------------------------------------
+
+bool DisplayStep (
+   Adafruit_SSD1306* Screen,
+   uint8_t           MaxPages
+)
+{
+   uint8_t* Buffer = Screen->getBuffer();
+   uint8_t  Sent   = 0;
+   uint32_t Bytes;
+
+   if ( FlushPage < DISPLAY_PAGES && Buffer != NULL )
+   {
+      Wire.setClock ( DISPLAY_I2C_CLOCK );
+
+      while ( FlushPage < DISPLAY_PAGES && Sent < MaxPages )
+      {
+         Bytes = SendPage ( Buffer, FlushPage );
+         FlushPage++;
+
+         if ( Bytes > 0 )
+         {
+            FlushBytes += Bytes;
+            Sent++;
+         }
+      }
+
+      Wire.setClock ( DISPLAY_I2C_IDLE_CLOCK );
+
+      if ( FlushPage >= DISPLAY_PAGES )
+      {
+         DisplayValid = true;
+
+         DisplayStats.Flushes++;
+         DisplayStats.Bytes            += FlushBytes;
+         DisplayStats.LastBytes         = FlushBytes;
+         DisplayStats.LastTransmissions = FlushTransmissions;
+      }
+   }
+
+   return FlushPage < DISPLAY_PAGES;
+}
+
+// ----------------------------------------------------------< /DisplayStep >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< DisplayFullBytes >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the number of I2C bytes Adafruit_SSD1306::display() sends
+//             for the whole frame buffer, to compare against.
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint32_t - The number of I2C bytes.
+//
+// NOTES:      -  Two command transmissions set the page and column range, the
+//                first with 5 command bytes and the second with 1.  The frame
+//                buffer then follows in transmissions of DISPLAY_WIRE_MAX - 1
+//                data bytes.  Each transmission also has an address byte and a
+//                control byte.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t DisplayFullBytes ()
+{
+   uint32_t Length = DISPLAY_WIDTH * DISPLAY_PAGES;
+   uint32_t Chunks = ( Length + DISPLAY_WIRE_MAX - 2 ) / ( DISPLAY_WIRE_MAX - 1 );
+
+   return ( 2 + 5 ) + ( 2 + 1 ) + Length + ( 2 * Chunks );
+}
+
+// -----------------------------------------------------< /DisplayFullBytes >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------< DisplayFullTransmissions >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the number of I2C transmissions Adafruit_SSD1306::display()
+//             uses for the whole frame buffer, to compare against.
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint32_t - The number of I2C transmissions.
+//
+// NOTES:      -  See DisplayFullBytes().
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t DisplayFullTransmissions ()
+{
+   uint32_t Length = DISPLAY_WIDTH * DISPLAY_PAGES;
+
+   return 2 + ( Length + DISPLAY_WIRE_MAX - 2 ) / ( DISPLAY_WIRE_MAX - 1 );
+}
+
+// ---------------------------------------------< /DisplayFullTransmissions >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< DisplayBusMicros >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Work out how long some I2C traffic keeps the bus busy.
+//
+// PARAMETERS: Bytes - The number of bytes sent, counting address bytes.
+//
+//             Transmissions - The number of transmissions they were sent in.
+//
+//             Clock - The I2C clock in Hz.
+//
+// RETURNS:    uint32_t - The bus time in microseconds.
+//
+// NOTES:      -  Each byte takes 9 clocks with its acknowledge bit, and each
+//                transmission about 2 more for its start and stop conditions.
+//                Clock stretching and the gaps between transmissions are not
+//                counted, so the real time is a little longer.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t DisplayBusMicros (
+   uint32_t          Bytes,
+   uint32_t          Transmissions,
+   uint32_t          Clock
+)
+{
+   uint64_t Clocks = (uint64_t) Bytes * 9 + (uint64_t) Transmissions * 2;
+
+   return (uint32_t) ( Clocks * 1000000 / Clock );
+}
+
+// -----------------------------------------------------< /DisplayBusMicros >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< DisplayPBMPage >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Copy one page (8 rows) of what the screen is showing into the
+//             pixel rows of a binary PBM image.
+//
+// PARAMETERS: Page - The page to copy.
+//
+//             Out - Where to put the DISPLAY_PBM_PAGE bytes of image rows.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Comes from the shadow copy, so it shows what was sent to the
+//                screen rather than what has been drawn but not sent yet.  It
+//                is all off until the first flush.
+//
+//             -  A PBM image packs each row 8 pixels to a byte, leftmost pixel
+//                in the high bit, and a set bit is black.  Lit pixels are made
+//                white so the image looks like the screen.
+//
+//             -  The header, "P4\n128 64\n", is left to the caller.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void DisplayPBMPage (
+   uint8_t           Page,
+   uint8_t*          Out
+)
+{
+   uint8_t* Shadow = &DisplayShadow[ Page * DISPLAY_WIDTH ];
+
+   for ( uint8_t Row = 0; Row < 8; Row++ )
+   {
+      for ( uint8_t Column = 0; Column < DISPLAY_WIDTH; Column += 8 )
+      {
+         uint8_t Bits = 0;
+
+         for ( uint8_t i = 0; i < 8; i++ )
+         {
+            Bits = ( Bits << 1 ) | ( ( Shadow[ Column + i ] >> Row ) & 1 );
+         }
+
+         *Out++ = ~Bits;
+      }
+   }
+}
+
+// -------------------------------------------------------< /DisplayPBMPage >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< DisplayClearRect >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Turn off every pixel in a rectangle of the frame buffer.
+//
+// PARAMETERS: Screen - A pointer to the screen object operate on.
+//
+//             Left - The first column to clear.
+//
+//             Top - The first row to clear.
+//
+//             Width - The number of columns to clear.
+//
+//             Height - The number of rows to clear.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Works on the frame buffer layout directly: each byte is one
+//                column of a page (8 rows), with the top row in bit 0.  A page
+//                the rectangle covers completely is cleared a whole byte at a
+//                time, and the pages at its top and bottom edges with a mask.
+//
+//             -  The rectangle is clipped to the screen.  The screen is never
+//                rotated by this sketch, so rotation is not allowed for.
+//
+//             -  Nothing needs marking for the flush, DisplayFlush() finds the
+//                change by comparing with what the screen is showing.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void DisplayClearRect (
+   Adafruit_SSD1306* Screen,
+   int16_t           Left,
+   int16_t           Top,
+   int16_t           Width,
+   int16_t           Height
+)
+{
+   uint8_t* Buffer = Screen->getBuffer();
+   int16_t  Right  = min ( (int16_t) ( Left + Width ), (int16_t) DISPLAY_WIDTH );
+   int16_t  Bottom = min ( (int16_t) ( Top + Height ), (int16_t) DISPLAY_HEIGHT );
+
+   Left = max ( Left, (int16_t) 0 );
+   Top  = max ( Top,  (int16_t) 0 );
+
+   if ( Buffer != NULL && Left < Right && Top < Bottom )
+   {
+      for ( uint8_t Page = Top / 8; Page <= ( Bottom - 1 ) / 8; Page++ )
+      {
+         uint8_t* Row   = &Buffer[ Page * DISPLAY_WIDTH ];
+         uint8_t  First = max ( Top, (int16_t) ( Page * 8 ) ) - Page * 8;
+         uint8_t  Last  = min ( Bottom, (int16_t) ( Page * 8 + 8 ) ) - Page * 8;
+         uint8_t  Mask  = ( 0xff << First ) & ( 0xff >> ( 8 - Last ) );
+
+         if ( Mask == 0xff )
+         {
+            memset ( &Row[ Left ], 0, Right - Left );
+         }
+
+         else
+         {
+            for ( int16_t i = Left; i < Right; i++ )
+            {
+               Row[ i ] &= ~Mask;
+            }
+         }
+      }
+   }
+}
+
+// -----------------------------------------------------< /DisplayClearRect >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< DisplayResetStats >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Clear the counts of what has been sent to the screen.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void DisplayResetStats ()
+{
+   memset ( &DisplayStats, 0, sizeof ( DisplayStats ) );
+}
+
+// ----------------------------------------------------< /DisplayResetStats >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< DisplayCacheKey >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Check whether a screen area was last drawn from the same values,
+//             before going to the trouble of formatting them.
+//
+// PARAMETERS: Region - The screen area (DISPLAY_REGION_...).
+//
+//             Key - The values the area is drawn from, packed in any way that
+//                   gives a different key when any of them differ.
+//
+// RETURNS:    bool - True if the area is already showing these values and can
+//                    be left alone, false if DisplayCacheUpdate() is needed.
+//
+// NOTES:      -  A match is counted as a skipped redraw.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool DisplayCacheKey (
+   uint8_t           Region,
+   uint32_t          Key
+)
+{
+   bool Same = (  Region < DISPLAY_REGION_COUNT
+               && DisplayCache[ Region ].Valid == true
+               && DisplayCache[ Region ].Key == Key
+               );
+
+   if ( Same == true )
+   {
+      DisplayStats.Skips++;
+   }
+
+   return Same;
+}
+
+// ------------------------------------------------------< /DisplayCacheKey >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------< DisplayCacheUpdate >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Remember what a screen area shows, and check whether it needs to
+//             be drawn again.
+//
+// PARAMETERS: Region - The screen area (DISPLAY_REGION_...).
+//
+//             Key - The values the area is drawn from (see DisplayCacheKey).
+//
+//             Text - Everything visible in the area, as text.
+//
+// RETURNS:    bool - True if the text differs from what the area is showing,
+//                    so it must be drawn, false if it can be left alone.
+//
+// NOTES:      -  Different values often look the same once rounded for the
+//                screen, so the text is what decides.
+//
+//             -  The result is counted as a redraw or a skipped redraw.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool DisplayCacheUpdate (
+   uint8_t           Region,
+   uint32_t          Key,
+   const char*       Text
+)
+{
+   bool Changed = true;
+
+   if ( Region < DISPLAY_REGION_COUNT )
+   {
+      Changed = (  DisplayCache[ Region ].Valid == false
+                || strncmp ( DisplayCache[ Region ].Text, Text, DISPLAY_CACHE_TEXT - 1 ) != 0
+                );
+
+      strncpy ( DisplayCache[ Region ].Text, Text, DISPLAY_CACHE_TEXT - 1 );
+      DisplayCache[ Region ].Text[ DISPLAY_CACHE_TEXT - 1 ] = 0;
+      DisplayCache[ Region ].Key   = Key;
+      DisplayCache[ Region ].Valid = true;
+   }
+
+   if ( Changed == true )
+   {
+      DisplayStats.Redraws++;
+   }
+
+   else
+   {
+      DisplayStats.Skips++;
+   }
+
+   return Changed;
+}
+
+// ---------------------------------------------------< /DisplayCacheUpdate >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< DisplayCacheClear >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Forget what every screen area shows, so each is drawn again.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:      -  Needed whenever the screen is drawn over by anything other
+//                than the cached areas, for example by clearDisplay().
+//
+//             -  The trend graph is drawn again in full with the next reading.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Forget the trend graph too.
+//
+// -----------------------------------------------------------------------------
+
+void DisplayCacheClear ()
+{
+   for ( uint8_t i = 0; i < DISPLAY_REGION_COUNT; i++ )
+   {
+      DisplayCache[ i ].Valid = false;
+   }
+
+   SparkDrawn = false;
+}
+
+// ----------------------------------------------------< /DisplayCacheClear >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< DisplaySparkline >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add a reading to the trend graph across the bottom of the screen.
+//
+// PARAMETERS: Screen - A pointer to the screen object operate on.
+//
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+//             Value - The reading in sixteenths of a degree celsius, or
+//                     FIXED_DISCONNECTED to leave a gap.
+//
+// RETURNS:    bool - True if the graph was drawn, so the screen needs to be
+//                    flushed.
+//
+// NOTES:      -  The graph covers pages SPARK_FIRST_PAGE onward, one column per
+//                reading with the newest at the right.  Each reading moves the
+//                columns already there one to the left, a memmove of each page,
+//                and draws just the one new column.  The cost is the same for
+//                every reading.
+//
+//             -  The scale is fixed by the temperature limits, with an eighth
+//                of the gap between them to spare above and below, so that a
+//                new reading never needs the old ones drawn again.  Only when
+//                the limits or the units change is the whole graph drawn again,
+//                from the readings kept here.
+//
+//             -  Each column joins its point to the one before, so that a fast
+//                change still shows as a line.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool DisplaySparkline (
+   Adafruit_SSD1306* Screen,
+   PConfig_t*        ConfigDatah,
+   int16_t           Value
+)
+{
+   uint8_t* Buffer   = Screen->getBuffer();
+   int32_t  Low      = FIXED_FROM_INT ( ConfigDatah->TempLowLimit );
+   int32_t  High     = FIXED_FROM_INT ( ConfigDatah->TempHighLimit );
+   int32_t  Spare    = max ( ( High - Low ) / 8, (int32_t) FIXED_ONE );
+   bool     Drawn    = false;
+   int16_t  Previous = ( SparkCount > 0 )
+                       ? SparkValue[ ( SparkHead + DISPLAY_WIDTH - 1 ) % DISPLAY_WIDTH ]
+                       : FIXED_DISCONNECTED;
+
+   SparkValue[ SparkHead ] = Value;
+   SparkHead = ( SparkHead + 1 ) % DISPLAY_WIDTH;
+
+   if ( SparkCount < DISPLAY_WIDTH )
+   {
+      SparkCount++;
+   }
+
+   // The limits are in the display units, so a change of units changes them.
+   Low  = Low - Spare;
+   High = max ( High + Spare, Low + FIXED_ONE );
+
+   if ( Buffer != NULL )
+   {
+      if ( SparkDrawn == false || Low != SparkLow || High != SparkHigh )
+      {
+         // Draw the whole graph, oldest reading first.
+         uint8_t Index = ( SparkHead + DISPLAY_WIDTH - SparkCount ) % DISPLAY_WIDTH;
+
+         SparkLow   = Low;
+         SparkHigh  = High;
+         SparkDrawn = true;
+         Previous   = FIXED_DISCONNECTED;
+
+         for ( uint8_t Column = 0; Column < DISPLAY_WIDTH; Column++ )
+         {
+            uint32_t Bits = 0;
+
+            if ( Column >= DISPLAY_WIDTH - SparkCount )
+            {
+               Bits     = SparkColumn ( ConfigDatah, SparkValue[ Index ], Previous );
+               Previous = SparkValue[ Index ];
+               Index    = ( Index + 1 ) % DISPLAY_WIDTH;
+            }
+
+            SparkPut ( Buffer, Column, Bits );
+         }
+      }
+
+      else
+      {
+         for ( uint8_t Page = SPARK_FIRST_PAGE; Page < SPARK_FIRST_PAGE + SPARK_PAGES; Page++ )
+         {
+            uint8_t* Row = &Buffer[ Page * DISPLAY_WIDTH ];
+
+            memmove ( &Row[ 0 ], &Row[ 1 ], DISPLAY_WIDTH - 1 );
+         }
+
+         SparkPut ( Buffer, DISPLAY_WIDTH - 1, SparkColumn ( ConfigDatah, Value, Previous ) );
+      }
+
+      Drawn = true;
+   }
+
+   return Drawn;
+}
+
+// -----------------------------------------------------< /DisplaySparkline >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< SendPage >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send whatever has changed in one page of the frame buffer.
+//
+// PARAMETERS: Buffer - The frame buffer.
+//
+//             Page - The page (8 rows) to send.
+//
+// RETURNS:    uint32_t - The number of I2C bytes sent, zero if the page has
+//                        not changed.
+//
+// NOTES:      -  Only the span from the first to the last column that differs
+//                from the shadow copy is sent, or the whole page when the
+//                shadow copy is not valid yet.
+//
+//             -  The caller sets the I2C clock.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development (from DisplayFlush).
+//
+// -----------------------------------------------------------------------------
+
+static uint32_t SendPage (
+   uint8_t*       Buffer,
+   uint8_t        Page
+)
+{
+   uint8_t* Row    = &Buffer[ Page * DISPLAY_WIDTH ];
+   uint8_t* Shadow = &DisplayShadow[ Page * DISPLAY_WIDTH ];
+   int16_t  First  = 0;
+   int16_t  Last   = DISPLAY_WIDTH - 1;
+   uint32_t Bytes  = 0;
+
+   if ( DisplayValid == true )
+   {
+      while ( First < DISPLAY_WIDTH && Row[ First ] == Shadow[ First ] )
+      {
+         First++;
+      }
+
+      while ( Last > First && Row[ Last ] == Shadow[ Last ] )
+      {
+         Last--;
+      }
+   }
+
+   if ( First < DISPLAY_WIDTH )
+   {
+      Bytes += SendWindow ( Page, First, Last );
+      Bytes += SendData ( &Row[ First ], Last - First + 1 );
+
+      memcpy ( &Shadow[ First ], &Row[ First ], Last - First + 1 );
+      DisplayStats.Pages++;
+   }
+
+   return Bytes;
+}
+
+// -------------------------------------------------------------< /SendPage >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< SendWindow >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Set the screen RAM window the next data goes to.
+//
+// PARAMETERS: Page - The page (8 rows) to write.
+//
+//             First - The first column to write.
+//
+//             Last - The last column to write.
+//
+// RETURNS:    uint32_t - The number of I2C bytes sent.
+//
+// NOTES:      -  Both commands go in one transmission.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Count the transmission.
+//
+// -----------------------------------------------------------------------------
+
+static uint32_t SendWindow (
+   uint8_t        Page,
+   uint8_t        First,
+   uint8_t        Last
+)
+{
+   const uint8_t Commands[] =
+   {
+      DISPLAY_CONTROL_COMMAND,
+      SSD1306_PAGEADDR,    Page,  Page,
+      SSD1306_COLUMNADDR,  First, Last
+   };
+
+   Wire.beginTransmission ( DISPLAY_I2C_ADDRESS );
+   Wire.write ( Commands, sizeof ( Commands ) );
+   Wire.endTransmission();
+
+   DisplayStats.Transmissions++;
+   FlushTransmissions++;
+
+   return 1 + sizeof ( Commands );
+}
+
+// -----------------------------------------------------------< /SendWindow >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< SendData >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send bytes to the screen RAM window.
+//
+// PARAMETERS: Data - The bytes to send.
+//
+//             Length - The number of bytes to send.
+//
+// RETURNS:    uint32_t - The number of I2C bytes sent.
+//
+// NOTES:      -  The Wire buffer is small, so the data is split into as many
+//                transmissions as it takes, each with its own control byte.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Count the transmissions.
+//
+// -----------------------------------------------------------------------------
+
+static uint32_t SendData (
+   const uint8_t* Data,
+   uint16_t       Length
+)
+{
+   uint32_t Bytes = 0;
+
+   while ( Length > 0 )
+   {
+      uint16_t Chunk = min ( Length, (uint16_t) ( DISPLAY_WIRE_MAX - 1 ) );
+
+      Wire.beginTransmission ( DISPLAY_I2C_ADDRESS );
+      Wire.write ( DISPLAY_CONTROL_DATA );
+      Wire.write ( Data, Chunk );
+      Wire.endTransmission();
+
+      Bytes  += 2 + Chunk;
+      Data   += Chunk;
+      Length -= Chunk;
+
+      DisplayStats.Transmissions++;
+      FlushTransmissions++;
+   }
+
+   return Bytes;
+}
+
+// -------------------------------------------------------------< /SendData >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< SparkColumn >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Work out which pixels of one trend graph column are on.
+//
+// PARAMETERS: ConfigDatah - Pointer to the configuration data structure.
+//
+//             Value - The reading for the column, in sixteenths of a degree
+//                     celsius, or FIXED_DISCONNECTED.
+//
+//             Previous - The reading for the column to the left, the same way.
+//
+// RETURNS:    uint32_t - One bit per row of the graph, bit 0 at the top.
+//
+// NOTES:      -  Readings off the scale are drawn on the top or bottom row.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static uint32_t SparkColumn (
+   PConfig_t*     ConfigDatah,
+   int16_t        Value,
+   int16_t        Previous
+)
+{
+   uint32_t Bits = 0;
+   int32_t  Rows[ 2 ];
+   int16_t  Readings[ 2 ] = { Value, Previous };
+
+   if ( Value != FIXED_DISCONNECTED )
+   {
+      for ( uint8_t i = 0; i < 2; i++ )
+      {
+         // A missing reading to the left just makes this a single point.
+         int32_t Reading = FixedUnits ( ConfigDatah,
+                                        ( Readings[ i ] != FIXED_DISCONNECTED ) ? Readings[ i ] : Value
+                                      );
+
+         Rows[ i ] = ( SPARK_HEIGHT - 1 )
+                   - ( Reading - SparkLow ) * ( SPARK_HEIGHT - 1 ) / ( SparkHigh - SparkLow );
+         Rows[ i ] = constrain ( Rows[ i ], 0, SPARK_HEIGHT - 1 );
+      }
+
+      for ( int32_t Row = min ( Rows[ 0 ], Rows[ 1 ] ); Row <= max ( Rows[ 0 ], Rows[ 1 ] ); Row++ )
+      {
+         Bits |= 1UL << Row;
+      }
+   }
+
+   return Bits;
+}
+
+// ----------------------------------------------------------< /SparkColumn >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< SparkPut >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write one column of the trend graph to the frame buffer.
+//
+// PARAMETERS: Buffer - The frame buffer.
+//
+//             Column - The screen column to write.
+//
+//             Bits - One bit per row of the graph, bit 0 at the top.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Every page of the graph is one byte of the column.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void SparkPut (
+   uint8_t*       Buffer,
+   uint8_t        Column,
+   uint32_t       Bits
+)
+{
+   for ( uint8_t i = 0; i < SPARK_PAGES; i++ )
+   {
+      Buffer[ ( SPARK_FIRST_PAGE + i ) * DISPLAY_WIDTH + Column ] = ( Bits >> ( i * 8 ) ) & 0xff;
+   }
+}
+
+// -------------------------------------------------------------< /SparkPut >---
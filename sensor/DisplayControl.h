@@ -0,0 +1,209 @@
+#ifndef DISPLAY_CONTROL
+#define DISPLAY_CONTROL
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< DisplayControl.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that send the SSD1306
+//          screen contents over I2C.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Drawing is still done with the Adafruit library, into its frame
+//             buffer in RAM.  Only sending the frame buffer to the screen is
+//             done here, in place of Adafruit_SSD1306::display().
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Flushes that are sent a few pages at a time.
+// 16Oct2026 Scott Vance - I2C bus time, and the screen as a PBM image.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <Wire.h>                // Two Wire Interface communication
+#include <Adafruit_SSD1306.h>    // Screen driver for SSD1306 OLED screen
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+#include "EEPROMConfig.h"        // Read a write configuration to FLASH storage
+#include "FixedPoint.h"          // Fixed point temperature values
+
+
+
+//
+// The screen and how it is connected.
+//
+#define DISPLAY_I2C_ADDRESS     0x3c     // I2C address of the SSD1306
+#define DISPLAY_WIDTH           128      // Width in pixels
+#define DISPLAY_HEIGHT          64       // Height in pixels
+#define DISPLAY_PAGES           ( DISPLAY_HEIGHT / 8 )
+
+//
+// I2C clock while sending to the screen, and to go back to afterwards.  The
+// same values the Adafruit library uses.
+//
+#define DISPLAY_I2C_CLOCK       400000
+#define DISPLAY_I2C_IDLE_CLOCK  100000
+
+// Most bytes sent in one I2C transmission, including the control byte.
+#define DISPLAY_WIRE_MAX        32
+
+// Bytes in one page (8 rows) of a binary PBM image of the screen.
+#define DISPLAY_PBM_PAGE        ( DISPLAY_WIDTH / 8 * 8 )
+
+//
+// Most changed pages DisplayStep() sends on one pass through loop().  A whole
+// changed page is about 3.5 milliseconds of I2C traffic.  Setting this to
+// DISPLAY_PAGES sends a whole flush at once, the way it was done before, to
+// compare the longest loop() stall in /TimingStats.json.
+//
+#define DISPLAY_STEP_PAGES      1
+
+//
+// Screen areas remembered by the render cache, and the longest text kept for
+// each one.
+//
+#define DISPLAY_REGION_STATE    0        // Device ON / OFF line
+#define DISPLAY_REGION_VALUE    1        // Temperature line
+#define DISPLAY_REGION_COUNT    2
+#define DISPLAY_CACHE_TEXT      24
+
+//
+// The trend graph across the bottom of the screen, one column per reading.
+//
+#define SPARK_FIRST_PAGE        5        // Top page of the graph (row 40)
+#define SPARK_PAGES             3        // Pages the graph covers
+#define SPARK_HEIGHT            ( SPARK_PAGES * 8 )
+
+//
+// SSD1306 control bytes, sent first in each transmission.
+//
+#define DISPLAY_CONTROL_COMMAND 0x00     // The rest are commands
+#define DISPLAY_CONTROL_DATA    0x40     // The rest are display RAM data
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< DISPLAY_STATS >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: Counts of what has been sent to the screen.
+//
+// FIELDS:  Flushes - The number of flushes finished, by DisplayFlush() or
+//                    by DisplayStep().
+//
+//          Pages - The number of pages (8 rows) sent, at most DISPLAY_PAGES
+//                  per flush.
+//
+//          Bytes - The number of I2C bytes sent, counting the address byte
+//                  of each transmission.
+//
+//          LastBytes - The number of I2C bytes sent by the most recent flush.
+//
+//          Transmissions - The number of I2C transmissions, each of which
+//                          costs a start and a stop condition on the bus.
+//
+//          LastTransmissions - The number of I2C transmissions sent by the
+//                              most recent flush.
+//
+//          Redraws - Screen areas drawn because what they show changed.
+//
+//          Skips - Screen areas left alone because nothing visible changed.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Flushes sent by DisplayStep() are counted too.
+// 16Oct2026 Scott Vance - I2C transmissions.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct DISPLAY_STATS
+{
+   uint32_t Flushes;
+   uint32_t Pages;
+   uint32_t Bytes;
+   uint32_t LastBytes;
+   uint32_t Transmissions;
+   uint32_t LastTransmissions;
+   uint32_t Redraws;
+   uint32_t Skips;
+} DStats_t;
+
+// --------------------------------------------------------< /DISPLAY_STATS >---
+
+
+
+extern DStats_t DisplayStats;
+
+
+
+bool DisplayBegin (
+   Adafruit_SSD1306* Screen
+);
+
+uint32_t DisplayFlush (
+   Adafruit_SSD1306* Screen
+);
+
+void DisplayRequest ();
+
+bool DisplayPending ();
+
+bool DisplayStep (
+   Adafruit_SSD1306* Screen,
+   uint8_t           MaxPages
+);
+
+uint32_t DisplayFullBytes ();
+
+uint32_t DisplayFullTransmissions ();
+
+uint32_t DisplayBusMicros (
+   uint32_t          Bytes,
+   uint32_t          Transmissions,
+   uint32_t          Clock
+);
+
+void DisplayPBMPage (
+   uint8_t           Page,
+   uint8_t*          Out
+);
+
+void DisplayClearRect (
+   Adafruit_SSD1306* Screen,
+   int16_t           Left,
+   int16_t           Top,
+   int16_t           Width,
+   int16_t           Height
+);
+
+void DisplayResetStats ();
+
+bool DisplayCacheKey (
+   uint8_t           Region,
+   uint32_t          Key
+);
+
+bool DisplayCacheUpdate (
+   uint8_t           Region,
+   uint32_t          Key,
+   const char*       Text
+);
+
+void DisplayCacheClear ();
+
+bool DisplaySparkline (
+   Adafruit_SSD1306* Screen,
+   PConfig_t*        ConfigDatah,
+   int16_t           Value
+);
+
+
+
+#endif   // DISPLAY_CONTROL
@@ -51,7 +51,7 @@ void ClearROM (
    uint32_t Offset
 )
 {
-   for ( int i = Offset; i < Size; i++ ) 
+   for ( uint32_t i = Offset; i < Size; i++ ) 
    {
       EEPROM.write ( i, 0 );
    }
@@ -136,6 +136,13 @@ void SetROMDefaults ( PConfig_t* ConfigDatah )
       ConfigDatah->LabelLength          = 0;
       memset ( ConfigDatah->Label, 0, sizeof ( ConfigDatah->Label ) );
 
+      ConfigDatah->SensorWaitMin        =  5 * 1000;
+      ConfigDatah->SensorWaitMax        = 60 * 1000;
+
+      ConfigDatah->TempHysteresis       = 10;
+      ConfigDatah->RelayMinOnTime       = 60;
+      ConfigDatah->RelayMinOffTime      = 60;
+
       EEPROM.put ( PCONFIG_OFFSET, *ConfigDatah );
       EEPROM.commit();
    }
@@ -145,6 +152,113 @@ void SetROMDefaults ( PConfig_t* ConfigDatah )
 
 
 
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< CheckROMValues >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Make sure the values kept in what used to be the spare bytes
+//             (offsets 139 to 151) are ones the configuration page could have
+//             stored, and turn off the settings that are not.
+//
+// PARAMETERS: ConfigDatah - Pointer to the configuration data structure.
+//
+// RETURNS:    bool - True if any stored value had to be changed.
+//
+// NOTES:      -  The layout version was not changed when these values were
+//                added, so a board set up by older software reads whatever
+//                was left in the spare bytes, which is 0xFF on flash that was
+//                never written.  A value of zero turns each setting off, so
+//                such a board goes on working the way it did.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool CheckROMValues ( PConfig_t* ConfigDatah )
+{
+   bool  Changed = false;
+
+   if ( ConfigDatah != NULL )
+   {
+      if (  ConfigDatah->SensorWaitMin > PCONFIG_MAX_WAIT
+         || ConfigDatah->SensorWaitMax > PCONFIG_MAX_WAIT
+         || ConfigDatah->SensorWaitMin % 1000 != 0
+         || ConfigDatah->SensorWaitMax % 1000 != 0
+         || ( ConfigDatah->SensorWaitMax > 0 && ConfigDatah->SensorWaitMin > ConfigDatah->SensorWaitMax )
+         )
+      {
+         Serial.printf ( "WARNING: Stored wait limits %u and %u are not valid, turning them off \n",
+                         ConfigDatah->SensorWaitMin,
+                         ConfigDatah->SensorWaitMax
+                       );
+
+         ConfigDatah->SensorWaitMin = 0;
+         ConfigDatah->SensorWaitMax = 0;
+
+         SetROMValue ( PCONFIG_OFFSET_SENSORWAITMIN,
+                       (uint8_t*) &ConfigDatah->SensorWaitMin,
+                       sizeof ( ConfigDatah->SensorWaitMin )
+                     );
+
+         SetROMValue ( PCONFIG_OFFSET_SENSORWAITMAX,
+                       (uint8_t*) &ConfigDatah->SensorWaitMax,
+                       sizeof ( ConfigDatah->SensorWaitMax )
+                     );
+
+         Changed = true;
+      }
+
+      if ( ConfigDatah->TempHysteresis > PCONFIG_MAX_HYSTERESIS )
+      {
+         Serial.printf ( "WARNING: Stored hysteresis %u is not valid, turning it off \n",
+                         ConfigDatah->TempHysteresis
+                       );
+
+         ConfigDatah->TempHysteresis = 0;
+
+         SetROMValue ( PCONFIG_OFFSET_TEMPHYSTERESIS,
+                       (uint8_t*) &ConfigDatah->TempHysteresis,
+                       sizeof ( ConfigDatah->TempHysteresis )
+                     );
+
+         Changed = true;
+      }
+
+      if (  ConfigDatah->RelayMinOnTime  > PCONFIG_MAX_RELAY_TIME
+         || ConfigDatah->RelayMinOffTime > PCONFIG_MAX_RELAY_TIME
+         )
+      {
+         Serial.printf ( "WARNING: Stored relay minimum times %u and %u are not valid, turning them off \n",
+                         ConfigDatah->RelayMinOnTime,
+                         ConfigDatah->RelayMinOffTime
+                       );
+
+         ConfigDatah->RelayMinOnTime  = 0;
+         ConfigDatah->RelayMinOffTime = 0;
+
+         SetROMValue ( PCONFIG_OFFSET_RELAYMINONTIME,
+                       (uint8_t*) &ConfigDatah->RelayMinOnTime,
+                       sizeof ( ConfigDatah->RelayMinOnTime )
+                     );
+
+         SetROMValue ( PCONFIG_OFFSET_RELAYMINOFFTIME,
+                       (uint8_t*) &ConfigDatah->RelayMinOffTime,
+                       sizeof ( ConfigDatah->RelayMinOffTime )
+                     );
+
+         Changed = true;
+      }
+   }
+
+   return Changed;
+}
+
+// -------------------------------------------------------< /CheckROMValues >---
+
+
+
 // -----------------------------------------------------------------------------
 // ---------------------------------------------------------< ShowROMValues >---
 // -----------------------------------------------------------------------------
@@ -232,6 +346,13 @@ void ShowROMValues (
 
       Serial.printf ( "   LabelLength .......... %u \n", ConfigDatah->LabelLength );
       Serial.printf ( "   Label ................ %.*s \n", ConfigDatah->LabelLength, ConfigDatah->Label );
+
+      Serial.printf ( "   SensorWaitMin ........ %u \n", ConfigDatah->SensorWaitMin );
+      Serial.printf ( "   SensorWaitMax ........ %u \n", ConfigDatah->SensorWaitMax );
+
+      Serial.printf ( "   TempHysteresis ....... %u \n", ConfigDatah->TempHysteresis );
+      Serial.printf ( "   RelayMinOnTime ....... %u \n", ConfigDatah->RelayMinOnTime );
+      Serial.printf ( "   RelayMinOffTime ...... %u \n", ConfigDatah->RelayMinOffTime );
    }
 }
 
@@ -66,6 +66,21 @@
 //
 //          TempLowLimit - Relay is turned OFF when temperature is LOWER.
 //
+//          TempHysteresis - Tenths of a degree the temperature must come back
+//                           inside the limits before the relay is turned
+//                           back ON.
+//
+//          SensorWaitMin - Shortest adaptive time in MILLISECONDS between
+//                          sensor reads, or zero to always use SensorWaitTime.
+//
+//          SensorWaitMax - Longest adaptive time in MILLISECONDS between
+//                          sensor reads, or zero to always use SensorWaitTime.
+//
+//          RelayMinOnTime - Fewest SECONDS the relay stays ON once turned ON.
+//
+//          RelayMinOffTime - Fewest SECONDS the relay stays OFF once turned
+//                            OFF.
+//
 //          Spare - Room to expand without changing total stored size.
 //
 //          WifiSSIDLength - Length in bytes of the stored SSID string.
@@ -109,6 +124,12 @@
 #define PCONFIG_MAX_PASSWORD  31
 #define PCONFIG_MAX_LABEL     31
 
+#define PCONFIG_MAX_WAIT           ( 24UL * 60 * 60 * 1000 )  // Milliseconds
+#define PCONFIG_MAX_HYSTERESIS     100                        // Tenths of a degree
+#define PCONFIG_MAX_RELAY_TIME     3600                       // Seconds
+#define PCONFIG_MIN_LIMIT          ( -2048 )                  // Whole degrees
+#define PCONFIG_MAX_LIMIT          2047                       // Whole degrees
+
 typedef struct PROGRAM_CONFIG_DATA
 {                                                        // Offset
    uint16_t Size;                                        //     0
@@ -137,7 +158,14 @@ typedef struct PROGRAM_CONFIG_DATA
    char     Label[ PCONFIG_MAX_LABEL + 1 ];              //   106
    uint8_t  LabelLength;                                 //   138
 
-   uint8_t  Spare[ 37 ];                                 //   139
+   uint8_t  TempHysteresis;                              //   139
+   uint32_t SensorWaitMin;                               //   140
+   uint32_t SensorWaitMax;                               //   144
+
+   uint16_t RelayMinOnTime;                              //   148
+   uint16_t RelayMinOffTime;                             //   150
+
+   uint8_t  Spare[ 24 ];                                 //   152
 
 }  PConfig_t;
 
@@ -187,6 +215,11 @@ typedef struct PROGRAM_CONFIG_DATA
 #define  PCONFIG_OFFSET_WIFIPASSWORDLENGTH      ( PCONFIG_OFFSET + 105 )
 #define  PCONFIG_OFFSET_LABEL                   ( PCONFIG_OFFSET + 106 )
 #define  PCONFIG_OFFSET_LABELLENGTH             ( PCONFIG_OFFSET + 138 )
+#define  PCONFIG_OFFSET_TEMPHYSTERESIS          ( PCONFIG_OFFSET + 139 )
+#define  PCONFIG_OFFSET_SENSORWAITMIN           ( PCONFIG_OFFSET + 140 )
+#define  PCONFIG_OFFSET_SENSORWAITMAX           ( PCONFIG_OFFSET + 144 )
+#define  PCONFIG_OFFSET_RELAYMINONTIME          ( PCONFIG_OFFSET + 148 )
+#define  PCONFIG_OFFSET_RELAYMINOFFTIME         ( PCONFIG_OFFSET + 150 )
 
 // --------------------------------------------------< /PROGRAM_CONFIG_DATA >---
 
@@ -199,6 +232,8 @@ void ClearROM (
 
 void SetROMDefaults ( PConfig_t* ConfigData );
 
+bool CheckROMValues ( PConfig_t* ConfigData );
+
 void ShowROMValues (
    PConfig_t*  ConfigData,
    const char* Label
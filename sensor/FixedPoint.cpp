@@ -0,0 +1,163 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< FixedPoint.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that handle temperatures as fixed point integers, so the
+//          sensor readings never need floating point arithmetic.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "FixedPoint.h"
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< FixedC2F >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Convert a fixed point temperature from celsius to fahrenheit.
+//
+// PARAMETERS: Value - The temperature in sixteenths of a degree celsius.
+//
+// RETURNS:    int32_t - The temperature in sixteenths of a degree fahrenheit.
+//
+// NOTES:      -  The division is rounded to the nearest sixteenth, rather than
+//                toward zero, so positive and negative values are treated the
+//                same way.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+int32_t FixedC2F (
+   int32_t  Value
+)
+{
+   int32_t Scaled = Value * 9;
+
+   Scaled += ( Scaled < 0 ) ? -2 : 2;
+
+   return ( Scaled / 5 ) + FIXED_FROM_INT ( 32 );
+}
+
+// -------------------------------------------------------------< /FixedC2F >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< FixedUnits >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Convert a fixed point temperature in celsius to the units
+//             configured for display.
+//
+// PARAMETERS: ConfigDatah - Pointer to the configuration data structure.
+//
+//             Value - The temperature in sixteenths of a degree celsius.
+//
+// RETURNS:    int32_t - The temperature in sixteenths of a degree in the
+//                       display units.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+int32_t FixedUnits (
+   PConfig_t*  ConfigDatah,
+   int32_t     Value
+)
+{
+   if ( ConfigDatah->Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT )
+   {
+      Value = FixedC2F ( Value );
+   }
+
+   return Value;
+}
+
+// -----------------------------------------------------------< /FixedUnits >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< FormatFixed >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Format a fixed point temperature as a decimal number.
+//
+// PARAMETERS: Text - Buffer to receive the text, at least FIXED_TEXT_MAX bytes.
+//
+//             Value - The temperature in sixteenths of a degree.
+//
+//             Places - Number of digits after the decimal point (0..4).
+//
+// RETURNS:    int - The number of characters written, not counting the null.
+//
+// NOTES:      -  The value is rounded half away from zero to the number of
+//                places asked for.  Four places show a sixteenth exactly.
+//
+//             -  The sign is handled separately so that values between -1 and
+//                0 keep their minus sign.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+int FormatFixed (
+   char*    Text,
+   int32_t  Value,
+   uint8_t  Places
+)
+{
+   static const uint16_t Scale[] = { 1, 10, 100, 1000, 10000 };
+
+   uint32_t Magnitude = ( Value < 0 ) ? -Value : Value;
+   uint32_t Whole;
+   uint32_t Fraction;
+   int      Length;
+
+   if ( Places > 4 )
+   {
+      Places = 4;
+   }
+
+   // Scale to the number of decimal places and round.
+   Magnitude = ( Magnitude * Scale[ Places ] + ( FIXED_ONE / 2 ) ) >> FIXED_SHIFT;
+
+   Whole    = Magnitude / Scale[ Places ];
+   Fraction = Magnitude % Scale[ Places ];
+
+   Length = sprintf ( Text, "%s%u",
+                      ( Value < 0 && Magnitude > 0 ) ? "-" : "",
+                      Whole
+                    );
+
+   if ( Places > 0 )
+   {
+      Length += sprintf ( &Text[ Length ], ".%0*u", Places, Fraction );
+   }
+
+   return Length;
+}
+
+// ----------------------------------------------------------< /FormatFixed >---
@@ -0,0 +1,71 @@
+#ifndef FIXED_POINT
+#define FIXED_POINT
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< FixedPoint.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that handle temperatures
+//          as fixed point integers.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The ESP8266 has no floating point hardware, so every float
+//             operation is done by a library routine.  Temperatures are kept
+//             instead in the DS18B20's own format, a signed 16 bit count of
+//             sixteenths of a degree, from the probe all the way to the text
+//             that is sent to the screen and to clients.
+//
+//          -  A fixed point value in fahrenheit is also in sixteenths of a
+//             degree, so the same routines work for either unit.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <DallasTemperature.h>   // DS18B20 temperature ICs
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+#include "EEPROMConfig.h"        // Read a write configuration to FLASH storage
+
+
+
+// Number of fraction bits, and the value of one whole degree.
+#define FIXED_SHIFT             4
+#define FIXED_ONE               ( 1 << FIXED_SHIFT )
+
+// Convert whole degrees (such as the temperature limits) to fixed point.
+#define FIXED_FROM_INT(d)       ( (int32_t) (d) * FIXED_ONE )
+
+// The reading returned for a probe that could not be read.
+#define FIXED_DISCONNECTED      FIXED_FROM_INT ( DEVICE_DISCONNECTED_C )
+
+// Longest text FormatFixed() can return, including the null.
+#define FIXED_TEXT_MAX          12
+
+
+
+int32_t FixedC2F (
+   int32_t  Value
+);
+
+int32_t FixedUnits (
+   PConfig_t*  ConfigDatah,
+   int32_t     Value
+);
+
+int FormatFixed (
+   char*    Text,
+   int32_t  Value,
+   uint8_t  Places
+);
+
+
+
+#endif   // FIXED_POINT
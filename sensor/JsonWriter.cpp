@@ -0,0 +1,623 @@
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< JsonWriter.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that write JSON text straight into a buffer.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The text is the same, byte for byte, as the JSON library writes
+//             for the same values, both compact and pretty, so clients and
+//             the debug log see no difference.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Signed whole number values.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "JsonWriter.h"
+
+
+
+static void Put (
+   JWriter_t*     Writer,
+   char           Value
+);
+
+static void PutText (
+   JWriter_t*     Writer,
+   const char*    Text,
+   size_t         Length
+);
+
+static void NewLine (
+   JWriter_t*     Writer
+);
+
+static void StartValue (
+   JWriter_t*     Writer,
+   const char*    Key
+);
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< JsonBegin >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start writing a JSON message.
+//
+// PARAMETERS: Writer - The writer to start.
+//
+//             Buffer - Where to write the text.
+//
+//             Size - The size of the buffer.
+//
+//             Pretty - True to write the text spread over lines and indented
+//                      for reading, false to write it compactly.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Nothing is written, the message starts with JsonOpen().
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void JsonBegin (
+   JWriter_t*     Writer,
+   char*          Buffer,
+   size_t         Size,
+   bool           Pretty
+)
+{
+   Writer->Buffer = Buffer;
+   Writer->Size   = Size;
+   Writer->Length = 0;
+   Writer->Pretty = Pretty;
+   Writer->Depth  = 0;
+   Writer->Empty  = 0;
+}
+
+// ------------------------------------------------------------< /JsonBegin >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< JsonEnd >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Finish writing a JSON message.
+//
+// PARAMETERS: Writer - The writer to finish.
+//
+// RETURNS:    size_t - The length of the text, which is more than what was
+//                      written if the buffer was too small.
+//
+// NOTES:      -  The text in the buffer is null terminated.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+size_t JsonEnd (
+   JWriter_t*     Writer
+)
+{
+   if ( Writer->Size > 0 )
+   {
+      Writer->Buffer[ min ( Writer->Length, Writer->Size - 1 ) ] = 0;
+   }
+
+   return Writer->Length;
+}
+
+// --------------------------------------------------------------< /JsonEnd >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< JsonOpen >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start an object or an array.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Key - The name of the object or array in the enclosing object,
+//                   or NULL at the top level or inside an array.
+//
+//             Bracket - '{' for an object, '[' for an array.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Nesting deeper than JSON_DEPTH_MAX is still written, but the
+//                pretty text may be laid out wrong.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void JsonOpen (
+   JWriter_t*     Writer,
+   const char*    Key,
+   char           Bracket
+)
+{
+   StartValue ( Writer, Key );
+   Put ( Writer, Bracket );
+
+   if ( Writer->Depth < JSON_DEPTH_MAX )
+   {
+      Writer->Empty |= ( 1 << Writer->Depth );
+   }
+
+   Writer->Depth++;
+}
+
+// -------------------------------------------------------------< /JsonOpen >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< JsonClose >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Finish the object or array most recently started.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Bracket - '}' for an object, ']' for an array.
+//
+// RETURNS:    void
+//
+// NOTES:      -  An empty object or array is written as {} or [] even in
+//                pretty text.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void JsonClose (
+   JWriter_t*     Writer,
+   char           Bracket
+)
+{
+   if ( Writer->Depth > 0 )
+   {
+      Writer->Depth--;
+   }
+
+   if (  Writer->Pretty == true
+      && Writer->Depth < JSON_DEPTH_MAX
+      && ( Writer->Empty & ( 1 << Writer->Depth ) ) == 0
+      )
+   {
+      NewLine ( Writer );
+   }
+
+   Put ( Writer, Bracket );
+}
+
+// ------------------------------------------------------------< /JsonClose >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< JsonString >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write a text value.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Key - The name of the value, or NULL inside an array.
+//
+//             Value - The text, or NULL to write null.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Quotes, backslashes, and the control characters that have a
+//                short escape are escaped, the same ones as the JSON library.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void JsonString (
+   JWriter_t*     Writer,
+   const char*    Key,
+   const char*    Value
+)
+{
+   static const char Special[] = "\"\\\b\f\n\r\t";
+   static const char Escaped[] = "\"\\bfnrt";
+
+   StartValue ( Writer, Key );
+
+   if ( Value == NULL )
+   {
+      PutText ( Writer, "null", 4 );
+   }
+
+   else
+   {
+      Put ( Writer, '"' );
+
+      for ( ; *Value != 0; Value++ )
+      {
+         const char* Match = strchr ( Special, *Value );
+
+         if ( Match != NULL )
+         {
+            Put ( Writer, '\\' );
+            Put ( Writer, Escaped[ Match - Special ] );
+         }
+
+         else
+         {
+            Put ( Writer, *Value );
+         }
+      }
+
+      Put ( Writer, '"' );
+   }
+}
+
+// -----------------------------------------------------------< /JsonString >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< JsonUnsigned >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write a whole number value.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Key - The name of the value, or NULL inside an array.
+//
+//             Value - The number.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void JsonUnsigned (
+   JWriter_t*     Writer,
+   const char*    Key,
+   uint32_t       Value
+)
+{
+   char     Text[ 12 ];
+
+   StartValue ( Writer, Key );
+   PutText ( Writer, Text, sprintf ( Text, "%u", Value ) );
+}
+
+// ---------------------------------------------------------< /JsonUnsigned >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< JsonSigned >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write a whole number value that may be negative.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Key - The name of the value, or NULL inside an array.
+//
+//             Value - The number.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void JsonSigned (
+   JWriter_t*     Writer,
+   const char*    Key,
+   int32_t        Value
+)
+{
+   char     Text[ 12 ];
+
+   StartValue ( Writer, Key );
+   PutText ( Writer, Text, sprintf ( Text, "%d", Value ) );
+}
+
+// -----------------------------------------------------------< /JsonSigned >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< JsonFixed >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write a fixed point temperature value.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Key - The name of the value, or NULL inside an array.
+//
+//             Value - The temperature in sixteenths of a degree, or
+//                     FIXED_DISCONNECTED if it is not a valid reading.
+//
+//             Places - The number of decimal places.
+//
+// RETURNS:    void
+//
+// NOTES:      -  An invalid reading is written as null.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void JsonFixed (
+   JWriter_t*     Writer,
+   const char*    Key,
+   int16_t        Value,
+   uint8_t        Places
+)
+{
+   char     Text[ FIXED_TEXT_MAX ];
+
+   StartValue ( Writer, Key );
+
+   if ( Value != FIXED_DISCONNECTED )
+   {
+      PutText ( Writer, Text, FormatFixed ( Text, Value, Places ) );
+   }
+
+   else
+   {
+      PutText ( Writer, "null", 4 );
+   }
+}
+
+// ------------------------------------------------------------< /JsonFixed >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< JsonFixedArray >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write an array of fixed point temperature values.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Key - The name of the array, or NULL inside another array.
+//
+//             Values - The temperatures, or NULL for an empty array.
+//
+//             Count - The number of temperatures.
+//
+//             Places - The number of decimal places.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Each value is written as JsonFixed() writes it.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void JsonFixedArray (
+   JWriter_t*     Writer,
+   const char*    Key,
+   const int16_t* Values,
+   uint8_t        Count,
+   uint8_t        Places
+)
+{
+   JsonOpen ( Writer, Key, '[' );
+
+   for ( uint8_t i = 0; i < Count && Values != NULL; i++ )
+   {
+      JsonFixed ( Writer, NULL, Values[ i ], Places );
+   }
+
+   JsonClose ( Writer, ']' );
+}
+
+// -------------------------------------------------------< /JsonFixedArray >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------------< Put >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add one character to the text.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Value - The character.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Always counted in the length, but only stored if there is
+//                still room for it and the null.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void Put (
+   JWriter_t*     Writer,
+   char           Value
+)
+{
+   if ( Writer->Length + 1 < Writer->Size )
+   {
+      Writer->Buffer[ Writer->Length ] = Value;
+   }
+
+   Writer->Length++;
+}
+
+// ------------------------------------------------------------------< /Put >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< PutText >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add text to the text, as it is.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Text - The text to add.
+//
+//             Length - The length of the text.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void PutText (
+   JWriter_t*     Writer,
+   const char*    Text,
+   size_t         Length
+)
+{
+   for ( size_t i = 0; i < Length; i++ )
+   {
+      Put ( Writer, Text[ i ] );
+   }
+}
+
+// --------------------------------------------------------------< /PutText >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------------< NewLine >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start a new line of pretty text, indented to the current depth.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Lines end in CR LF, as the JSON library ends them.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void NewLine (
+   JWriter_t*     Writer
+)
+{
+   PutText ( Writer, "\r\n", 2 );
+
+   for ( uint8_t i = 0; i < Writer->Depth * JSON_INDENT; i++ )
+   {
+      Put ( Writer, ' ' );
+   }
+}
+
+// --------------------------------------------------------------< /NewLine >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< StartValue >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Write what comes before a value: the comma after the previous
+//             value, the line break in pretty text, and the key.
+//
+// PARAMETERS: Writer - The writer to use.
+//
+//             Key - The name of the value, or NULL if it has none.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The key is not escaped, keys are always names from the code.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void StartValue (
+   JWriter_t*     Writer,
+   const char*    Key
+)
+{
+   if ( Writer->Depth > 0 && Writer->Depth <= JSON_DEPTH_MAX )
+   {
+      uint16_t Level = 1 << ( Writer->Depth - 1 );
+
+      if ( ( Writer->Empty & Level ) == 0 )
+      {
+         Put ( Writer, ',' );
+      }
+
+      Writer->Empty &= ~Level;
+
+      if ( Writer->Pretty == true )
+      {
+         NewLine ( Writer );
+      }
+   }
+
+   if ( Key != NULL )
+   {
+      Put ( Writer, '"' );
+      PutText ( Writer, Key, strlen ( Key ) );
+      PutText ( Writer, Writer->Pretty ? "\": " : "\":", Writer->Pretty ? 3 : 2 );
+   }
+}
+
+// -----------------------------------------------------------< /StartValue >---
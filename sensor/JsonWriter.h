@@ -0,0 +1,146 @@
+#ifndef JSON_WRITER
+#define JSON_WRITER
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< JsonWriter.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that write JSON text
+//          straight into a buffer.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Nothing is built in memory first, each value is formatted into
+//             the buffer as it is written, so one pass gives both the text
+//             and its length.  The structure of the message is set by the
+//             order of the calls, normally generated from a field list (see
+//             SENSOR_DATA_FIELDS in sensor.ino).
+//
+//          -  Text that does not fit is cut off, but the length returned is
+//             still the full length, the same as the JSON library measures
+//             it, so the caller can tell that the buffer was too small.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Signed whole number values.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+#include "FixedPoint.h"          // Fixed point temperature values
+
+
+
+// Deepest nesting of objects and arrays.
+#define JSON_DEPTH_MAX          8
+
+// Spaces per level of nesting in pretty text, as the JSON library uses.
+#define JSON_INDENT             2
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< JSON_WRITER >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: The state of one JSON message being written.
+//
+// FIELDS:  Buffer - Where the text is written.
+//
+//          Size - The size of the buffer, including room for a null.
+//
+//          Length - The length of the text so far, including any that did not
+//                   fit in the buffer.
+//
+//          Pretty - True to write the text spread over lines and indented for
+//                   reading, false to write it compactly.
+//
+//          Depth - How many objects and arrays are open.
+//
+//          Empty - One bit per level of nesting, set while the object or
+//                  array open at that level has nothing in it yet.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct JSON_WRITER
+{
+   char*    Buffer;
+   size_t   Size;
+   size_t   Length;
+   bool     Pretty;
+   uint8_t  Depth;
+   uint16_t Empty;
+} JWriter_t;
+
+// ----------------------------------------------------------< /JSON_WRITER >---
+
+
+
+void JsonBegin (
+   JWriter_t*     Writer,
+   char*          Buffer,
+   size_t         Size,
+   bool           Pretty
+);
+
+size_t JsonEnd (
+   JWriter_t*     Writer
+);
+
+void JsonOpen (
+   JWriter_t*     Writer,
+   const char*    Key,
+   char           Bracket
+);
+
+void JsonClose (
+   JWriter_t*     Writer,
+   char           Bracket
+);
+
+void JsonString (
+   JWriter_t*     Writer,
+   const char*    Key,
+   const char*    Value
+);
+
+void JsonUnsigned (
+   JWriter_t*     Writer,
+   const char*    Key,
+   uint32_t       Value
+);
+
+void JsonSigned (
+   JWriter_t*     Writer,
+   const char*    Key,
+   int32_t        Value
+);
+
+void JsonFixed (
+   JWriter_t*     Writer,
+   const char*    Key,
+   int16_t        Value,
+   uint8_t        Places
+);
+
+void JsonFixedArray (
+   JWriter_t*     Writer,
+   const char*    Key,
+   const int16_t* Values,
+   uint8_t        Count,
+   uint8_t        Places
+);
+
+
+
+#endif   // JSON_WRITER
@@ -0,0 +1,517 @@
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< PageTemplate.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that send a SPIFFS file to a web client, filling in its
+//          place holders on the way.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Place holders are matched exactly, the same way String::replace
+//             matched them when the whole page was loaded into memory, so the
+//             pages in SPIFFS did not need to change.
+//
+//          -  The page is sent with chunked transfer encoding, since its
+//             length is not known until it has been filled in.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "PageTemplate.h"
+#include "TimingStats.h"         // Code path timing measurements
+
+
+
+static uint8_t MatchField (
+   const char*        Text,
+   size_t             Length,
+   const char* const* Fields,
+   uint8_t            FieldCount,
+   size_t*            FieldLength
+);
+
+static void Flush (
+   PTemplate_t*       Page
+);
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< TemplateBegin >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start answering a request for a page.
+//
+// PARAMETERS: Page - The page to start.
+//
+//             WebServerh - Handle to the web server.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Called first thing in the request handler, so the time to
+//                the first byte includes any work done before the page is
+//                rendered, such as a wifi network scan.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void TemplateBegin (
+   PTemplate_t*       Page,
+   ESP8266WebServer*  WebServerh
+)
+{
+   Page->WebServerh  = WebServerh;
+   Page->Length      = 0;
+   Page->Sent        = 0;
+   Page->StartMicros = micros();
+   Page->FirstMicros = 0;
+   Page->StartHeap   = ESP.getFreeHeap();
+   Page->MinHeap     = Page->StartHeap;
+
+   TimingStart ( TIMING_PAGE_FIRST_BYTE );
+}
+
+// --------------------------------------------------------< /TemplateBegin >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< TemplateRender >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send a file to the web client, with each place holder in it
+//             replaced by what the caller writes for it.
+//
+// PARAMETERS: Page - The page, started by TemplateBegin().
+//
+//             FileSys - A reference to the file system handle.
+//
+//             FilePath - The path and name of the file to send.
+//
+//             ContentType - The MIME type of the file.
+//
+//             Fields - The place holders to look for.
+//
+//             FieldCount - The number of place holders.
+//
+//             Fill - Called to write what replaces each place holder found.
+//
+//             Context - Passed on to Fill.
+//
+// RETURNS:    bool == 'true' when the file was sent.
+//                  == 'false' if the file does not exist, and nothing was
+//                     sent.
+//
+// NOTES:      -  The last TEMPLATE_FIELD_MAX bytes of each block are not
+//                searched until the next block has been read after them, so
+//                place holders can be no longer than that.
+//
+//             -  Where two place holders start at the same place, the first
+//                one in the list is used.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool TemplateRender (
+   PTemplate_t*       Page,
+   fs::FS&            FileSys,
+   const char*        FilePath,
+   const char*        ContentType,
+   const char* const* Fields,
+   uint8_t            FieldCount,
+   TemplateFill_t     Fill,
+   void*              Context
+)
+{
+   char     Input[ TEMPLATE_BLOCK_SIZE + TEMPLATE_FIELD_MAX ];
+   size_t   Have = 0;
+   size_t   Limit;
+   size_t   Position;
+   size_t   Run;
+   size_t   Length;
+   uint8_t  Field;
+   bool     Ended = false;
+   bool     Found = false;
+
+   if ( FileSys.exists ( FilePath ) )
+   {
+      File FileHandle = FileSys.open ( FilePath, "r" );
+
+      if ( FileHandle )
+      {
+         Found = true;
+
+         Page->WebServerh->setContentLength ( CONTENT_LENGTH_UNKNOWN );
+         Page->WebServerh->send ( 200, ContentType, "" );
+
+         while ( Ended == false || Have > 0 )
+         {
+            if ( Ended == false )
+            {
+               Length = FileHandle.read ( (uint8_t*) &Input[ Have ], sizeof ( Input ) - Have );
+               Ended  = ( Length == 0 );
+               Have  += Length;
+            }
+
+            // Keep back enough for a place holder that runs into the next
+            // block, unless there is no next block.
+            Limit = ( Ended == true )               ? Have
+                  : ( Have > TEMPLATE_FIELD_MAX )   ? Have - TEMPLATE_FIELD_MAX
+                  :                                   0
+                  ;
+
+            Position = 0;
+            Run      = 0;
+
+            while ( Position < Limit )
+            {
+               Field = MatchField ( &Input[ Position ], Have - Position,
+                                    Fields, FieldCount, &Length
+                                  );
+
+               if ( Field < FieldCount )
+               {
+                  TemplateWrite ( Page, &Input[ Run ], Position - Run );
+
+                  if ( Fill ( Page, Field, Context ) == false )
+                  {
+                     TemplateWrite ( Page, &Input[ Position ], Length );
+                  }
+
+                  Position += Length;
+                  Run       = Position;
+               }
+
+               else
+               {
+                  Position++;
+               }
+            }
+
+            TemplateWrite ( Page, &Input[ Run ], Position - Run );
+
+            Have -= Position;
+            memmove ( Input, &Input[ Position ], Have );
+         }
+
+         FileHandle.close();
+
+         Flush ( Page );
+
+         // An empty chunk marks the end of the response.
+         Page->WebServerh->sendContent ( "" );
+      }
+   }
+
+   return Found;
+}
+
+// -------------------------------------------------------< /TemplateRender >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< TemplateWrite >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add text to a page.
+//
+// PARAMETERS: Page - The page to add to.
+//
+//             Text - The text to add.
+//
+//             Length - The number of bytes of text.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Each time the chunk fills it is sent, so text of any length
+//                can be added.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void TemplateWrite (
+   PTemplate_t*       Page,
+   const char*        Text,
+   size_t             Length
+)
+{
+   size_t   Room;
+
+   while ( Length > 0 )
+   {
+      Room = TEMPLATE_CHUNK_SIZE - Page->Length;
+
+      if ( Room > Length )
+      {
+         Room = Length;
+      }
+
+      memcpy ( &Page->Chunk[ Page->Length ], Text, Room );
+      Page->Length += Room;
+      Text         += Room;
+      Length       -= Room;
+
+      if ( Page->Length == TEMPLATE_CHUNK_SIZE )
+      {
+         Flush ( Page );
+      }
+   }
+}
+
+// --------------------------------------------------------< /TemplateWrite >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< TemplateText >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add null terminated text to a page.
+//
+// PARAMETERS: Page - The page to add to.
+//
+//             Text - The text to add.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void TemplateText (
+   PTemplate_t*       Page,
+   const char*        Text
+)
+{
+   TemplateWrite ( Page, Text, strlen ( Text ) );
+}
+
+// ---------------------------------------------------------< /TemplateText >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< TemplateNumber >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add a whole number to a page.
+//
+// PARAMETERS: Page - The page to add to.
+//
+//             Value - The number to add.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void TemplateNumber (
+   PTemplate_t*       Page,
+   int32_t            Value
+)
+{
+   char     Text[ 12 ];
+   int      Length;
+
+   Length = sprintf ( Text, "%d", Value );
+
+   TemplateWrite ( Page, Text, Length );
+}
+
+// -------------------------------------------------------< /TemplateNumber >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< TemplateChoice >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add the quoted value of a radio button or list option to a page,
+//             marked as chosen if it is the current setting.
+//
+// PARAMETERS: Page - The page to add to.
+//
+//             Value - The value, without quotes.
+//
+//             Chosen - True if this is the current setting.
+//
+//             Attribute - What marks it as chosen, "checked" for a radio
+//                         button or "selected" for a list option.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Writes, for example:  "Y" checked
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void TemplateChoice (
+   PTemplate_t*       Page,
+   const char*        Value,
+   bool               Chosen,
+   const char*        Attribute
+)
+{
+   TemplateText ( Page, "\"" );
+   TemplateText ( Page, Value );
+   TemplateText ( Page, "\"" );
+
+   if ( Chosen == true )
+   {
+      TemplateText ( Page, " " );
+      TemplateText ( Page, Attribute );
+   }
+}
+
+// -------------------------------------------------------< /TemplateChoice >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< MatchField >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Find which place holder, if any, starts at the given text.
+//
+// PARAMETERS: Text - The text to look at.
+//
+//             Length - The number of bytes of text there are.
+//
+//             Fields - The place holders to look for.
+//
+//             FieldCount - The number of place holders.
+//
+//             FieldLength - Set to the length of the place holder found.
+//
+// RETURNS:    uint8_t - The index of the place holder found, or FieldCount
+//                       if none of them start here.
+//
+// NOTES:      -  Most of the page does not start a place holder, so the first
+//                byte is checked before anything else.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static uint8_t MatchField (
+   const char*        Text,
+   size_t             Length,
+   const char* const* Fields,
+   uint8_t            FieldCount,
+   size_t*            FieldLength
+)
+{
+   uint8_t  Field = FieldCount;
+   size_t   i;
+
+   for ( uint8_t f = 0; f < FieldCount && Field == FieldCount; f++ )
+   {
+      if ( Fields[ f ][ 0 ] == Text[ 0 ] )
+      {
+         i = 1;
+
+         while ( i < Length && Fields[ f ][ i ] != '\0' && Fields[ f ][ i ] == Text[ i ] )
+         {
+            i++;
+         }
+
+         if ( Fields[ f ][ i ] == '\0' )
+         {
+            Field        = f;
+            *FieldLength = i;
+         }
+      }
+   }
+
+   return Field;
+}
+
+// -----------------------------------------------------------< /MatchField >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------< Flush >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send the text waiting in a page's chunk to the web client.
+//
+// PARAMETERS: Page - The page to send from.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The free heap is checked after each chunk, while the network
+//                stack is holding it, to find the least there was while the
+//                page was sent.  The sketch wide low mark is kept up to date
+//                as well, since loop() does not run until the page is done.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void Flush (
+   PTemplate_t*       Page
+)
+{
+   uint32_t FreeHeap;
+
+   if ( Page->Length > 0 )
+   {
+      Page->WebServerh->sendContent ( Page->Chunk, Page->Length );
+      Page->Sent  += Page->Length;
+      Page->Length = 0;
+
+      if ( Page->FirstMicros == 0 )
+      {
+         TimingStop ( TIMING_PAGE_FIRST_BYTE );
+         Page->FirstMicros = micros() - Page->StartMicros;
+      }
+
+      FreeHeap = ESP.getFreeHeap();
+
+      if ( FreeHeap < Page->MinHeap )
+      {
+         Page->MinHeap = FreeHeap;
+      }
+
+      if ( FreeHeap < MinFreeHeap )
+      {
+         MinFreeHeap = FreeHeap;
+      }
+   }
+}
+
+// ----------------------------------------------------------------< /Flush >---
@@ -0,0 +1,143 @@
+#ifndef PAGE_TEMPLATE
+#define PAGE_TEMPLATE
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< PageTemplate.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that send a SPIFFS file to
+//          a web client, filling in its place holders on the way.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The file is read a block at a time and sent in chunks as it is
+//             filled in, so the memory needed is the same for any size of
+//             page.  The whole page is never held in a String.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include <ESP8266WebServer.h>    // Simple web server
+#include <FS.h>                  // SPIFFS file system
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+
+
+
+// Bytes read from the file at a time.
+#define TEMPLATE_BLOCK_SIZE     256
+
+// Bytes of filled in text sent to the client at a time.
+#define TEMPLATE_CHUNK_SIZE     512
+
+//
+// Longest place holder.  This much of each block is kept back for the next
+// pass, so a place holder split across two reads is still found.
+//
+#define TEMPLATE_FIELD_MAX      40
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< PAGE_TEMPLATE >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: The state of one page being sent.
+//
+// FIELDS:  WebServerh - Handle to the web server sending the page.
+//
+//          Chunk - Filled in text waiting to be sent.
+//
+//          Length - The number of bytes in the chunk.
+//
+//          Sent - The number of bytes sent so far.
+//
+//          StartMicros - When the request was started, by TemplateBegin().
+//
+//          FirstMicros - Microseconds from the start of the request until the
+//                        first chunk was sent, zero until then.
+//
+//          StartHeap - Free heap when the request was started.
+//
+//          MinHeap - The least free heap seen while the page was sent.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct PAGE_TEMPLATE
+{
+   ESP8266WebServer* WebServerh;
+   char              Chunk[ TEMPLATE_CHUNK_SIZE ];
+   size_t            Length;
+   uint32_t          Sent;
+   uint32_t          StartMicros;
+   uint32_t          FirstMicros;
+   uint32_t          StartHeap;
+   uint32_t          MinHeap;
+} PTemplate_t;
+
+// --------------------------------------------------------< /PAGE_TEMPLATE >---
+
+
+
+//
+// Called for each place holder found, with its index in the list of place
+// holders, to write what replaces it.  Returns false to leave the place holder
+// in the page as it is.
+//
+typedef bool ( *TemplateFill_t ) ( PTemplate_t* Page, uint8_t Field, void* Context );
+
+
+
+void TemplateBegin (
+   PTemplate_t*       Page,
+   ESP8266WebServer*  WebServerh
+);
+
+bool TemplateRender (
+   PTemplate_t*       Page,
+   fs::FS&            FileSys,
+   const char*        FilePath,
+   const char*        ContentType,
+   const char* const* Fields,
+   uint8_t            FieldCount,
+   TemplateFill_t     Fill,
+   void*              Context
+);
+
+void TemplateWrite (
+   PTemplate_t*       Page,
+   const char*        Text,
+   size_t             Length
+);
+
+void TemplateText (
+   PTemplate_t*       Page,
+   const char*        Text
+);
+
+void TemplateNumber (
+   PTemplate_t*       Page,
+   int32_t            Value
+);
+
+void TemplateChoice (
+   PTemplate_t*       Page,
+   const char*        Value,
+   bool               Chosen,
+   const char*        Attribute
+);
+
+
+
+#endif   // PAGE_TEMPLATE
@@ -0,0 +1,358 @@
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< SensorControl.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that decide how the sensor readings are acted on.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Manual relay override.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "SensorControl.h"
+
+
+
+// Milliseconds between sensor readings currently in use.
+uint32_t SensorPeriod = 0;
+
+// The state the relay was last set to, and how many times it has changed.
+bool     RelayState = false;
+uint32_t RelayTransitions = 0;
+
+// Whether the relay follows the readings or is held by hand.
+uint8_t  RelayMode = RELAY_MODE_AUTO;
+
+// Samples in a row without a valid reading.
+static uint8_t RelayFaultCount = 0;
+
+// When the relay was last set, in milliseconds, and whether it has been set
+// at all yet.
+static uint32_t   RelayChangeTime = 0;
+static bool       RelayStarted = false;
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< SensorAdapt >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Work out how long to wait before the next sensor reading.
+//
+// PARAMETERS: ConfigDatah - Pointer to the configuration data structure.
+//
+//             Value - The latest reading of the controlling probe in sixteenths
+//                     of a degree, in the same units as the temperature limits.
+//
+// RETURNS:    bool - True if SensorPeriod changed and the sensor timer needs to
+//                    be set again.
+//
+// NOTES:      -  Unless both SensorWaitMin and SensorWaitMax are configured the
+//                period is always SensorWaitTime.
+//
+//             -  While the temperature is moving the period is set so that at
+//                least ADAPT_READINGS_TO_LIMIT readings are taken before the
+//                nearer limit would be reached at the current rate.  Close to a
+//                limit the shortest period is used.  When the readings are flat
+//                the period grows by half each time, up to the longest period.
+//
+//             -  All of the arithmetic is done with integers.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Fixed point readings.
+//
+// -----------------------------------------------------------------------------
+
+bool SensorAdapt (
+   PConfig_t*  ConfigDatah,
+   int16_t     Value
+)
+{
+   static bool       HaveLast = false;
+   static int16_t    LastValue;
+   static uint32_t   LastTime;
+
+   uint32_t Now     = millis();
+   uint32_t Period  = ConfigDatah->SensorWaitTime;
+   uint32_t Min     = ConfigDatah->SensorWaitMin;
+   uint32_t Max     = ConfigDatah->SensorWaitMax;
+   bool     Changed = false;
+
+   if ( Min > 0 && Max >= Min )
+   {
+      if ( HaveLast == true )
+      {
+         int32_t Change   = abs ( Value - LastValue );
+         int32_t Distance = min ( abs ( Value - FIXED_FROM_INT ( ConfigDatah->TempLowLimit ) ),
+                                  abs ( FIXED_FROM_INT ( ConfigDatah->TempHighLimit ) - Value )
+                                );
+
+         if ( Distance <= ADAPT_NEAR_LIMIT )
+         {
+            Period = Min;
+         }
+
+         else if ( Change < ADAPT_FLAT_CHANGE )
+         {
+            Period = SensorPeriod + SensorPeriod / 2;
+         }
+
+         else
+         {
+            // Milliseconds until the limit is reached at the current rate.
+            uint64_t ToLimit = (uint64_t) Distance * ( Now - LastTime ) / Change;
+
+            Period = min ( ToLimit / ADAPT_READINGS_TO_LIMIT, (uint64_t) Max );
+         }
+      }
+
+      Period = constrain ( Period, Min, Max );
+   }
+
+   LastValue = Value;
+   LastTime  = Now;
+   HaveLast  = true;
+
+   if ( Period != SensorPeriod )
+   {
+      SensorPeriod = Period;
+      Changed = true;
+   }
+
+   return Changed;
+}
+
+// ----------------------------------------------------------< /SensorAdapt >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< RelaySet >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Change the relay state, and note when and how often it changed.
+//
+// PARAMETERS: State - True to turn the relay ON.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Every change of RelayState goes through here, whoever makes
+//                it, so the minimum ON and OFF times in RelayControl are
+//                always counted from the last real change.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void RelaySet (
+   bool        State
+)
+{
+   if ( State != RelayState )
+   {
+      RelayState      = State;
+      RelayChangeTime = millis();
+      RelayTransitions++;
+   }
+}
+
+// -------------------------------------------------------------< /RelaySet >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< RelayControl >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Decide whether the relay should be ON or OFF after a new reading.
+//
+// PARAMETERS: ConfigDatah - Pointer to the configuration data structure.
+//
+//             Value - The latest reading of the controlling probe in sixteenths
+//                     of a degree, in the same units as the temperature limits.
+//
+// RETURNS:    bool - True if the relay should be ON.
+//
+// NOTES:      -  The relay is turned OFF as soon as the temperature reaches
+//                either limit, but is only turned back ON once it is inside
+//                both limits by more than the hysteresis band.  Readings that
+//                hover right at a limit then no longer make the relay chatter.
+//
+//             -  Once the relay changes it is held in its new state for at
+//                least the configured minimum ON or OFF time, whatever the
+//                readings do.  The very first decision is not held back.
+//
+//             -  With a zero hysteresis and zero minimum times this is the same
+//                as the plain comparison against the limits.
+//
+//             -  While the relay is held by hand it is left alone.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Fixed point readings.
+// 16Oct2026 DSVance    - Left alone while held by hand.
+// 16Oct2026 DSVance    - Minimum times counted from any change (RelaySet).
+//
+// -----------------------------------------------------------------------------
+
+bool RelayControl (
+   PConfig_t*  ConfigDatah,
+   int16_t     Value
+)
+{
+   uint32_t Now  = millis();
+   int32_t  Low  = FIXED_FROM_INT ( ConfigDatah->TempLowLimit );
+   int32_t  High = FIXED_FROM_INT ( ConfigDatah->TempHighLimit );
+   int32_t  Band = ( ConfigDatah->TempHysteresis * FIXED_ONE + 5 ) / 10;
+   bool     Desired;
+
+   RelayFaultCount = 0;
+
+   if ( RelayState == true )
+   {
+      Desired = ( Value > Low && Value < High );
+   }
+
+   else
+   {
+      Desired = ( Value > Low + Band && Value < High - Band );
+   }
+
+   if ( RelayMode != RELAY_MODE_AUTO )
+   {
+      // Held where RelayOverride() put it.
+   }
+
+   else if ( RelayStarted == false )
+   {
+      RelayState      = Desired;
+      RelayChangeTime = Now;
+      RelayStarted    = true;
+   }
+
+   else if ( Desired != RelayState )
+   {
+      uint32_t MinTime = ( RelayState == true )
+                         ? ConfigDatah->RelayMinOnTime
+                         : ConfigDatah->RelayMinOffTime;
+
+      if ( Now - RelayChangeTime >= MinTime * 1000 )
+      {
+         RelaySet ( Desired );
+      }
+   }
+
+   return RelayState;
+}
+
+// ---------------------------------------------------------< /RelayControl >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< RelayFault >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Decide whether the relay should be ON or OFF when there is no
+//             valid reading.
+//
+// PARAMETERS: void
+//
+// RETURNS:    bool - True if the relay should be ON.
+//
+// NOTES:      -  A bad reading must not drive the relay, so the relay is held
+//                where it is.  A probe that keeps failing may mean nothing is
+//                watching the temperature at all, so after RELAY_FAULT_SAMPLES
+//                in a row the relay is turned OFF to be safe.  That counts
+//                as a change, so it then stays OFF for the minimum OFF time.
+//
+//             -  A relay held by hand stays as it is, the person holding it
+//                has taken over from the probe.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Left alone while held by hand.
+// 16Oct2026 DSVance    - Change time noted, so the minimum OFF time applies.
+//
+// -----------------------------------------------------------------------------
+
+bool RelayFault ()
+{
+   if ( RelayFaultCount < RELAY_FAULT_SAMPLES )
+   {
+      RelayFaultCount++;
+   }
+
+   if (  RelayMode == RELAY_MODE_AUTO
+      && RelayFaultCount >= RELAY_FAULT_SAMPLES
+      )
+   {
+      RelaySet ( false );
+   }
+
+   return RelayState;
+}
+
+// -----------------------------------------------------------< /RelayFault >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< RelayOverride >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Hold the relay ON or OFF by hand, or give it back to the
+//             readings.
+//
+// PARAMETERS: Mode - RELAY_MODE_ON, RELAY_MODE_OFF, or RELAY_MODE_AUTO.
+//
+// RETURNS:    bool - True if the relay should be ON.
+//
+// NOTES:      -  A relay held by hand changes at once, without waiting for
+//                the minimum ON or OFF time.  Back in RELAY_MODE_AUTO it
+//                follows the next reading as usual, once the minimum time
+//                since the last change by hand has passed.
+//
+//             -  The mode is not stored, so a restart always goes back to
+//                RELAY_MODE_AUTO.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Change time noted (RelaySet).
+//
+// -----------------------------------------------------------------------------
+
+bool RelayOverride (
+   uint8_t     Mode
+)
+{
+   bool     Held = ( Mode == RELAY_MODE_ON );
+
+   RelayMode = Mode;
+
+   if ( Mode != RELAY_MODE_AUTO )
+   {
+      RelaySet ( Held );
+   }
+
+   return RelayState;
+}
+
+// --------------------------------------------------------< /RelayOverride >---
@@ -0,0 +1,83 @@
+#ifndef SENSOR_CONTROL
+#define SENSOR_CONTROL
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< SensorControl.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that decide how the sensor
+//          readings are acted on.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Manual relay override.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+#include "EEPROMConfig.h"        // Read a write configuration to FLASH storage
+#include "FixedPoint.h"          // Fixed point temperature values
+
+
+
+// A change between readings smaller than this (about 0.2 degrees) counts as
+// flat.  In sixteenths of a degree.
+#define ADAPT_FLAT_CHANGE       3
+
+// Readings within this many sixteenths of a degree of a limit are taken as
+// fast as allowed.
+#define ADAPT_NEAR_LIMIT        FIXED_ONE
+
+// At the current rate of change, take at least this many more readings before
+// a limit would be reached.
+#define ADAPT_READINGS_TO_LIMIT 4
+
+// The relay is held in its last state for this many samples in a row without
+// a valid reading, and then turned OFF.
+#define RELAY_FAULT_SAMPLES     3
+
+//
+// Who decides the relay state (see RelayOverride).
+//
+#define RELAY_MODE_AUTO         0        // The readings and the limits
+#define RELAY_MODE_ON           1        // Held ON by hand
+#define RELAY_MODE_OFF          2        // Held OFF by hand
+
+
+
+extern uint32_t SensorPeriod;
+extern bool     RelayState;
+extern uint32_t RelayTransitions;
+extern uint8_t  RelayMode;
+
+
+
+bool SensorAdapt (
+   PConfig_t*  ConfigDatah,
+   int16_t     Value
+);
+
+bool RelayControl (
+   PConfig_t*  ConfigDatah,
+   int16_t     Value
+);
+
+bool RelayFault ();
+
+bool RelayOverride (
+   uint8_t     Mode
+);
+
+
+
+#endif   // SENSOR_CONTROL
@@ -0,0 +1,138 @@
+#ifndef SENSOR_DATA
+#define SENSOR_DATA
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< SensorData.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for the sensor data sent to web socket
+//          clients, and the routines in sensor.ino that write it as JSON text
+//          and as binary frames.
+//
+// AUTHOR:  Scott Vance
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development, from sensor.ino.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+#include "EEPROMConfig.h"        // Read a write configuration to FLASH storage
+#include "TempProbe.h"           // DS18B20 temperature probe table
+#include "FixedPoint.h"          // Fixed point temperature values
+#include "JsonWriter.h"          // Write JSON text straight into a buffer
+
+
+
+//
+// The fields of the sensor data sent to clients, in the order they are sent.
+// The SData_t structure, SerializeJSON(), SerializeDescriptor(), and
+// SerializeBinary() are all generated from this list, so a field added here
+// is sent without any other change.  Each entry is the kind of field, its
+// JSON name, its member in SData_t, for a TEMPS array the member that holds
+// the count (unused for the other kinds), and whether binary clients are sent
+// it once in the descriptor (META) or in each binary frame (EACH).
+//
+// NOTE: Temperature values are fixed point, in sixteenths of a degree.
+//
+#define SENSOR_DATA_FIELDS(FIELD)                                    \
+        FIELD ( STRING, Type,     Type,     -,          META )       \
+        FIELD ( STRING, Name,     Name,     -,          META )       \
+        FIELD ( STRING, Units,    Units,    -,          META )       \
+        FIELD ( TEMP,   Value,    Value,    -,          EACH )       \
+        FIELD ( UINT,   Time,     Time,     -,          EACH )       \
+        FIELD ( UINT,   Interval, Interval, -,          META )       \
+        FIELD ( UINT,   Seq,      Seq,      -,          EACH )       \
+        FIELD ( TEMPS,  Probes,   Values,   ValueCount, EACH )
+
+// The SData_t members for each kind of field.
+#define SDATA_MEMBER_STRING(m,c)   const char*    m;
+#define SDATA_MEMBER_TEMP(m,c)     int16_t        m;
+#define SDATA_MEMBER_UINT(m,c)     uint32_t       m;
+#define SDATA_MEMBER_TEMPS(m,c)    const int16_t* m; uint8_t c;
+#define SDATA_MEMBER(k,j,m,c,s)    SDATA_MEMBER_##k ( m, c )
+
+// How SerializeJSON() writes each kind of field.
+#define SDATA_JSON_STRING(w,d,j,m,c)  JsonString ( w, #j, d.m )
+#define SDATA_JSON_TEMP(w,d,j,m,c)    JsonFixed ( w, #j, d.m, JSON_TEMP_PLACES )
+#define SDATA_JSON_UINT(w,d,j,m,c)    JsonUnsigned ( w, #j, d.m )
+#define SDATA_JSON_TEMPS(w,d,j,m,c)   JsonFixedArray ( w, #j, d.m, min ( d.c, (uint8_t) PROBE_MAX ), JSON_TEMP_PLACES )
+
+// How SerializeBinary() packs each kind of field, little endian, and how the
+// descriptor names the layout.  Text is only sent in the descriptor.
+#define SDATA_BIN_STRING(b,n,d,m,c)   ( n )
+#define SDATA_BIN_TEMP(b,n,d,m,c)     PackLE ( b, n, (uint16_t) d.m, 2 )
+#define SDATA_BIN_UINT(b,n,d,m,c)     PackLE ( b, n, d.m, 4 )
+#define SDATA_BIN_TEMPS(b,n,d,m,c)    PackTemps ( b, n, d.m, min ( d.c, (uint8_t) PROBE_MAX ) )
+#define SDATA_TYPE_STRING             "none"
+#define SDATA_TYPE_TEMP               "i16"
+#define SDATA_TYPE_UINT               "u32"
+#define SDATA_TYPE_TEMPS              "u8+i16[]"
+
+// Longest binary frame: every EACH field at its largest.
+#define SENSOR_BINARY_MAX  32
+
+typedef struct SENSOR_DATA
+{
+  SENSOR_DATA_FIELDS ( SDATA_MEMBER )
+} SData_t ;
+
+// A bit for each field, in the order of the list, for the fields a client
+// subscribes to (see SocketCommand), and a bit for each probe.
+#define SDATA_INDEX(k,j,m,c,s)     SDATA_FIELD_##j,
+enum { SENSOR_DATA_FIELDS ( SDATA_INDEX ) SDATA_FIELD_COUNT };
+#define SDATA_FIELD_BIT(j)         ( 1 << SDATA_FIELD_##j )
+#define SDATA_ALL_FIELDS           ( ( 1 << SDATA_FIELD_COUNT ) - 1 )
+#define SDATA_ALL_PROBES           0xFF
+
+// Decimal places of the temperature values sent to clients.
+#define JSON_TEMP_PLACES   2
+
+//
+// Size of a buffer for the compact JSON text of the sensor data at its
+// longest: the names, punctuation, type, and units, a label of
+// PCONFIG_MAX_LABEL characters that all need escaping (two characters each),
+// every temperature at its longest ("-2048.00"), every whole number at its
+// longest, and a null.  The host SerializeTest checks that it fits exactly.
+// The descriptor and the text of any subscription are shorter.
+//
+#define JSON_FRAME_TEXT    99
+#define JSON_TEMP_TEXT     8
+#define JSON_UINT_TEXT     10
+#define JSON_MAX_TEXT      ( JSON_FRAME_TEXT                                  \
+                           + 2 * PCONFIG_MAX_LABEL                            \
+                           + ( PROBE_MAX + 1 ) * JSON_TEMP_TEXT               \
+                           + 3 * JSON_UINT_TEXT                               \
+                           + 1 )
+
+
+
+size_t SerializeJSON (
+   const SData_t& Data,
+   char*          JSONBuffer,
+   size_t         MaxSize,
+   boolean        Pretty = false,
+   uint16_t       Fields = SDATA_ALL_FIELDS
+);
+
+size_t SerializeDescriptor (
+   const SData_t& Data,
+   char*          JSONBuffer,
+   size_t         MaxSize
+);
+
+size_t SerializeBinary (
+   const SData_t& Data,
+   uint8_t*       Buffer,
+   size_t         MaxSize
+);
+
+
+
+#endif   // SENSOR_DATA
@@ -0,0 +1,250 @@
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< SensorHistory.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that keep a history of recent sensor readings in memory,
+//          so a client that connects late can still see what happened before.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Only the time since the previous reading is kept in each record.
+//             The time of the newest record and the sum of the deltas of all
+//             of the records after the oldest one are kept separately, which
+//             lets the time of any record be worked out with one pass over the
+//             buffer in either direction.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "SensorHistory.h"
+
+
+
+static HRecord_t  HistoryTable[ HISTORY_SIZE ];
+static uint16_t   HistoryHead  = 0;    // Position the next record is written
+static uint16_t   HistoryTotal = 0;    // Number of records in the buffer
+static uint32_t   HistoryLast  = 0;    // Uptime in seconds of the newest record
+static uint32_t   HistorySpan  = 0;    // Seconds from oldest to newest record
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< HistoryAdd >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add one reading to the history, replacing the oldest reading if
+//             the buffer is full.
+//
+// PARAMETERS: Probe - Number of the probe the reading came from.
+//
+//             Value - The temperature in sixteenths of a degree celsius.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Store the fixed point reading as it is.
+//
+// -----------------------------------------------------------------------------
+
+void HistoryAdd (
+   uint8_t  Probe,
+   int16_t  Value
+)
+{
+   uint32_t Now   = millis() / 1000;
+   uint32_t Delta = 0;
+
+   if ( HistoryTotal > 0 )
+   {
+      Delta = Now - HistoryLast;
+
+      if ( Delta > HISTORY_DELTA_MAX )
+      {
+         Delta = HISTORY_DELTA_MAX;
+      }
+   }
+
+   if ( HistoryTotal == HISTORY_SIZE )
+   {
+      // The oldest record is about to be replaced, so the one after it becomes
+      // the oldest and its delta no longer counts towards the span.
+      uint16_t Next = ( HistoryHead + 1 ) % HISTORY_SIZE;
+
+      HistorySpan -= HistoryTable[ Next ].Delta & HISTORY_DELTA_MAX;
+   }
+   else
+   {
+      HistoryTotal++;
+   }
+
+   HistoryTable[ HistoryHead ].Delta = ( Probe << HISTORY_PROBE_SHIFT ) | Delta;
+   HistoryTable[ HistoryHead ].Value = Value;
+
+   if ( HistoryTotal > 1 )
+   {
+      HistorySpan += Delta;
+   }
+
+   HistoryLast = Now;
+   HistoryHead = ( HistoryHead + 1 ) % HISTORY_SIZE;
+}
+
+// -----------------------------------------------------------< /HistoryAdd >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< HistoryCount >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the number of readings in the history.
+//
+// PARAMETERS: void
+//
+// RETURNS:    uint16_t - The number of readings, at most HISTORY_SIZE.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint16_t HistoryCount ()
+{
+   return HistoryTotal;
+}
+
+// ---------------------------------------------------------< /HistoryCount >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< HistoryFirst >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Set up a cursor to work through the history from the oldest
+//             reading wanted to the newest.
+//
+// PARAMETERS: Cursor - Pointer to the cursor to set up.
+//
+//             Newest - Only return this many of the most recent readings, or
+//                      zero to return all of them.
+//
+// RETURNS:    void
+//
+// NOTES:      -  When only part of the history is wanted the time of the first
+//                record is found by walking back from the newest one, so the
+//                cost is in proportion to the number of records asked for.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void HistoryFirst (
+   HCursor_t*  Cursor,
+   uint16_t    Newest
+)
+{
+   uint16_t Count = HistoryTotal;
+   uint32_t Time  = HistoryLast - HistorySpan;
+
+   if ( Newest > 0 && Newest < Count )
+   {
+      uint16_t Index = HistoryHead;
+
+      Time = HistoryLast;
+
+      for ( uint16_t i = 1; i < Newest; i++ )
+      {
+         Index = ( Index + HISTORY_SIZE - 1 ) % HISTORY_SIZE;
+         Time -= HistoryTable[ Index ].Delta & HISTORY_DELTA_MAX;
+      }
+
+      Count = Newest;
+   }
+
+   Cursor->Index     = ( HistoryHead + HISTORY_SIZE - Count ) % HISTORY_SIZE;
+   Cursor->Remaining = Count;
+   Cursor->Time      = Time;
+}
+
+// ---------------------------------------------------------< /HistoryFirst >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< HistoryNext >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the next reading from the history.
+//
+// PARAMETERS: Cursor - Pointer to a cursor set up by HistoryFirst().
+//
+//             Probe - Returns the number of the probe the reading came from.
+//
+//             Value - Returns the temperature in sixteenths of a degree
+//                     celsius.
+//
+//             Time - Returns the uptime in seconds when the reading was taken.
+//
+// RETURNS:    bool - True if a reading was returned, false once there are no
+//                    more.
+//
+// NOTES:      -  The delta of the first record returned is ignored, because
+//                it is relative to a record that is not being returned.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool HistoryNext (
+   HCursor_t*  Cursor,
+   uint8_t*    Probe,
+   int16_t*    Value,
+   uint32_t*   Time
+)
+{
+   bool Found = false;
+
+   if ( Cursor->Remaining > 0 )
+   {
+      HRecord_t* Record = &HistoryTable[ Cursor->Index ];
+
+      *Probe = Record->Delta >> HISTORY_PROBE_SHIFT;
+      *Value = Record->Value;
+      *Time  = Cursor->Time;
+
+      Cursor->Index = ( Cursor->Index + 1 ) % HISTORY_SIZE;
+      Cursor->Remaining--;
+
+      // Advance to the time of the following record, ready for the next call.
+      if ( Cursor->Remaining > 0 )
+      {
+         Cursor->Time += HistoryTable[ Cursor->Index ].Delta & HISTORY_DELTA_MAX;
+      }
+
+      Found = true;
+   }
+
+   return Found;
+}
+
+// ----------------------------------------------------------< /HistoryNext >---
+
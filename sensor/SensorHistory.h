@@ -0,0 +1,127 @@
+#ifndef SENSOR_HISTORY
+#define SENSOR_HISTORY
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< SensorHistory.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that keep a history of
+//          recent sensor readings in memory.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The history is a fixed size ring buffer, so once it is full each
+//             new reading replaces the oldest one.  Nothing is allocated from
+//             the heap, the whole buffer is a static array.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< HISTORY_RECORD >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: One packed reading in the history ring buffer.
+//
+// FIELDS:  Delta - Bits 15-13 hold the number of the probe the reading came
+//                  from (0..7).  Bits 12-0 hold the number of seconds between
+//                  this reading and the one before it (0..8191).
+//
+//          Value - The temperature in sixteenths of a degree celsius.
+//
+// NOTES:   -  Each record is 4 bytes so 1024 readings need only 4K of RAM.
+//
+//          -  Readings of several probes taken together have a delta of zero
+//             after the first one.
+//
+//          -  A gap of more than HISTORY_DELTA_MAX seconds between readings is
+//             recorded as HISTORY_DELTA_MAX, so times reported for the records
+//             before a longer gap are later than they really were.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct HISTORY_RECORD
+{
+   uint16_t Delta;
+   int16_t  Value;
+} HRecord_t;
+
+#define  HISTORY_SIZE            1024     // Number of records in the buffer
+#define  HISTORY_PROBE_SHIFT       13     // Position of the probe number bits
+#define  HISTORY_DELTA_MAX     0x1fff     // Largest delta that can be stored
+
+#define  HISTORY_CHUNK_SIZE       512     // Bytes sent at a time to web clients
+#define  HISTORY_SAMPLE_MAX        32     // Longest text of one sent sample
+
+// -------------------------------------------------------< /HISTORY_RECORD >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< HISTORY_CURSOR >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: Position of a caller working through the history one record at a
+//          time, oldest to newest.
+//
+// FIELDS:  Index - Ring buffer position of the next record to return.
+//
+//          Remaining - How many records are left to return.
+//
+//          Time - Uptime in seconds of the record most recently returned.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct HISTORY_CURSOR
+{
+   uint16_t Index;
+   uint16_t Remaining;
+   uint32_t Time;
+} HCursor_t;
+
+// -------------------------------------------------------< /HISTORY_CURSOR >---
+
+
+
+void HistoryAdd (
+   uint8_t  Probe,
+   int16_t  Value
+);
+
+uint16_t HistoryCount ();
+
+void HistoryFirst (
+   HCursor_t*  Cursor,
+   uint16_t    Newest
+);
+
+bool HistoryNext (
+   HCursor_t*  Cursor,
+   uint8_t*    Probe,
+   int16_t*    Value,
+   uint32_t*   Time
+);
+
+
+
+#endif   // SENSOR_HISTORY
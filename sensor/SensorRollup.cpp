@@ -0,0 +1,205 @@
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< SensorRollup.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that summarize the sensor readings over fixed windows of
+//          time, so that minimum, maximum, and average values can be asked for
+//          without going back over the individual readings.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The rollups follow the first (controlling) probe only.
+//
+//          -  Values are kept in sixteenths of a degree celsius, the same as
+//             the history buffer.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "SensorRollup.h"
+
+
+
+static RWindow_t  Rollup1Minute[ 30 ];
+static RWindow_t  Rollup15Minute[ 16 ];
+static RWindow_t  Rollup1Hour[ 24 ];
+
+RTier_t RollupTable[ ROLLUP_TIER_COUNT ] =
+{
+   { "1m",    60, 30, Rollup1Minute  },
+   { "15m",  900, 16, Rollup15Minute },
+   { "1h",  3600, 24, Rollup1Hour    },
+};
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< RollupAdd >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add one reading to the open window of every tier.
+//
+// PARAMETERS: Value - The temperature in sixteenths of a degree celsius.
+//
+// RETURNS:    void
+//
+// NOTES:      -  A window is only closed when the first reading after it has
+//                ended arrives.  A window with no readings at all (the sensor
+//                interval is longer than the window) is simply not recorded.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void RollupAdd (
+   int16_t  Value
+)
+{
+   uint32_t Now = millis() / 1000;
+
+   for ( int i = 0; i < ROLLUP_TIER_COUNT; i++ )
+   {
+      RTier_t* Tier  = &RollupTable[ i ];
+      uint32_t Start = Now - ( Now % Tier->Seconds );
+
+      if ( Tier->Count > 0 && Start != Tier->Start )
+      {
+         // The open window has ended, move it into the table.
+         RollupCurrent ( i, &Tier->Table[ Tier->Head ] );
+
+         Tier->Head = ( Tier->Head + 1 ) % Tier->Size;
+
+         if ( Tier->Total < Tier->Size )
+         {
+            Tier->Total++;
+         }
+
+         Tier->Count = 0;
+      }
+
+      if ( Tier->Count == 0 )
+      {
+         Tier->Start = Start;
+         Tier->Min   = Value;
+         Tier->Max   = Value;
+         Tier->Sum   = 0;
+      }
+
+      if ( Value < Tier->Min )
+      {
+         Tier->Min = Value;
+      }
+
+      if ( Value > Tier->Max )
+      {
+         Tier->Max = Value;
+      }
+
+      Tier->Sum += Value;
+      Tier->Count++;
+   }
+}
+
+// ------------------------------------------------------------< /RollupAdd >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< RollupCurrent >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return the summary of the open window of a tier so far.
+//
+// PARAMETERS: Tier - Which entry in the RollupTable to use.
+//
+//             Window - Returns the summary of the open window.
+//
+// RETURNS:    bool - True if the open window has any readings.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool RollupCurrent (
+   uint8_t     Tier,
+   RWindow_t*  Window
+)
+{
+   bool Found = false;
+
+   if ( Tier < ROLLUP_TIER_COUNT && RollupTable[ Tier ].Count > 0 )
+   {
+      RTier_t* Rollup = &RollupTable[ Tier ];
+
+      Window->Start = Rollup->Start;
+      Window->Min   = Rollup->Min;
+      Window->Max   = Rollup->Max;
+      Window->Avg   = Rollup->Sum / Rollup->Count;
+      Window->Count = Rollup->Count;
+
+      Found = true;
+   }
+
+   return Found;
+}
+
+// --------------------------------------------------------< /RollupCurrent >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< RollupClosed >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return one of the closed windows of a tier.
+//
+// PARAMETERS: Tier - Which entry in the RollupTable to use.
+//
+//             Index - Which closed window to return, zero being the oldest.
+//
+//             Window - Returns the summary of the closed window.
+//
+// RETURNS:    bool - True if there is a closed window with that index.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool RollupClosed (
+   uint8_t     Tier,
+   uint8_t     Index,
+   RWindow_t*  Window
+)
+{
+   bool Found = false;
+
+   if ( Tier < ROLLUP_TIER_COUNT && Index < RollupTable[ Tier ].Total )
+   {
+      RTier_t* Rollup = &RollupTable[ Tier ];
+
+      *Window = Rollup->Table[ ( Rollup->Head + Rollup->Size - Rollup->Total + Index ) % Rollup->Size ];
+
+      Found = true;
+   }
+
+   return Found;
+}
+
+// ---------------------------------------------------------< /RollupClosed >---
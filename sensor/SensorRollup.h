@@ -0,0 +1,154 @@
+#ifndef SENSOR_ROLLUP
+#define SENSOR_ROLLUP
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< SensorRollup.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that summarize the sensor
+//          readings over fixed windows of time.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Each tier keeps the running minimum, maximum, sum, and count of
+//             its open window.  A new reading updates every tier with a few
+//             compares and adds, no stored readings are ever scanned again.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< ROLLUP_WINDOW >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: The summary of the readings taken during one window of time.
+//
+// FIELDS:  Start - Uptime in seconds when the window started.  Windows are
+//                  aligned to a multiple of their length.
+//
+//          Min - The lowest reading in sixteenths of a degree celsius.
+//
+//          Max - The highest reading in sixteenths of a degree celsius.
+//
+//          Avg - The average reading in sixteenths of a degree celsius.
+//
+//          Count - The number of readings in the window.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct ROLLUP_WINDOW
+{
+   uint32_t Start;
+   int16_t  Min;
+   int16_t  Max;
+   int16_t  Avg;
+   uint16_t Count;
+} RWindow_t;
+
+// --------------------------------------------------------< /ROLLUP_WINDOW >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< ROLLUP_TIER >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: One size of window, with its open window and the table of the most
+//          recently closed ones.
+//
+// FIELDS:  Name - Short text name reported for the tier.
+//
+//          Seconds - The length of each window in seconds.
+//
+//          Size - The number of closed windows the table can hold.
+//
+//          Table - The closed windows, used as a ring buffer.
+//
+//          Head - Position in the table the next closed window is written.
+//
+//          Total - The number of closed windows in the table.
+//
+//          Start - Uptime in seconds when the open window started.
+//
+//          Min - Lowest reading in the open window.
+//
+//          Max - Highest reading in the open window.
+//
+//          Sum - Sum of the readings in the open window.
+//
+//          Count - The number of readings in the open window.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct ROLLUP_TIER
+{
+   const char* Name;
+   uint32_t    Seconds;
+   uint8_t     Size;
+   RWindow_t*  Table;
+   uint8_t     Head;
+   uint8_t     Total;
+   uint32_t    Start;
+   int16_t     Min;
+   int16_t     Max;
+   int32_t     Sum;
+   uint16_t    Count;
+} RTier_t;
+
+//
+// Index of each tier in the RollupTable.
+//
+#define  ROLLUP_1_MINUTE            0     // 30 windows of 1 minute
+#define  ROLLUP_15_MINUTE           1     // 16 windows of 15 minutes
+#define  ROLLUP_1_HOUR              2     // 24 windows of 1 hour
+#define  ROLLUP_TIER_COUNT          3
+
+#define  ROLLUP_WINDOW_MAX         64     // Longest text of one sent window
+#define  ROLLUP_TIER_MAX           64     // Longest text opening one sent tier
+
+// ----------------------------------------------------------< /ROLLUP_TIER >---
+
+
+
+extern RTier_t RollupTable[ ROLLUP_TIER_COUNT ];
+
+
+
+void RollupAdd (
+   int16_t  Value
+);
+
+bool RollupCurrent (
+   uint8_t     Tier,
+   RWindow_t*  Window
+);
+
+bool RollupClosed (
+   uint8_t     Tier,
+   uint8_t     Index,
+   RWindow_t*  Window
+);
+
+
+
+#endif   // SENSOR_ROLLUP
@@ -0,0 +1,250 @@
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< TempProbe.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that manage the DS18B20 temperature probes attached to the
+//          OneWire bus.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  A single conversion command is broadcast to every probe on the
+//             bus at once (OneWire "skip ROM"), so the conversion time does
+//             not grow with the number of probes.  Only reading the results
+//             back is done once per probe.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "TempProbe.h"
+
+
+
+DeviceAddress  ProbeAddress[ PROBE_MAX ];
+uint8_t        ProbeCount = 0;
+PFaults_t      ProbeFaults[ PROBE_MAX ];
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< ProbeBegin >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start the sensor communications and build the table of probe
+//             addresses.
+//
+// PARAMETERS: Sensorsh - Handle to the DS18B20 temperature device instance.
+//
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+// RETURNS:    uint8_t - The number of probes found on the bus.
+//
+// NOTES:      -  Devices on the bus that are not DS18B20s are skipped, and
+//                only the first PROBE_MAX probes are used.
+//
+//             -  The wait-for-conversion option is turned off, so it is up to
+//                the caller to wait the time returned by ProbeStartConversion()
+//                before reading the probes.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint8_t ProbeBegin (
+   DallasTemperature* Sensorsh,
+   PConfig_t*         ConfigDatah
+)
+{
+   uint8_t  DeviceCount;
+
+   ProbeCount = 0;
+
+   // Start the sensor communications.
+   Sensorsh->begin();
+
+   // Set the global sensor resolution (9..12).
+   Sensorsh->setResolution ( SENSOR_RESOLUTION );
+
+   // Don't block waiting for a conversion to complete, the result is
+   // collected later by a timer (see SensorAction).
+   Sensorsh->setWaitForConversion ( false );
+
+   DeviceCount = Sensorsh->getDeviceCount();
+
+   DEBUG_PRINTF ( ConfigDatah, "DEBUG: Found %u OneWire device%s \n",
+                  DeviceCount,
+                  ( DeviceCount != 1 ) ? "s" : ""
+                );
+
+   for ( uint8_t i = 0; i < DeviceCount && ProbeCount < PROBE_MAX; i++ )
+   {
+      uint8_t* Address = ProbeAddress[ ProbeCount ];
+
+      if (  Sensorsh->getAddress ( Address, i )
+         && Address[ 0 ] == PROBE_FAMILY_DS18B20
+         )
+      {
+         DEBUG_PRINTF ( ConfigDatah,
+                        "   Probe #%u address is: %02x%02x%02x%02x%02x%02x%02x%02x \n",
+                        ProbeCount,
+                        Address[ 0 ], Address[ 1 ], Address[ 2 ], Address[ 3 ],
+                        Address[ 4 ], Address[ 5 ], Address[ 6 ], Address[ 7 ]
+                      );
+         ProbeCount++;
+      }
+   }
+
+   if ( ProbeCount == 0 )
+   {
+      Serial.println ( "ERROR: No DS18B20 temperature probes found" );
+   }
+
+   return ProbeCount;
+}
+
+// -----------------------------------------------------------< /ProbeBegin >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------< ProbeStartConversion >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start a temperature conversion on every probe on the bus.
+//
+// PARAMETERS: Sensorsh - Handle to the DS18B20 temperature device instance.
+//
+// RETURNS:    uint32_t - Milliseconds until the conversion should be complete.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t ProbeStartConversion (
+   DallasTemperature* Sensorsh
+)
+{
+   // One broadcast command covers every device on the bus.
+   Sensorsh->requestTemperatures();
+
+   return Sensorsh->millisToWaitForConversion ( SENSOR_RESOLUTION );
+}
+
+// -------------------------------------------------< /ProbeStartConversion >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< ProbeRead >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Read the result of the last conversion from one probe.
+//
+// PARAMETERS: Sensorsh - Handle to the DS18B20 temperature device instance.
+//
+//             Index - Which probe in the address table to read.
+//
+//             Value - Returns the temperature in sixteenths of a degree
+//                     celsius, or FIXED_DISCONNECTED if the read failed.
+//
+// RETURNS:    uint8_t - PROBE_OK, or the PROBE_FAULT_... value that describes
+//                       what went wrong.
+//
+// NOTES:      -  The probe is addressed directly by its cached ROM address, no
+//                search of the bus is done.
+//
+//             -  The value is taken straight from the first two bytes of the
+//                scratchpad, which already hold sixteenths of a degree.  The
+//                low bits below the configured resolution are undefined in the
+//                DS18B20 data sheet, so they are cleared.
+//
+//             -  A scratchpad of all zeros passes the CRC check, and one of
+//                all ones is what an open bus reads as, so both are treated as
+//                no reply.
+//
+//             -  Every fault is counted in the probe's ProbeFaults entry.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Return the raw fixed point value, not a float.
+// 16Oct2026 DSVance    - Check the CRC and power on value, count faults.
+//
+// -----------------------------------------------------------------------------
+
+uint8_t ProbeRead (
+   DallasTemperature* Sensorsh,
+   uint8_t            Index,
+   int16_t*           Value
+)
+{
+   uint8_t     Status = PROBE_FAULT_MISSING;
+   ScratchPad  Data;
+
+   *Value = FIXED_DISCONNECTED;
+
+   if ( Index < ProbeCount )
+   {
+      PFaults_t*  Faults = &ProbeFaults[ Index ];
+      bool        Blank  = true;
+
+      Faults->Reads++;
+
+      if ( Sensorsh->readScratchPad ( ProbeAddress[ Index ], Data ) )
+      {
+         for ( uint8_t i = 1; i < sizeof ( ScratchPad ) && Blank == true; i++ )
+         {
+            Blank = ( Data[ i ] == Data[ 0 ] );
+         }
+
+         Blank = Blank && ( Data[ 0 ] == 0x00 || Data[ 0 ] == 0xff );
+      }
+
+      if ( Blank == true )
+      {
+         Status = PROBE_FAULT_NO_REPLY;
+         Faults->NoReply++;
+      }
+
+      else if ( OneWire::crc8 ( Data, sizeof ( ScratchPad ) - 1 ) != Data[ sizeof ( ScratchPad ) - 1 ] )
+      {
+         Status = PROBE_FAULT_CRC;
+         Faults->CRC++;
+      }
+
+      else
+      {
+         int16_t Raw = (int16_t) ( ( Data[ 1 ] << 8 ) | Data[ 0 ] );
+
+         if ( Raw == PROBE_POWER_ON_RAW )
+         {
+            Status = PROBE_FAULT_POWER_ON;
+            Faults->PowerOn++;
+         }
+
+         else
+         {
+            Status = PROBE_OK;
+            *Value = Raw & ~( ( 1 << ( 12 - SENSOR_RESOLUTION ) ) - 1 );
+         }
+      }
+
+      Faults->LastStatus = Status;
+   }
+
+   return Status;
+}
+
+// ------------------------------------------------------------< /ProbeRead >---
@@ -0,0 +1,131 @@
+#ifndef TEMP_PROBE
+#define TEMP_PROBE
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< TempProbe.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that manage the DS18B20
+//          temperature probes attached to the OneWire bus.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The ROM address of every probe on the bus is found once, when the
+//             bus is started, and kept in a table.  After that each probe is
+//             read directly by its address, which avoids repeating the OneWire
+//             search that reading a probe by index requires.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <OneWire.h>             // One-wire communication bus
+#include <DallasTemperature.h>   // DS18B20 temperature ICs
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+#include "EEPROMConfig.h"        // Read a write configuration to FLASH storage
+#include "FixedPoint.h"          // Fixed point temperature values
+
+
+
+// The most probes that can be used on the bus.  Any beyond this are ignored.
+#define PROBE_MAX               8
+
+// The DS18B20 resolution in bits (9..12).  Each additional bit doubles the
+// time the sensor needs to perform a temperature conversion.
+#define SENSOR_RESOLUTION       10
+
+// The OneWire family code of a DS18B20.
+#define PROBE_FAMILY_DS18B20    0x28
+
+// The temperature register value a DS18B20 holds at power on (85 degrees C).
+// Reading it means the probe reset or the conversion never happened.
+#define PROBE_POWER_ON_RAW      0x0550
+
+// How many times a faulty probe is read again before the sample is given up
+// on, and the milliseconds to wait before the first retry.  The wait doubles
+// with each retry.
+#define PROBE_RETRY_MAX         3
+#define PROBE_RETRY_TIME        25
+
+//
+// Result of reading a probe.
+//
+#define PROBE_OK                0     // Good reading
+#define PROBE_FAULT_MISSING     1     // No probe at that position in the table
+#define PROBE_FAULT_NO_REPLY    2     // Probe did not answer
+#define PROBE_FAULT_CRC         3     // Scratchpad failed its CRC check
+#define PROBE_FAULT_POWER_ON    4     // Power on value, no conversion was done
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< PROBE_FAULTS >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: Counts of the ways reading one probe has gone wrong.
+//
+// FIELDS:  Reads - The number of times the probe has been read.
+//
+//          NoReply - Reads the probe did not answer.
+//
+//          CRC - Reads with a bad scratchpad CRC.
+//
+//          PowerOn - Reads that returned the power on value.
+//
+//          Retries - Reads that were repeats after a fault.
+//
+//          Invalid - Samples given up on after all of the retries failed.
+//
+//          LastStatus - Result of the most recent read (PROBE_OK, etc.).
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct PROBE_FAULTS
+{
+   uint32_t Reads;
+   uint32_t NoReply;
+   uint32_t CRC;
+   uint32_t PowerOn;
+   uint32_t Retries;
+   uint32_t Invalid;
+   uint8_t  LastStatus;
+} PFaults_t;
+
+// ---------------------------------------------------------< /PROBE_FAULTS >---
+
+
+
+extern DeviceAddress ProbeAddress[ PROBE_MAX ];
+extern uint8_t       ProbeCount;
+extern PFaults_t     ProbeFaults[ PROBE_MAX ];
+
+
+
+uint8_t ProbeBegin (
+   DallasTemperature* Sensorsh,
+   PConfig_t*         ConfigDatah
+);
+
+uint32_t ProbeStartConversion (
+   DallasTemperature* Sensorsh
+);
+
+uint8_t ProbeRead (
+   DallasTemperature* Sensorsh,
+   uint8_t            Index,
+   int16_t*           Value
+);
+
+
+
+#endif   // TEMP_PROBE
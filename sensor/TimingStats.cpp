@@ -0,0 +1,282 @@
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< TimingStats.cpp >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Routines that measure how long the sketch spends in its various
+//          code paths, so performance questions can be answered on the running
+//          board with repeatable numbers instead of guesswork.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  The statistics are reported on the serial port by
+//             ShowTimingStats() and to web clients as /TimingStats.json.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Time spent sending queued web socket messages.
+// 16Oct2026 Scott Vance - Time to the first byte of a filled in page.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include "TimingStats.h"
+
+
+
+TStats_t TimingTable[ TIMING_COUNT ] =
+{
+   { "Loop"          },
+   { "SensorAction"  },
+   { "SensorCollect" },
+   { "DisplayFlush"  },
+   { "SocketDrain"   },
+   { "PageFirstByte" },
+};
+
+uint32_t MinFreeHeap = UINT32_MAX;
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< TimingStart >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Mark the start of a measured code path.
+//
+// PARAMETERS: Index - Which entry in the TimingTable to measure.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void TimingStart (
+   uint8_t  Index
+)
+{
+   if ( Index < TIMING_COUNT )
+   {
+      TimingTable[ Index ].StartCycles = ESP.getCycleCount();
+   }
+}
+
+// ----------------------------------------------------------< /TimingStart >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< TimingStop >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Mark the end of a measured code path and update its statistics.
+//
+// PARAMETERS: Index - Which entry in the TimingTable to measure.
+//
+// RETURNS:    uint32_t - The duration of the measurement in CPU cycles.
+//
+// NOTES:      -  The subtraction is unsigned, so a single wrap of the cycle
+//                counter between start and stop is handled correctly.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t TimingStop (
+   uint8_t  Index
+)
+{
+   uint32_t Cycles = 0;
+
+   if ( Index < TIMING_COUNT )
+   {
+      TStats_t* Stats = &TimingTable[ Index ];
+
+      Cycles = ESP.getCycleCount() - Stats->StartCycles;
+
+      Stats->Count++;
+      Stats->LastCycles   = Cycles;
+      Stats->TotalCycles += Cycles;
+
+      if ( Cycles > Stats->MaxCycles )
+      {
+         Stats->MaxCycles = Cycles;
+      }
+   }
+
+   return Cycles;
+}
+
+// -----------------------------------------------------------< /TimingStop >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< TimingLap >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Measure the time since the previous lap of a code path and start
+//             the next one.
+//
+// PARAMETERS: Index - Which entry in the TimingTable to measure.
+//
+// RETURNS:    uint32_t - The duration of the lap in CPU cycles.
+//
+// NOTES:      -  Called at the top of loop() this measures the complete time
+//                between passes, which includes the functions queued with
+//                schedule_function() and the system tasks that run after loop()
+//                returns.  That is the stall the web server and web socket see.
+//
+//             -  The very first lap only records its start time.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t TimingLap (
+   uint8_t  Index
+)
+{
+   uint32_t Cycles = 0;
+
+   if ( Index < TIMING_COUNT )
+   {
+      if ( TimingTable[ Index ].StartCycles != 0 )
+      {
+         Cycles = TimingStop ( Index );
+      }
+
+      TimingStart ( Index );
+   }
+
+   return Cycles;
+}
+
+// ------------------------------------------------------------< /TimingLap >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< TimingReset >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Clear all of the accumulated timing statistics.
+//
+// PARAMETERS: void
+//
+// RETURNS:    void
+//
+// NOTES:      -  Handy for taking a fresh "after" measurement without having to
+//                restart the system.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void TimingReset ()
+{
+   for ( int i = 0; i < TIMING_COUNT; i++ )
+   {
+      TimingTable[ i ].Count       = 0;
+      TimingTable[ i ].StartCycles = 0;
+      TimingTable[ i ].LastCycles  = 0;
+      TimingTable[ i ].MaxCycles   = 0;
+      TimingTable[ i ].TotalCycles = 0;
+   }
+
+   MinFreeHeap = UINT32_MAX;
+}
+
+// ----------------------------------------------------------< /TimingReset >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< TimingMicros >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Convert a count of CPU cycles to microseconds.
+//
+// PARAMETERS: Cycles - The number of CPU cycles to convert.
+//
+// RETURNS:    uint32_t - The equivalent number of microseconds.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+uint32_t TimingMicros (
+   uint32_t Cycles
+)
+{
+   return Cycles / ESP.getCpuFreqMHz();
+}
+
+// ---------------------------------------------------------< /TimingMicros >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< ShowTimingStats >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Show the accumulated timing statistics on the serial port.
+//
+// PARAMETERS: Label - Text string providing context about the routine's caller.
+//
+// RETURNS:    void
+//
+// NOTES:
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void ShowTimingStats (
+   const char* Label
+)
+{
+   if ( Label != NULL )
+   {
+      Serial.printf ( "%s \n", Label );
+   }
+
+   Serial.printf ( "   Free heap ............ %u (low %u) \n", ESP.getFreeHeap(), MinFreeHeap );
+
+   for ( int i = 0; i < TIMING_COUNT; i++ )
+   {
+      TStats_t* Stats = &TimingTable[ i ];
+
+      Serial.printf ( "   %-20s count %u  last %u us  max %u us  avg %u us \n",
+                      Stats->Name,
+                      Stats->Count,
+                      TimingMicros ( Stats->LastCycles ),
+                      TimingMicros ( Stats->MaxCycles ),
+                      ( Stats->Count > 0 )
+                      ? TimingMicros ( (uint32_t) ( Stats->TotalCycles / Stats->Count ) )
+                      : 0
+                    );
+   }
+}
+
+// ------------------------------------------------------< /ShowTimingStats >---
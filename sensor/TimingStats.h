@@ -0,0 +1,114 @@
+#ifndef TIMING_STATS
+#define TIMING_STATS
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< TimingStats.h >---
+// -----------------------------------------------------------------------------
+//
+// PROJECT: Arduino development for the ESP8266 custom temperature sensor board.
+//
+// PURPOSE: Prototypes and definitions for routines that measure how long the
+//          sketch spends in its various code paths.
+//
+// AUTHOR:  Scott Vance
+//
+// NOTES:   -  Measurements are taken with the CPU cycle counter, which is far
+//             cheaper to read than micros() and precise enough to compare two
+//             versions of a routine that differ by only a few microseconds.
+//             The counter wraps after ~53 seconds at 80MHz (~26 seconds at
+//             160MHz) so a single measured span must be shorter than that.
+//
+// HISTORY:
+// --------- ----------- - ----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Time spent sending queued web socket messages.
+// 16Oct2026 Scott Vance - Time to the first byte of a filled in page.
+//
+// -----------------------------------------------------------------------------
+
+
+
+#include <Arduino.h>
+#include "Sensor.h"              // Definitions common to whole Sensor sketch
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< TIMING_STATS >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE: Running statistics for one measured code path.
+//
+// FIELDS:  Name - Short text name reported for the code path.
+//
+//          Count - The number of completed measurements.
+//
+//          StartCycles - Cycle counter value when the measurement started.
+//
+//          LastCycles - Duration in CPU cycles of the most recent measurement.
+//
+//          MaxCycles - Duration in CPU cycles of the longest measurement.
+//
+//          TotalCycles - Sum of all of the measured durations in CPU cycles.
+//
+// HISTORY:
+// --------- ----------- - -----------------------------------------------------
+// 16Oct2026 Scott Vance - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+typedef struct TIMING_STATS
+{
+   const char* Name;
+   uint32_t    Count;
+   uint32_t    StartCycles;
+   uint32_t    LastCycles;
+   uint32_t    MaxCycles;
+   uint64_t    TotalCycles;
+} TStats_t;
+
+//
+// Index of each measured code path in the TimingTable.
+//
+#define  TIMING_LOOP                0     // Time between successive loop() calls
+#define  TIMING_SENSOR_ACTION       1     // Start of a sensor reading
+#define  TIMING_SENSOR_COLLECT      2     // Sensor read, display, and broadcast
+#define  TIMING_DISPLAY_FLUSH       3     // Send screen changes over I2C
+#define  TIMING_SOCKET_DRAIN        4     // Send queued web socket messages
+#define  TIMING_PAGE_FIRST_BYTE     5     // Page request to first chunk sent
+#define  TIMING_COUNT               6
+
+// ---------------------------------------------------------< /TIMING_STATS >---
+
+
+
+extern TStats_t TimingTable[ TIMING_COUNT ];
+extern uint32_t MinFreeHeap;
+
+
+
+void TimingStart (
+   uint8_t  Index
+);
+
+uint32_t TimingStop (
+   uint8_t  Index
+);
+
+uint32_t TimingLap (
+   uint8_t  Index
+);
+
+void TimingReset ();
+
+uint32_t TimingMicros (
+   uint32_t Cycles
+);
+
+void ShowTimingStats (
+   const char* Label
+);
+
+
+
+#endif   // TIMING_STATS
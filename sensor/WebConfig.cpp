@@ -13,12 +13,21 @@
 // HISTORY:
 // --------- ----------- - -----------------------------------------------------
 // 30Nov2018 Scott Vance - Initial development.
+// 16Oct2026 Scott Vance - Pages filled in while they are sent from SPIFFS.
 //
 // -----------------------------------------------------------------------------
 
 
 
 #include "WebConfig.h"
+#include "TimingStats.h"         // Code path timing measurements
+#include "SensorHistory.h"       // Ring buffer of recent readings
+#include "SensorRollup.h"        // Min, max, and average over time windows
+#include "SensorControl.h"       // Adaptive reading interval and relay
+#include "FixedPoint.h"          // Fixed point temperature values
+#include "TempProbe.h"           // DS18B20 temperature probe table
+#include "DisplayControl.h"      // Send only what changed to the screen
+#include "PageTemplate.h"        // Fill in place holders while sending a page
 #include <FS.h>                  // SPIFFS file system
 #include <assert.h>              // Assert statements
 #include <Schedule.h>            // Scheduled function ability
@@ -32,6 +41,79 @@ File UploadFileHandle;
 os_timer_t  RestartTimer;
 
 
+//
+// The place holders in each page that is filled in as it is sent, in the
+// order they are looked for.  Each entry is the name used for its index in the
+// Fill routine for the page (SENSOR_FIELD_LOWTEMP and so on), and its text in
+// the page.  The baud rates are in the same order as the BaudList.
+//
+#define SENSOR_NAME_FIELD       "<span name=\"sensor_name\"></span>"
+
+#define SENSOR_CONFIG_FIELDS(FIELD)                                   \
+        FIELD ( NAME,       SENSOR_NAME_FIELD )                       \
+        FIELD ( PROBE_Y,    "\"set_probe_Y\"" )                       \
+        FIELD ( PROBE_N,    "\"set_probe_N\"" )                       \
+        FIELD ( RELAY_Y,    "\"set_relay_Y\"" )                       \
+        FIELD ( RELAY_N,    "\"set_relay_N\"" )                       \
+        FIELD ( UNITS_F,    "\"set_units_F\"" )                       \
+        FIELD ( UNITS_C,    "\"set_units_C\"" )                       \
+        FIELD ( DEBUG_Y,    "\"set_debug_Y\"" )                       \
+        FIELD ( DEBUG_N,    "\"set_debug_N\"" )                       \
+        FIELD ( LOWTEMP,    "set_lowtemp" )                           \
+        FIELD ( HIGHTEMP,   "set_hightemp" )                          \
+        FIELD ( LABEL,      "set_label" )                             \
+        FIELD ( INTERVAL,   "set_interval" )                          \
+        FIELD ( MINWAIT,    "set_minwait" )                           \
+        FIELD ( MAXWAIT,    "set_maxwait" )                           \
+        FIELD ( HYSTERESIS, "set_hysteresis" )                        \
+        FIELD ( MINON,      "set_minon" )                             \
+        FIELD ( MINOFF,     "set_minoff" )
+
+#define WIFI_CONFIG_FIELDS(FIELD)                                     \
+        FIELD ( NAME,       SENSOR_NAME_FIELD )                       \
+        FIELD ( NETLIST,    "<span name=\"set_netlist\"/>" )          \
+        FIELD ( WIFI_Y,     "\"set_wifi_Y\"" )                        \
+        FIELD ( WIFI_N,     "\"set_wifi_N\"" )                        \
+        FIELD ( SSID,       "set_ssid" )                              \
+        FIELD ( PASS,       "set_pass" )                              \
+        FIELD ( AP0,        "set_ap0" )                               \
+        FIELD ( AP1,        "set_ap1" )                               \
+        FIELD ( AP2,        "set_ap2" )                               \
+        FIELD ( AP3,        "set_ap3" )                               \
+        FIELD ( NM0,        "set_nm0" )                               \
+        FIELD ( NM1,        "set_nm1" )                               \
+        FIELD ( NM2,        "set_nm2" )                               \
+        FIELD ( NM3,        "set_nm3" )                               \
+        FIELD ( GW0,        "set_gw0" )                               \
+        FIELD ( GW1,        "set_gw1" )                               \
+        FIELD ( GW2,        "set_gw2" )                               \
+        FIELD ( GW3,        "set_gw3" )                               \
+        FIELD ( BAUD0,      "\"set_100\"" )                           \
+        FIELD ( BAUD1,      "\"set_9600\"" )                          \
+        FIELD ( BAUD2,      "\"set_14400\"" )                         \
+        FIELD ( BAUD3,      "\"set_19200\"" )                         \
+        FIELD ( BAUD4,      "\"set_28800\"" )                         \
+        FIELD ( BAUD5,      "\"set_38400\"" )                         \
+        FIELD ( BAUD6,      "\"set_57600\"" )                         \
+        FIELD ( BAUD7,      "\"set_115200\"" )                        \
+        FIELD ( BAUD8,      "\"set_230400\"" )                        \
+        FIELD ( BAUD9,      "\"set_460800\"" )                        \
+        FIELD ( WEBPORT,    "set_webport" )                           \
+        FIELD ( WSPORT,     "set_wsport" )
+
+#define FIELD_TEXT(n,t)          t,
+#define SENSOR_FIELD_INDEX(n,t)  SENSOR_FIELD_##n,
+#define WIFI_FIELD_INDEX(n,t)    WIFI_FIELD_##n,
+
+enum { SENSOR_CONFIG_FIELDS ( SENSOR_FIELD_INDEX ) SENSOR_FIELD_COUNT };
+enum { WIFI_CONFIG_FIELDS ( WIFI_FIELD_INDEX ) WIFI_FIELD_COUNT };
+
+static const char* const SensorConfigFields[] = { SENSOR_CONFIG_FIELDS ( FIELD_TEXT ) };
+static const char* const WifiConfigFields[]   = { WIFI_CONFIG_FIELDS ( FIELD_TEXT ) };
+static const char* const FileFields[]         = { SENSOR_NAME_FIELD };
+static const char* const ScriptFields[]       = { "ws://w.x.y.z:p" };
+
+
 static bool HandleFileRequest (
    ESP8266WebServer* WebServerh,
    PConfig_t*        ConfigDatah,
@@ -50,7 +132,8 @@ static void HandleSensorConfigGet (
 
 static void HandleSensorConfigPost (
    ESP8266WebServer* WebServerh,
-   PConfig_t*        ConfigDatah
+   PConfig_t*        ConfigDatah,
+   ConfigApply_t     ApplyConfig
 );
 
 static void HandleWifiConfigGet (
@@ -61,7 +144,8 @@ static void HandleWifiConfigGet (
 
 static void HandleWifiConfigPost (
    ESP8266WebServer* WebServerh,
-   PConfig_t*        ConfigDatah
+   PConfig_t*        ConfigDatah,
+   ConfigApply_t     ApplyConfig
 );
 
 static void HandleSensorDataJS (
@@ -70,6 +154,31 @@ static void HandleSensorDataJS (
    const char*       FilePath
 );
 
+static void HandleTimingStats (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+);
+
+static void HandleProbeStatus (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+);
+
+static void HandleScreen (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+);
+
+static void HandleHistory (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+);
+
+static void HandleRollups (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+);
+
 static void RestartSystem ( void* Args );
 
 static void HandleRestart (
@@ -98,7 +207,7 @@ static void ConfigHighTemp (
    PConfig_t*        ConfigDatah
 );
 
-static boolean ConfigSensorLabel (
+static uint8_t ConfigSensorLabel (
    ESP8266WebServer* WebServerh,
    PConfig_t*        ConfigDatah
 );
@@ -108,6 +217,16 @@ static void ConfigWaitInterval (
    PConfig_t*        ConfigDatah
 );
 
+static void ConfigWaitLimits (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+);
+
+static void ConfigRelayTiming (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+);
+
 static boolean ConfigTempUnits (
    ESP8266WebServer* WebServerh,
    PConfig_t*        ConfigDatah
@@ -163,14 +282,39 @@ static void ConfigDataPort (
    PConfig_t*        ConfigDatah
 );
 
-static void ReplaceSensorName (
-   PConfig_t*  ConfigDatah,
-   String&     HTMLFile
+static bool FillSensorName (
+   PTemplate_t*   Page,
+   uint8_t        Field,
+   void*          Context
+);
+
+static bool FillSensorConfig (
+   PTemplate_t*   Page,
+   uint8_t        Field,
+   void*          Context
+);
+
+static bool FillWifiConfig (
+   PTemplate_t*   Page,
+   uint8_t        Field,
+   void*          Context
+);
+
+static bool FillSensorDataJS (
+   PTemplate_t*   Page,
+   uint8_t        Field,
+   void*          Context
 );
 
 static void GetWifiNetworks ( 
-   PConfig_t*  ConfigDatah,
-   String&     HTMLFile
+   PTemplate_t*   Page,
+   PConfig_t*     ConfigDatah
+);
+
+static void ShowPageStats (
+   PConfig_t*     ConfigDatah,
+   const char*    Handler,
+   PTemplate_t*   Page
 );
 
 static void GetContentType (
@@ -192,12 +336,6 @@ int GetFileSize (
    const char* FilePath
 );
 
-int LoadFile (
-   fs::FS&     FileSys,
-   const char* FilePath,
-   String&     FileContent
-);
-
 
 
 // -----------------------------------------------------------------------------
@@ -208,6 +346,13 @@ int LoadFile (
 //
 // PARAMETERS: WebServerh - Handle to the web server.
 //
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+//             SSDPh - Handle to the service discovery responder.
+//
+//             ApplyConfig - Puts settings changed on the configuration pages
+//                           into effect.
+//
 // RETURNS:    void
 //
 // NOTES:
@@ -215,13 +360,15 @@ int LoadFile (
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Changed settings applied without a restart.
 //
 // -----------------------------------------------------------------------------
 
 void WebEvents (
    ESP8266WebServer* WebServerh,
    PConfig_t*        ConfigDatah,
-   SSDPClass*        SSDPh
+   SSDPClass*        SSDPh,
+   ConfigApply_t     ApplyConfig
 )
 {
    // Most page requests are handled generically below, but handle a
@@ -264,9 +411,9 @@ void WebEvents (
       HandleSensorConfigGet ( WebServerh, ConfigDatah, "/SensorConfig.html" );
    });
 
-   WebServerh->on ( "/SensorConfig.html", HTTP_POST, [ WebServerh, ConfigDatah ]()
+   WebServerh->on ( "/SensorConfig.html", HTTP_POST, [ WebServerh, ConfigDatah, ApplyConfig ]()
    {
-      HandleSensorConfigPost ( WebServerh, ConfigDatah );
+      HandleSensorConfigPost ( WebServerh, ConfigDatah, ApplyConfig );
    });
 
    WebServerh->on ( "/WifiConfig.html", HTTP_GET, [ WebServerh, ConfigDatah ]()
@@ -274,9 +421,9 @@ void WebEvents (
       HandleWifiConfigGet ( WebServerh, ConfigDatah, "/WifiConfig.html" );
    });
 
-   WebServerh->on ( "/WifiConfig.html", HTTP_POST, [ WebServerh, ConfigDatah ]()
+   WebServerh->on ( "/WifiConfig.html", HTTP_POST, [ WebServerh, ConfigDatah, ApplyConfig ]()
    {
-      HandleWifiConfigPost ( WebServerh, ConfigDatah );
+      HandleWifiConfigPost ( WebServerh, ConfigDatah, ApplyConfig );
    });
 
    WebServerh->on ( "/TemperatureData.js", [ WebServerh, ConfigDatah ]()
@@ -284,6 +431,31 @@ void WebEvents (
       HandleSensorDataJS ( WebServerh, ConfigDatah, "/TemperatureData.js" );
    });
 
+   WebServerh->on ( "/Rollups.json", HTTP_GET, [ WebServerh, ConfigDatah ]()
+   {
+      HandleRollups ( WebServerh, ConfigDatah );
+   });
+
+   WebServerh->on ( "/TimingStats.json", HTTP_GET, [ WebServerh, ConfigDatah ]()
+   {
+      HandleTimingStats ( WebServerh, ConfigDatah );
+   });
+
+   WebServerh->on ( "/ProbeStatus.json", HTTP_GET, [ WebServerh, ConfigDatah ]()
+   {
+      HandleProbeStatus ( WebServerh, ConfigDatah );
+   });
+
+   WebServerh->on ( "/Screen.pbm", HTTP_GET, [ WebServerh, ConfigDatah ]()
+   {
+      HandleScreen ( WebServerh, ConfigDatah );
+   });
+
+   WebServerh->on ( "/History.json", HTTP_GET, [ WebServerh, ConfigDatah ]()
+   {
+      HandleHistory ( WebServerh, ConfigDatah );
+   });
+
    WebServerh->on ( "/RESTART", HTTP_POST, [ WebServerh, ConfigDatah ]()
    {
       HandleRestart ( WebServerh, ConfigDatah, "/Restarting.html" );
@@ -325,17 +497,13 @@ void WebEvents (
 //
 //             -  If the sensor configuration contains a label, this routine
 //                performs an automatic text substitution on all uncompressed
-//                files (substitution is not done on compressed files):
-//                   The first occurance of this text:
-//                      <span name="sensor_label"></span>
-//                   Is replaced by this text:
-//                      <span name="sensor_label">#Label#</span>
-//                   Where #Label# is the configuration value:
-//                      ConfigDatah->Label
+//                files (substitution is not done on compressed files), as the
+//                file is sent (see FillSensorName).
 //
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Label filled in as the file is sent.
 //
 // -----------------------------------------------------------------------------
 
@@ -371,27 +539,20 @@ static bool HandleFileRequest (
    {
       if ( ConfigDatah->LabelLength > 0 && Compressed == false )
       {
-         String   FileContent;
-         int      FileSize = 0;
+         PTemplate_t Page;
 
-         // Load the web page into memory so it can be modified.
-         FileSize = LoadFile ( SPIFFS, FilePath.c_str(), FileContent );
-
-         if ( FileSize > 0 )
-         {
-            ReplaceSensorName ( ConfigDatah, FileContent );
+         TemplateBegin ( &Page, WebServerh );
 
-            // Send the updated web page to the web client.
-            WebServerh->sendContent ( FileContent );
-            SentFileStatus = true;
-         }
+         SentFileStatus = TemplateRender ( &Page, SPIFFS, FilePath.c_str(), ContentType.c_str(),
+                                           FileFields, 1, FillSensorName, ConfigDatah
+                                         );
       }
 
       else
       {
          // If the file exists, either as a compressed archive, or normal
          File FileHandle = SPIFFS.open ( FilePath, "r" );
-         size_t Sent = WebServerh->streamFile ( FileHandle, ContentType.c_str() );
+         WebServerh->streamFile ( FileHandle, ContentType.c_str() );
          FileHandle.close();
          SentFileStatus = true;
       }
@@ -478,7 +639,7 @@ static void HandleFileUpload (
 
          Serial.printf ( "HandleFileUpload - Finished upload of file \"%s\" (%d bytes) \n",
                          FileName.c_str(),
-                         upload.totalSize
+                         (int) upload.totalSize
                        );
 
          // Redirect the client to the success page
@@ -522,12 +683,13 @@ static void HandleFileUpload (
 //
 // NOTES:      -  The configuraiton web page has built-in place holders for
 //                the current values.  This routine replaces those place holders
-//                with the actual stored values before the page is returned to
-//                the client.
+//                with the actual stored values as the page is sent to the
+//                client (see FillSensorConfig).
 //
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Filled in as it is sent, not loaded into a String.
 //
 // -----------------------------------------------------------------------------
 
@@ -537,81 +699,18 @@ static void HandleSensorConfigGet (
    const char*       FilePath
 )
 {
-   String   FileContent;
-   int      FileSize = 0;
+   PTemplate_t Page;
 
-   // Load the web page into memory so it can be modified.
-   FileSize = LoadFile ( SPIFFS, FilePath, FileContent );
+   TemplateBegin ( &Page, WebServerh );
 
-   if ( FileSize > 0 )
+   if ( TemplateRender ( &Page, SPIFFS, FilePath, "text/html",
+                         SensorConfigFields, SENSOR_FIELD_COUNT,
+                         FillSensorConfig, ConfigDatah
+                       ) == true )
    {
-      if ( ConfigDatah->LabelLength > 0 )
-      {
-         ReplaceSensorName ( ConfigDatah, FileContent );
-      }
-
-      // Replace the sensor temp probe radio place holder.
-      if ( ConfigDatah->Flags & CONFIG_TEMP_PROBE_CONNECTED )
-      {
-         FileContent.replace ( "\"set_probe_Y\"", "\"Y\" checked" );
-         FileContent.replace ( "\"set_probe_N\"", "\"N\"" );
-      }
-
-      else
-      {
-         FileContent.replace ( "\"set_probe_Y\"", "\"Y\"" );
-         FileContent.replace ( "\"set_probe_N\"", "\"N\" checked" );
-      }
-
-      // Replace the sensor relay radio place holder.
-      if ( ConfigDatah->Flags & CONFIG_DEVICE_RELAY_CONNECTED )
-      {
-         FileContent.replace ( "\"set_relay_Y\"", "\"Y\" checked" );
-         FileContent.replace ( "\"set_relay_N\"", "\"N\"" );
-      }
-
-      else
-      {
-         FileContent.replace ( "\"set_relay_Y\"", "\"Y\"" );
-         FileContent.replace ( "\"set_relay_N\"", "\"N\" checked" );
-      }
-
-      FileContent.replace ( "set_lowtemp",  String ( ConfigDatah->TempLowLimit ) );
-      FileContent.replace ( "set_hightemp", String ( ConfigDatah->TempHighLimit ) );
-      FileContent.replace ( "set_label",    ConfigDatah->Label );
-      FileContent.replace ( "set_interval", String ( ConfigDatah->SensorWaitTime / 1000 ) );
-
-      // Replace the fahrenheit radio place holder.
-      if ( ConfigDatah->Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT )
-      {
-         FileContent.replace ( "\"set_units_F\"", "\"F\" checked" );
-         FileContent.replace ( "\"set_units_C\"", "\"C\"" );
-      }
-
-      else
-      {
-         FileContent.replace ( "\"set_units_F\"", "\"F\"" );
-         FileContent.replace ( "\"set_units_C\"", "\"C\" checked" );
-      }
-
-      // Replace the debug message radio place holder.
-      if ( ConfigDatah->Flags & CONFIG_DEBUG_MESSAGE_ENABLED )
-      {
-         FileContent.replace ( "\"set_debug_Y\"", "\"Y\" checked" );
-         FileContent.replace ( "\"set_debug_N\"", "\"N\"" );
-      }
-
-      else
-      {
-         FileContent.replace ( "\"set_debug_Y\"", "\"Y\"" );
-         FileContent.replace ( "\"set_debug_N\"", "\"N\" checked" );
-      }
-
-
-      // Send the updated web page to the web client.
-      WebServerh->sendContent ( FileContent );
-
       Serial.printf ( "HandleSensorConfigGet - Sent file \"%s\" \n", FilePath );
+
+      ShowPageStats ( ConfigDatah, "HandleSensorConfigGet", &Page );
    }
 
    else
@@ -638,30 +737,32 @@ static void HandleSensorConfigGet (
 //
 //             ConfigDatah - Pointer to the configuration data structure.
 //
+//             ApplyConfig - Puts the changed settings into effect.
+//
 // RETURNS:    void
 //
-// NOTES:      -  WARNING: The serial log message and the returned HTML page
-//                both say that the new settings will take effect after a system
-//                restart, and that is true for all changes to take effect, but
-//                some new settings will take effect immediately because the
-//                values in the configuration structure have already been
-//                updated, and much of the system operates by directly examining
-//                those values.
+// NOTES:      -  The changes are put into effect straight away, and the
+//                client is sent to the success page.  Only if some of them
+//                need a restart is the system restarted, with the client
+//                sent to the restarting page instead (see HandleRestart).
 //
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Changes applied without a restart where they can be.
 //
 // -----------------------------------------------------------------------------
 
 static void HandleSensorConfigPost (
    ESP8266WebServer* WebServerh,
-   PConfig_t*        ConfigDatah
+   PConfig_t*        ConfigDatah,
+   ConfigApply_t     ApplyConfig
 )
 {
    String Message;
    boolean BitsChanged;
    boolean FlagsChanged = false;
+   PConfig_t Before = *ConfigDatah;
 
 
    if ( ConfigDatah->Flags & CONFIG_DEBUG_MESSAGE_ENABLED )
@@ -703,6 +804,15 @@ static void HandleSensorConfigPost (
    }
 
 
+   if (  WebServerh->hasArg ( "sensor_hysteresis" )
+      && WebServerh->hasArg ( "sensor_minon" )
+      && WebServerh->hasArg ( "sensor_minoff" )
+      )
+   {
+      ConfigRelayTiming ( WebServerh, ConfigDatah );
+   }
+
+
    if ( WebServerh->hasArg ( "sensor_label" ) )
    {
       ConfigSensorLabel ( WebServerh, ConfigDatah );
@@ -715,6 +825,14 @@ static void HandleSensorConfigPost (
    }
 
 
+   if (  WebServerh->hasArg ( "sensor_minwait" )
+      && WebServerh->hasArg ( "sensor_maxwait" )
+      )
+   {
+      ConfigWaitLimits ( WebServerh, ConfigDatah );
+   }
+
+
    if (  WebServerh->hasArg ( "sensor_units" )
          || ConfigDatah->Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT
       )
@@ -750,19 +868,23 @@ static void HandleSensorConfigPost (
 
    EEPROM.get ( PCONFIG_OFFSET, *ConfigDatah );
    ShowROMValues ( ConfigDatah, "After HandleSensorConfigPost:" );
-   Serial.println ( "   New settings will take effect after restart" );
 
 
-   // TODO: Set a run-time flag that tells the system to refresh the static parts
-   //       of the screen display in case the new settings changed the set points.
-
-   // TODO: Make this a static page in SPIFFS.
+   if ( ApplyConfig ( &Before ) == true )
+   {
+      Serial.println ( "   New settings will take effect after restart" );
+      HandleRestart ( WebServerh, ConfigDatah, "/Restarting.html" );
+   }
 
+   else
+   {
+      Serial.println ( "   New settings are in effect" );
 
-   // Redirect the client to the success page
-   WebServerh->sendHeader ( "Location", "/UpdateSuccess.html" );
-   // 303 - See other (redirect).
-   WebServerh->send ( 303 );
+      // Redirect the client to the success page
+      WebServerh->sendHeader ( "Location", "/UpdateSuccess.html" );
+      // 303 - See other (redirect).
+      WebServerh->send ( 303 );
+   }
 }
 
 // -----------------------------------------------< /HandleSensorConfigPost >---
@@ -786,12 +908,13 @@ static void HandleSensorConfigPost (
 //
 // NOTES:      -  The wifi configuraiton web page has built-in place holders for
 //                the current values.  This routine replaces those place holders
-//                with the actual stored values before the page is returned to
-//                the we client.
+//                with the actual stored values as the page is sent to the web
+//                client (see FillWifiConfig).
 //
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Filled in as it is sent, not loaded into a String.
 //
 // -----------------------------------------------------------------------------
 
@@ -801,88 +924,18 @@ static void HandleWifiConfigGet (
    const char*       FilePath
 )
 {
-   String   FileContent;
-   int      FileSize = 0;
+   PTemplate_t Page;
 
-   // Load the web page into memory so it can be modified.
-   FileSize = LoadFile ( SPIFFS, FilePath, FileContent );
+   TemplateBegin ( &Page, WebServerh );
 
-   if ( FileSize > 0 )
+   if ( TemplateRender ( &Page, SPIFFS, FilePath, "text/html",
+                         WifiConfigFields, WIFI_FIELD_COUNT,
+                         FillWifiConfig, ConfigDatah
+                       ) == true )
    {
-      if ( ConfigDatah->LabelLength > 0 )
-      {
-         ReplaceSensorName ( ConfigDatah, FileContent );
-      }
-
-      GetWifiNetworks( ConfigDatah, FileContent );
-
-      // Replaces the wifi station radio place holder.
-      if ( ConfigDatah->Flags & CONFIG_WIFI_STATION_ENABLED )
-      {
-         FileContent.replace ( "\"set_wifi_Y\"", "\"Y\" checked" );
-         FileContent.replace ( "\"set_wifi_N\"", "\"N\"" );
-      }
-
-      else
-      {
-         FileContent.replace ( "\"set_wifi_Y\"", "\"Y\"" );
-         FileContent.replace ( "\"set_wifi_N\"", "\"N\" checked" );
-      }
-
-      // Replaces the SSID name and password place holders.
-      FileContent.replace ( "set_ssid", ConfigDatah->WifiSSID );
-      FileContent.replace ( "set_pass", ConfigDatah->WifiPassword );
-
-      // Replace the Access Point IP address place holders.
-      FileContent.replace ( "set_ap0", String ( ConfigDatah->AccessIP [ 0 ] ) );
-      FileContent.replace ( "set_ap1", String ( ConfigDatah->AccessIP [ 1 ] ) );
-      FileContent.replace ( "set_ap2", String ( ConfigDatah->AccessIP [ 2 ] ) );
-      FileContent.replace ( "set_ap3", String ( ConfigDatah->AccessIP [ 3 ] ) );
-
-      // Replace the Access Point network mask place holders.
-      FileContent.replace ( "set_nm0", String ( ConfigDatah->NetMask [ 0 ] ) );
-      FileContent.replace ( "set_nm1", String ( ConfigDatah->NetMask [ 1 ] ) );
-      FileContent.replace ( "set_nm2", String ( ConfigDatah->NetMask [ 2 ] ) );
-      FileContent.replace ( "set_nm3", String ( ConfigDatah->NetMask [ 3 ] ) );
-
-      // Replace the Access Point gateway IP address place holders.
-      FileContent.replace ( "set_gw0", String ( ConfigDatah->Gateway [ 0 ] ) );
-      FileContent.replace ( "set_gw1", String ( ConfigDatah->Gateway [ 1 ] ) );
-      FileContent.replace ( "set_gw2", String ( ConfigDatah->Gateway [ 2 ] ) );
-      FileContent.replace ( "set_gw3", String ( ConfigDatah->Gateway [ 3 ] ) );
-
-      // Replace the Serial Baud rate place holders and set the "selected"
-      // property on the one that matches the current stored value.
-      for ( int i = 0; i < BAUD_LIST_SIZE; i++ )
-      {
-         String FieldID;
-         String IDValue;
-
-         FieldID  = "\"set_";
-         FieldID += BaudList[ i ];
-         FieldID += "\"";
-
-         IDValue = "\"";
-         IDValue += BaudList[ i ];
-         IDValue += "\"" ;
-         if ( ConfigDatah->SerialBaud == BaudList[ i ] )
-         {
-            IDValue += " selected";
-         }
-
-         FileContent.replace ( FieldID, IDValue );
-      }
-
-      // Replaces the HTML web server port place holder.
-      FileContent.replace ( "set_webport", String ( ConfigDatah->WebServerPort ) );
-
-      // Replaces the WS server port place holder.
-      FileContent.replace ( "set_wsport", String ( ConfigDatah->WebSocketServerPort ) );
-
-      // Send the updated web page to the web client.
-      WebServerh->sendContent ( FileContent );
-
       Serial.printf ( "HandleWifiConfigGet - Sent file \"%s\" \n", FilePath );
+
+      ShowPageStats ( ConfigDatah, "HandleWifiConfigGet", &Page );
    }
 
    else
@@ -909,22 +962,29 @@ static void HandleWifiConfigGet (
 //
 //             ConfigDatah - Pointer to the configuration data structure.
 //
+//             ApplyConfig - Puts the changed settings into effect.
+//
 // RETURNS:    void
 //
-// NOTES:
+// NOTES:      -  New ports and baud rate restart just the service that uses
+//                them.  The system is only restarted for changes to the wifi
+//                connection itself (see HandleSensorConfigPost).
 //
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Changes applied without a restart where they can be.
 //
 // -----------------------------------------------------------------------------
 
 static void HandleWifiConfigPost (
    ESP8266WebServer* WebServerh,
-   PConfig_t*        ConfigDatah
+   PConfig_t*        ConfigDatah,
+   ConfigApply_t     ApplyConfig
 )
 {
    String Message;
+   PConfig_t Before = *ConfigDatah;
 
    if ( ConfigDatah->Flags & CONFIG_DEBUG_MESSAGE_ENABLED )
    {
@@ -1007,13 +1067,22 @@ static void HandleWifiConfigPost (
 
    EEPROM.get ( PCONFIG_OFFSET, *ConfigDatah );
    ShowROMValues ( ConfigDatah, "After HandleWifiConfigPost:" );
-   Serial.println ( "   New settings will take effect after restart" );
 
+   if ( ApplyConfig ( &Before ) == true )
+   {
+      Serial.println ( "   New settings will take effect after restart" );
+      HandleRestart ( WebServerh, ConfigDatah, "/Restarting.html" );
+   }
+
+   else
+   {
+      Serial.println ( "   New settings are in effect" );
 
-   // Redirect the client to the success page.
-   WebServerh->sendHeader ( "Location", "/UpdateSuccess.html" );
-   // 303 - See other (redirect).
-   WebServerh->send ( 303 );
+      // Redirect the client to the success page.
+      WebServerh->sendHeader ( "Location", "/UpdateSuccess.html" );
+      // 303 - See other (redirect).
+      WebServerh->send ( 303 );
+   }
 }
 
 // -------------------------------------------------< /HandleWifiConfigPost >---
@@ -1041,6 +1110,7 @@ static void HandleWifiConfigPost (
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Filled in as it is sent, not loaded into a String.
 //
 // -----------------------------------------------------------------------------
 
@@ -1050,28 +1120,17 @@ static void HandleSensorDataJS (
    const char*       FilePath
 )
 {
-   String   FileContent;
-   int      FileSize = 0;
+   PTemplate_t Page;
 
-   // Load the web page into memory so it can be modified.
-   FileSize = LoadFile ( SPIFFS, FilePath, FileContent );
+   TemplateBegin ( &Page, WebServerh );
 
-   if ( FileSize > 0 )
+   if ( TemplateRender ( &Page, SPIFFS, FilePath, "application/javascript",
+                         ScriptFields, 1, FillSensorDataJS, ConfigDatah
+                       ) == true )
    {
-      String NewURL = String ( "ws://" );
-      NewURL += String ( ConfigDatah->StationIP[ 0 ] ) + String ( "." );
-      NewURL += String ( ConfigDatah->StationIP[ 1 ] ) + String ( "." );
-      NewURL += String ( ConfigDatah->StationIP[ 2 ] ) + String ( "." );
-      NewURL += String ( ConfigDatah->StationIP[ 3 ] ) + String ( ":" );
-      NewURL += String ( ConfigDatah->WebSocketServerPort );
-
-      // Replaces the javascript place holder for the wifi IP address.
-      FileContent.replace ( "ws://w.x.y.z:p", NewURL );
-
-      // Send the updated web page to the web client.
-      WebServerh->sendContent ( FileContent );
-
       Serial.printf ( "HandleSensorDataJS - Sent file \"%s\" \n", FilePath );
+
+      ShowPageStats ( ConfigDatah, "HandleSensorDataJS", &Page );
    }
 
    else
@@ -1087,6 +1146,448 @@ static void HandleSensorDataJS (
 
 
 
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< HandleTimingStats >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    A web server event handler to return the code path timing
+//             statistics as JSON.
+//
+// PARAMETERS: WebServerh - Handle to the web server.
+//
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+// RETURNS:    void
+//
+// NOTES:      -  A request of the form /TimingStats.json?reset=Y returns the
+//                current statistics and then clears them, so that a "before"
+//                and "after" measurement can be taken without a restart.
+//
+//             -  All times are reported in microseconds.
+//
+//             -  The number of times the relay has changed state is included,
+//                so relay cycling can be measured along with the timing.
+//
+//             -  So are the I2C bytes sent to the screen, with what sending
+//                the full frame every time would have cost for comparison,
+//                and how many screen areas were drawn or skipped as unchanged.
+//
+//             -  The I2C bus time of the last flush and of a full frame are
+//                given for both the 100 kHz and 400 kHz clock ("Us100" and
+//                "Us400").
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Screen I2C byte counts.
+// 16Oct2026 DSVance    - Screen redraws and skips.
+// 16Oct2026 DSVance    - Screen I2C transmissions and bus time.
+//
+// -----------------------------------------------------------------------------
+
+static void HandleTimingStats (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+)
+{
+   String   Message;
+   char     Entry[ 256 ];
+
+   sprintf ( Entry, "{\"Uptime\":%lu,\"FreeHeap\":%u,\"MinFreeHeap\":%u,\"RelayTransitions\":%u,\"Timing\":[",
+             millis() / 1000,
+             ESP.getFreeHeap(),
+             MinFreeHeap,
+             RelayTransitions
+           );
+   Message = Entry;
+
+   for ( int i = 0; i < TIMING_COUNT; i++ )
+   {
+      TStats_t* Stats = &TimingTable[ i ];
+
+      sprintf ( Entry, "%s{\"Name\":\"%s\",\"Count\":%u,\"Last\":%u,\"Max\":%u,\"Avg\":%u}",
+                ( i > 0 ) ? "," : "",
+                Stats->Name,
+                Stats->Count,
+                TimingMicros ( Stats->LastCycles ),
+                TimingMicros ( Stats->MaxCycles ),
+                ( Stats->Count > 0 )
+                ? TimingMicros ( (uint32_t) ( Stats->TotalCycles / Stats->Count ) )
+                : 0
+              );
+      Message += Entry;
+   }
+
+   sprintf ( Entry, "],\"Display\":{\"Flushes\":%u,\"Pages\":%u,\"Bytes\":%u,\"Last\":%u,\"Full\":%u,"
+                    "\"Transmissions\":%u,\"Redraws\":%u,\"Skips\":%u,",
+             DisplayStats.Flushes,
+             DisplayStats.Pages,
+             DisplayStats.Bytes,
+             DisplayStats.LastBytes,
+             DisplayFullBytes(),
+             DisplayStats.Transmissions,
+             DisplayStats.Redraws,
+             DisplayStats.Skips
+           );
+   Message += Entry;
+
+   sprintf ( Entry, "\"LastUs100\":%u,\"LastUs400\":%u,\"FullUs100\":%u,\"FullUs400\":%u}}",
+             DisplayBusMicros ( DisplayStats.LastBytes, DisplayStats.LastTransmissions, DISPLAY_I2C_IDLE_CLOCK ),
+             DisplayBusMicros ( DisplayStats.LastBytes, DisplayStats.LastTransmissions, DISPLAY_I2C_CLOCK ),
+             DisplayBusMicros ( DisplayFullBytes(), DisplayFullTransmissions(), DISPLAY_I2C_IDLE_CLOCK ),
+             DisplayBusMicros ( DisplayFullBytes(), DisplayFullTransmissions(), DISPLAY_I2C_CLOCK )
+           );
+   Message += Entry;
+
+   WebServerh->send ( 200, "application/json", Message );
+
+   DEBUG_PRINTF ( ConfigDatah, "DEBUG: HandleTimingStats - Sent %u bytes \n", Message.length() );
+
+   if ( WebServerh->arg ( "reset" ).equalsIgnoreCase ( String ( "Y" ) ) )
+   {
+      TimingReset();
+      DisplayResetStats();
+   }
+}
+
+// ----------------------------------------------------< /HandleTimingStats >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< HandleProbeStatus >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    A web server event handler to return the fault counts of each
+//             temperature probe as JSON.
+//
+// PARAMETERS: WebServerh - Handle to the web server.
+//
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Each probe is listed by its ROM address, with the number of
+//                reads, the faults by kind, the retries, and the samples that
+//                were reported as invalid after all retries failed.  A count
+//                that keeps rising points to bad wiring or a failing probe.
+//
+//             -  "Last" is the result of the most recent read (0 is good, see
+//                the PROBE_FAULT_... values).
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void HandleProbeStatus (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+)
+{
+   String   Message;
+   char     Entry[ 192 ];
+
+   sprintf ( Entry, "{\"Uptime\":%lu,\"Probes\":[", millis() / 1000 );
+   Message = Entry;
+
+   for ( uint8_t i = 0; i < ProbeCount; i++ )
+   {
+      PFaults_t*  Faults  = &ProbeFaults[ i ];
+      uint8_t*    Address = ProbeAddress[ i ];
+
+      sprintf ( Entry, "%s{\"Address\":\"%02x%02x%02x%02x%02x%02x%02x%02x\","
+                       "\"Reads\":%u,\"NoReply\":%u,\"CRC\":%u,\"PowerOn\":%u,"
+                       "\"Retries\":%u,\"Invalid\":%u,\"Last\":%u}",
+                ( i > 0 ) ? "," : "",
+                Address[ 0 ], Address[ 1 ], Address[ 2 ], Address[ 3 ],
+                Address[ 4 ], Address[ 5 ], Address[ 6 ], Address[ 7 ],
+                Faults->Reads,
+                Faults->NoReply,
+                Faults->CRC,
+                Faults->PowerOn,
+                Faults->Retries,
+                Faults->Invalid,
+                Faults->LastStatus
+              );
+      Message += Entry;
+   }
+
+   Message += "]}";
+
+   WebServerh->send ( 200, "application/json", Message );
+
+   DEBUG_PRINTF ( ConfigDatah, "DEBUG: HandleProbeStatus - Sent %u bytes \n", Message.length() );
+}
+
+// ----------------------------------------------------< /HandleProbeStatus >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< HandleScreen >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    A web server event handler to return what the screen is showing
+//             as a binary PBM image.
+//
+// PARAMETERS: WebServerh - Handle to the web server.
+//
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The image is made from the copy of the screen contents kept
+//                by DisplayFlush(), so it is exactly what was sent over I2C.
+//                Saved images can be compared to check that a change to the
+//                display code still draws the same screens.
+//
+//             -  It is sent a page (8 rows) at a time from a buffer on the
+//                stack.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void HandleScreen (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+)
+{
+   uint8_t     Chunk[ DISPLAY_PBM_PAGE ];
+   char        Header[ 16 ];
+   int         Length;
+
+   Length = sprintf ( Header, "P4\n%u %u\n", DISPLAY_WIDTH, DISPLAY_HEIGHT );
+
+   WebServerh->setContentLength ( Length + DISPLAY_PBM_PAGE * DISPLAY_PAGES );
+   WebServerh->send ( 200, "image/x-portable-bitmap", "" );
+   WebServerh->sendContent ( Header, Length );
+
+   for ( uint8_t Page = 0; Page < DISPLAY_PAGES; Page++ )
+   {
+      DisplayPBMPage ( Page, Chunk );
+      WebServerh->sendContent ( (const char*) Chunk, DISPLAY_PBM_PAGE );
+   }
+
+   DEBUG_PRINTF ( ConfigDatah, "DEBUG: HandleScreen - Sent %u bytes \n",
+                  Length + DISPLAY_PBM_PAGE * DISPLAY_PAGES
+                );
+}
+
+// ---------------------------------------------------------< /HandleScreen >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< HandleHistory >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    A web server event handler to return the history of recent
+//             sensor readings as JSON.
+//
+// PARAMETERS: WebServerh - Handle to the web server.
+//
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The response is sent in chunks from a small buffer on the
+//                stack as the history is read, so the memory needed does not
+//                depend on how many readings there are.
+//
+//             -  A request of the form /History.json?count=N returns only the
+//                N most recent readings.
+//
+//             -  The response looks like:
+//                {"Now":1234,"Units":"F","Samples":[[1200,0,72.50],...]}
+//                where each sample is the uptime in seconds when it was taken,
+//                the probe number, and the temperature in the units currently
+//                configured for display.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void HandleHistory (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+)
+{
+   char        Chunk[ HISTORY_CHUNK_SIZE ];
+   int         Length;
+   uint32_t    Sent = 0;
+   HCursor_t   Cursor;
+   uint8_t     Probe;
+   int16_t     Value;
+   uint32_t    Time;
+   bool        First = true;
+
+   HistoryFirst ( &Cursor, WebServerh->arg ( "count" ).toInt() );
+
+   WebServerh->setContentLength ( CONTENT_LENGTH_UNKNOWN );
+   WebServerh->send ( 200, "application/json", "" );
+
+   Length = sprintf ( Chunk, "{\"Now\":%lu,\"Units\":\"%s\",\"Samples\":[",
+                      millis() / 1000,
+                      ( ConfigDatah->Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT ) ? "F" : "C"
+                    );
+
+   while ( HistoryNext ( &Cursor, &Probe, &Value, &Time ) )
+   {
+      // Send what has been built so far once there might not be room for
+      // another sample.
+      if ( Length > HISTORY_CHUNK_SIZE - HISTORY_SAMPLE_MAX )
+      {
+         WebServerh->sendContent ( Chunk, Length );
+         Sent  += Length;
+         Length = 0;
+      }
+
+      Length += sprintf ( &Chunk[ Length ], "%s[%u,%u,",
+                          First ? "" : ",",
+                          Time,
+                          Probe
+                        );
+      Length += FormatFixed ( &Chunk[ Length ], FixedUnits ( ConfigDatah, Value ), 2 );
+      Chunk[ Length++ ] = ']';
+
+      First = false;
+   }
+
+   Length += sprintf ( &Chunk[ Length ], "]}" );
+   WebServerh->sendContent ( Chunk, Length );
+   Sent += Length;
+
+   // An empty chunk marks the end of the response.
+   WebServerh->sendContent ( "" );
+
+   DEBUG_PRINTF ( ConfigDatah, "DEBUG: HandleHistory - Sent %u bytes \n", Sent );
+}
+
+// --------------------------------------------------------< /HandleHistory >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< HandleRollups >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    A web server event handler to return the minimum, maximum, and
+//             average readings over each window of time as JSON.
+//
+// PARAMETERS: WebServerh - Handle to the web server.
+//
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The response looks like:
+//                {"Now":1234,"Units":"F","Tiers":[{"Name":"1m","Seconds":60,
+//                 "Windows":[[1140,71.60,72.50,72.05,12],...]},...]}
+//                where each window is its start time (uptime in seconds), the
+//                minimum, maximum, average, and number of readings.  The last
+//                window of each tier is the one still open.
+//
+//             -  Like /History.json the response is sent in chunks from a
+//                buffer on the stack.  The chunk is sent whenever the next
+//                piece of text might not fit in what is left of it.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Make room for the tier text, not just the windows.
+//
+// -----------------------------------------------------------------------------
+
+static void HandleRollups (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+)
+{
+   char        Chunk[ HISTORY_CHUNK_SIZE ];
+   int         Length;
+   uint32_t    Sent = 0;
+   RWindow_t   Window;
+
+   // Send the chunk so far if the next n bytes (and a NULL) might not fit.
+   #define ROLLUP_ROOM(n)                                                 \
+      if ( Length > HISTORY_CHUNK_SIZE - (int) (n) - 1 )                  \
+      {                                                                   \
+         WebServerh->sendContent ( Chunk, Length );                       \
+         Sent  += Length;                                                 \
+         Length = 0;                                                      \
+      }
+
+   WebServerh->setContentLength ( CONTENT_LENGTH_UNKNOWN );
+   WebServerh->send ( 200, "application/json", "" );
+
+   Length = sprintf ( Chunk, "{\"Now\":%lu,\"Units\":\"%s\",\"Tiers\":[",
+                      millis() / 1000,
+                      ( ConfigDatah->Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT ) ? "F" : "C"
+                    );
+
+   for ( uint8_t i = 0; i < ROLLUP_TIER_COUNT; i++ )
+   {
+      RTier_t* Tier = &RollupTable[ i ];
+
+      ROLLUP_ROOM ( ROLLUP_TIER_MAX );
+
+      Length += sprintf ( &Chunk[ Length ], "%s{\"Name\":\"%s\",\"Seconds\":%u,\"Windows\":[",
+                          ( i > 0 ) ? "," : "",
+                          Tier->Name,
+                          Tier->Seconds
+                        );
+
+      // The closed windows oldest first, followed by the open one.
+      for ( uint8_t w = 0; w <= Tier->Total; w++ )
+      {
+         if (  ( w <  Tier->Total && RollupClosed  ( i, w, &Window ) )
+            || ( w == Tier->Total && RollupCurrent ( i, &Window )    )
+            )
+         {
+            ROLLUP_ROOM ( ROLLUP_WINDOW_MAX );
+
+            Length += sprintf ( &Chunk[ Length ], "%s[%u,",
+                                ( w > 0 ) ? "," : "",
+                                Window.Start
+                              );
+            Length += FormatFixed ( &Chunk[ Length ], FixedUnits ( ConfigDatah, Window.Min ), 2 );
+            Chunk[ Length++ ] = ',';
+            Length += FormatFixed ( &Chunk[ Length ], FixedUnits ( ConfigDatah, Window.Max ), 2 );
+            Chunk[ Length++ ] = ',';
+            Length += FormatFixed ( &Chunk[ Length ], FixedUnits ( ConfigDatah, Window.Avg ), 2 );
+            Length += sprintf ( &Chunk[ Length ], ",%u]", Window.Count );
+         }
+      }
+
+      ROLLUP_ROOM ( 2 );
+      Length += sprintf ( &Chunk[ Length ], "]}" );
+   }
+
+   ROLLUP_ROOM ( 2 );
+   Length += sprintf ( &Chunk[ Length ], "]}" );
+   WebServerh->sendContent ( Chunk, Length );
+   Sent += Length;
+
+   // An empty chunk marks the end of the response.
+   WebServerh->sendContent ( "" );
+
+   DEBUG_PRINTF ( ConfigDatah, "DEBUG: HandleRollups - Sent %u bytes \n", Sent );
+
+   #undef ROLLUP_ROOM
+}
+
+// --------------------------------------------------------< /HandleRollups >---
+
+
+
+
 // -----------------------------------------------------------------------------
 // ---------------------------------------------------------< RestartSystem >---
 // -----------------------------------------------------------------------------
@@ -1300,11 +1801,14 @@ static boolean ConfigRelay (
 //
 // RETURNS:    void
 //
-// NOTES:
+// NOTES:      -  A set point outside PCONFIG_MIN_LIMIT to PCONFIG_MAX_LIMIT is
+//                reported on the serial log and ignored, rather than cut down
+//                to 16 bits.
 //
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Range checked.
 //
 // -----------------------------------------------------------------------------
 
@@ -1315,9 +1819,19 @@ static void ConfigLowTemp (
 {
    assert ( sizeof ( ConfigDatah->TempLowLimit ) == sizeof ( int16_t ) );
 
-   int16_t Value = (int16_t) WebServerh->arg("sensor_lowtemp").toInt();
+   long    Entry = WebServerh->arg("sensor_lowtemp").toInt();
+   int16_t Value = (int16_t) Entry;
 
-   if ( Value == 0 )
+   if ( Entry < PCONFIG_MIN_LIMIT || Entry > PCONFIG_MAX_LIMIT )
+   {
+      Serial.printf ( "ERROR: The temperature set points must be %d to %d!  Ignoring setting. \n",
+                      PCONFIG_MIN_LIMIT,
+                      PCONFIG_MAX_LIMIT
+                    );
+      Value = ConfigDatah->TempLowLimit;
+   }
+
+   else if ( Value == 0 )
    {
       // The value might be zero because that was what was entered in the web
       // page, or it might be because the web entry cannot be converted to int.
@@ -1357,11 +1871,14 @@ static void ConfigLowTemp (
 //
 // RETURNS:    void
 //
-// NOTES:
+// NOTES:      -  A set point outside PCONFIG_MIN_LIMIT to PCONFIG_MAX_LIMIT is
+//                reported on the serial log and ignored, rather than cut down
+//                to 16 bits.
 //
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Range checked.
 //
 // -----------------------------------------------------------------------------
 
@@ -1372,9 +1889,19 @@ static void ConfigHighTemp (
 {
    assert ( sizeof ( ConfigDatah->TempHighLimit ) == sizeof ( int16_t ) );
 
-   int16_t Value = (int16_t) WebServerh->arg("sensor_hightemp").toInt();
+   long    Entry = WebServerh->arg("sensor_hightemp").toInt();
+   int16_t Value = (int16_t) Entry;
 
-   if ( Value == 0 )
+   if ( Entry < PCONFIG_MIN_LIMIT || Entry > PCONFIG_MAX_LIMIT )
+   {
+      Serial.printf ( "ERROR: The temperature set points must be %d to %d!  Ignoring setting. \n",
+                      PCONFIG_MIN_LIMIT,
+                      PCONFIG_MAX_LIMIT
+                    );
+      Value = ConfigDatah->TempHighLimit;
+   }
+
+   else if ( Value == 0 )
    {
       // The value might be zero because that was what was entered in the web
       // page, or it might be because the web entry cannot be converted to int.
@@ -1412,7 +1939,7 @@ static void ConfigHighTemp (
 //
 //             ConfigDatah - Pointer to the configuration data structure.
 //
-// RETURNS:    void
+// RETURNS:    uint8_t - The length of the label now in use.
 //
 // NOTES:      -  A label that is longer than the allowed maximum is reported
 //                the serial log, but otherwise quietly ignored.
@@ -1420,10 +1947,11 @@ static void ConfigHighTemp (
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - New label copied into the configuration in use.
 //
 // -----------------------------------------------------------------------------
 
-static boolean ConfigSensorLabel (
+static uint8_t ConfigSensorLabel (
    ESP8266WebServer* WebServerh,
    PConfig_t*        ConfigDatah
 )
@@ -1444,36 +1972,176 @@ static boolean ConfigSensorLabel (
       {
          char Value[ PCONFIG_MAX_LABEL + 1 ];
 
-         WebServerh->arg("sensor_label").toCharArray( Value, PCONFIG_MAX_LABEL );
+         WebServerh->arg("sensor_label").toCharArray( Value, sizeof ( Value ) );
+
+         // Add a NULL terminator to the string value.
+         Value[ ValueLength ] = 0;
+
+         SetROMValue ( PCONFIG_OFFSET_LABEL,
+                       (uint8_t*) &Value,
+                       ValueLength + 1
+                     );
+
+         SetROMValue ( PCONFIG_OFFSET_LABELLENGTH,
+                       (uint8_t*) &ValueLength,
+                       sizeof ( ValueLength )
+                     );
+
+         ConfigDatah->LabelLength = ValueLength;
+         memcpy ( ConfigDatah->Label, Value, ValueLength + 1 );
+      }
+   }
+
+   return ConfigDatah->LabelLength;
+}
+
+// ----------------------------------------------------< /ConfigSensorLabel >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------< ConfigWaitInterval >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Update the WAIT TIME INTERVAL from a web form entry.
+//
+// PARAMETERS: WebServerh - Handle to the web server.
+//
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+// RETURNS:    void
+//
+// NOTES:      -  WARNING: A wait time of zero seconds is not allowed and if
+//                specified, will quietly be ignored (noted on serial log).
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 30Nov2018 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void ConfigWaitInterval (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+)
+{
+   assert ( sizeof ( ConfigDatah->SensorWaitTime ) == sizeof ( int32_t ) );
+
+   int32_t Value = (int32_t) WebServerh->arg("sensor_interval").toInt();
+
+   if ( Value == 0 )
+   {
+      // Do not allow a zero interval.  Trick the code into
+      // ignoring the entry and not updating the stored value.
+      Serial.printf ( "ERROR: The sensor read interval cannot be zero!  Ignoring setting. \n" );
+      Value = ConfigDatah->SensorWaitTime / 1000;
+   }
+
+   // Web page specification is for seconds, but stored value is milliseconds.
+   Value *= 1000;
+
+   if ( Value != (int32_t) ConfigDatah->SensorWaitTime )
+   {
+      SetROMValue ( PCONFIG_OFFSET_SENSORWAITTIME,
+                    (uint8_t*) &Value,
+                    sizeof ( ConfigDatah->SensorWaitTime )
+                  );
+
+      ConfigDatah->SensorWaitTime = Value;
+   }
+}
+
+// ---------------------------------------------------< /ConfigWaitInterval >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< ConfigWaitLimits >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Update the SHORTEST and LONGEST adaptive wait times from web form
+//             entries.
+//
+// PARAMETERS: WebServerh - Handle to the web server.
+//
+//             ConfigDatah - Pointer to the configuration data structure.
+//
+// RETURNS:    void
+//
+// NOTES:      -  A value of zero for either one turns the adaptive interval
+//                off, and the fixed wait time interval is always used.
+//
+//             -  WARNING: A shortest time that is longer than the longest time,
+//                or either one longer than a day (PCONFIG_MAX_WAIT), is not
+//                allowed and if specified, both entries will quietly be
+//                ignored (noted on serial log).
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - No more than PCONFIG_MAX_WAIT, as checked on start up.
+//
+// -----------------------------------------------------------------------------
+
+static void ConfigWaitLimits (
+   ESP8266WebServer* WebServerh,
+   PConfig_t*        ConfigDatah
+)
+{
+   assert ( sizeof ( ConfigDatah->SensorWaitMin ) == sizeof ( int32_t ) );
+   assert ( sizeof ( ConfigDatah->SensorWaitMax ) == sizeof ( int32_t ) );
+
+   int32_t MinValue = (int32_t) WebServerh->arg("sensor_minwait").toInt();
+   int32_t MaxValue = (int32_t) WebServerh->arg("sensor_maxwait").toInt();
+
+   if (  MinValue < 0 || MaxValue < 0 || ( MaxValue > 0 && MinValue > MaxValue )
+      || MinValue > (int32_t) ( PCONFIG_MAX_WAIT / 1000 ) || MaxValue > (int32_t) ( PCONFIG_MAX_WAIT / 1000 )
+      )
+   {
+      // Trick the code into ignoring the entries and not updating the
+      // stored values.
+      Serial.printf ( "ERROR: The wait times must be 0 to %lu seconds, shortest first!  Ignoring settings. \n",
+                      PCONFIG_MAX_WAIT / 1000
+                    );
+      MinValue = ConfigDatah->SensorWaitMin / 1000;
+      MaxValue = ConfigDatah->SensorWaitMax / 1000;
+   }
+
+   // Web page specification is for seconds, but stored value is milliseconds.
+   MinValue *= 1000;
+   MaxValue *= 1000;
 
-         // Add a NULL terminator to the string value.
-         Value[ ValueLength ] = 0;
+   if ( MinValue != (int32_t) ConfigDatah->SensorWaitMin )
+   {
+      SetROMValue ( PCONFIG_OFFSET_SENSORWAITMIN,
+                    (uint8_t*) &MinValue,
+                    sizeof ( ConfigDatah->SensorWaitMin )
+                  );
 
-         SetROMValue ( PCONFIG_OFFSET_LABEL,
-                       (uint8_t*) &Value,
-                       ValueLength + 1
-                     );
+      ConfigDatah->SensorWaitMin = MinValue;
+   }
 
-         SetROMValue ( PCONFIG_OFFSET_LABELLENGTH,
-                       (uint8_t*) &ValueLength,
-                       sizeof ( ValueLength )
-                     );
+   if ( MaxValue != (int32_t) ConfigDatah->SensorWaitMax )
+   {
+      SetROMValue ( PCONFIG_OFFSET_SENSORWAITMAX,
+                    (uint8_t*) &MaxValue,
+                    sizeof ( ConfigDatah->SensorWaitMax )
+                  );
 
-         ConfigDatah->LabelLength = ValueLength;
-         memcpy ( Value, ConfigDatah->Label, ValueLength + 1 );
-      }
+      ConfigDatah->SensorWaitMax = MaxValue;
    }
 }
 
-// ----------------------------------------------------< /ConfigSensorLabel >---
+// -----------------------------------------------------< /ConfigWaitLimits >---
 
 
 
 // -----------------------------------------------------------------------------
-// ----------------------------------------------------< ConfigWaitInterval >---
+// -----------------------------------------------------< ConfigRelayTiming >---
 // -----------------------------------------------------------------------------
 //
-// PURPOSE:    Update the WAIT TIME INTERVAL from a web form entry.
+// PURPOSE:    Update the relay HYSTERESIS band and MINIMUM ON and OFF times from
+//             web form entries.
 //
 // PARAMETERS: WebServerh - Handle to the web server.
 //
@@ -1481,47 +2149,80 @@ static boolean ConfigSensorLabel (
 //
 // RETURNS:    void
 //
-// NOTES:      -  WARNING: A wait time of zero seconds is not allowed and if
-//                specified, will quietly be ignored (noted on serial log).
+// NOTES:      -  The hysteresis is entered in degrees with one decimal place,
+//                but stored as tenths of a degree.
+//
+//             -  WARNING: Values that are negative or above the limits checked
+//                on start up (PCONFIG_MAX_HYSTERESIS, PCONFIG_MAX_RELAY_TIME)
+//                are not allowed and if specified, will quietly be ignored
+//                (noted on serial log).
 //
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
-// 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Use the limits checked on start up.
 //
 // -----------------------------------------------------------------------------
 
-static void ConfigWaitInterval (
+static void ConfigRelayTiming (
    ESP8266WebServer* WebServerh,
    PConfig_t*        ConfigDatah
 )
 {
-   assert ( sizeof ( ConfigDatah->SensorWaitTime ) == sizeof ( int32_t ) );
+   int32_t Band   = (int32_t) lroundf ( WebServerh->arg("sensor_hysteresis").toFloat() * 10 );
+   int32_t MinOn  = (int32_t) WebServerh->arg("sensor_minon").toInt();
+   int32_t MinOff = (int32_t) WebServerh->arg("sensor_minoff").toInt();
 
-   int32_t Value = (int32_t) WebServerh->arg("sensor_interval").toInt();
+   if ( Band < 0 || Band > PCONFIG_MAX_HYSTERESIS )
+   {
+      Serial.printf ( "ERROR: The hysteresis must be 0.0 to %u.%u degrees!  Ignoring setting. \n",
+                      PCONFIG_MAX_HYSTERESIS / 10,
+                      PCONFIG_MAX_HYSTERESIS % 10
+                    );
+      Band = ConfigDatah->TempHysteresis;
+   }
 
-   if ( Value == 0 )
+   if ( MinOn < 0 || MinOn > PCONFIG_MAX_RELAY_TIME || MinOff < 0 || MinOff > PCONFIG_MAX_RELAY_TIME )
    {
-      // Do not allow a zero interval.  Trick the code into
-      // ignoring the entry and not updating the stored value.
-      Serial.printf ( "ERROR: The sensor read interval cannot be zero!  Ignoring setting. \n" );
-      Value = ConfigDatah->SensorWaitTime / 1000;
+      Serial.printf ( "ERROR: The relay minimum times must be 0 to %u seconds!  Ignoring settings. \n",
+                      PCONFIG_MAX_RELAY_TIME
+                    );
+      MinOn  = ConfigDatah->RelayMinOnTime;
+      MinOff = ConfigDatah->RelayMinOffTime;
    }
 
-   // Web page specification is for seconds, but stored value is milliseconds.
-   Value *= 1000;
+   if ( Band != ConfigDatah->TempHysteresis )
+   {
+      ConfigDatah->TempHysteresis = Band;
+
+      SetROMValue ( PCONFIG_OFFSET_TEMPHYSTERESIS,
+                    (uint8_t*) &ConfigDatah->TempHysteresis,
+                    sizeof ( ConfigDatah->TempHysteresis )
+                  );
+   }
 
-   if ( Value != ConfigDatah->SensorWaitTime )
+   if ( MinOn != ConfigDatah->RelayMinOnTime )
    {
-      SetROMValue ( PCONFIG_OFFSET_SENSORWAITTIME,
-                    (uint8_t*) &Value,
-                    sizeof ( ConfigDatah->SensorWaitTime )
+      ConfigDatah->RelayMinOnTime = MinOn;
+
+      SetROMValue ( PCONFIG_OFFSET_RELAYMINONTIME,
+                    (uint8_t*) &ConfigDatah->RelayMinOnTime,
+                    sizeof ( ConfigDatah->RelayMinOnTime )
                   );
+   }
 
-      ConfigDatah->SensorWaitTime = Value;
+   if ( MinOff != ConfigDatah->RelayMinOffTime )
+   {
+      ConfigDatah->RelayMinOffTime = MinOff;
+
+      SetROMValue ( PCONFIG_OFFSET_RELAYMINOFFTIME,
+                    (uint8_t*) &ConfigDatah->RelayMinOffTime,
+                    sizeof ( ConfigDatah->RelayMinOffTime )
+                  );
    }
 }
 
-// ---------------------------------------------------< /ConfigWaitInterval >---
+// ----------------------------------------------------< /ConfigRelayTiming >---
 
 
 
@@ -2134,7 +2835,7 @@ static void ConfigBaud (
 
    for ( int i = 0; i < BAUD_LIST_SIZE; i++ )
    {
-      if ( Value == BaudList[ i ] )
+      if ( Value == (uint32_t) BaudList[ i ] )
       {
          InList = true;
       }
@@ -2281,51 +2982,348 @@ static void ConfigDataPort (
 
 
 // -----------------------------------------------------------------------------
-// -----------------------------------------------------< ReplaceSensorName >---
+// --------------------------------------------------------< FillSensorName >---
 // -----------------------------------------------------------------------------
 //
-// PURPOSE:    
+// PURPOSE:    Fill in the sensor name place holder of a page being sent.
 //
-// PARAMETERS: ConfigDatah - Pointer to the configuration data structure.
+// PARAMETERS: Page - The page being sent.
 //
-//             HTMLFile - The contents of the HTML source to be updated.
+//             Field - The place holder found, which is always the sensor name.
 //
-// RETURNS:    bool == 'true' when the content was updated.
-//                  == 'false' if the file was not updated (no sensor label).
+//             Context - Pointer to the configuration data structure.
+//
+// RETURNS:    bool == 'true' when the place holder was filled in.
+//                  == 'false' if there is no sensor label, so the place holder
+//                     is sent as it is.
 //
 // NOTES:      -  If the sensor configuration contains a label and there is a
-//                place-holder in the HTML for it, a text substitution is used
-//                to insert the label into the content of the page.
-//                   The first occurance of this text:
+//                place-holder in the HTML for it, the label is inserted into
+//                the content of the page.
+//                   This text:
 //                      <span name="sensor_name"></span>
 //                   Is replaced by this text:
-//                      <span name="sensor_name">#Label#</span>
+//                      <span name="sensor_name"><a href="/">#Label#</a></span>
 //                   Where #Label# is the configuration value:
 //                      ConfigDatah->Label
 //
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 02Feb2019 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Written to the page as it is sent.
 //
 // -----------------------------------------------------------------------------
 
-static void ReplaceSensorName (
-   PConfig_t*  ConfigDatah,
-   String&     HTMLFile
+static bool FillSensorName (
+   PTemplate_t*   Page,
+   uint8_t        Field,
+   void*          Context
 )
 {
+   PConfig_t*  ConfigDatah = (PConfig_t*) Context;
+   bool        Filled = false;
+
    if ( ConfigDatah->LabelLength > 0 )
    {
-      HTMLFile.replace ( String ( "<span name=\"sensor_name\"></span>" ),
-                         String ( "<span name=\"sensor_name\">" )
-                         + String ( "<a href=\"/\">" )
-                         + String ( ConfigDatah->Label )
-                         + String ( "</a></span>" )
-                       );   
+      TemplateText ( Page, "<span name=\"sensor_name\"><a href=\"/\">" );
+      TemplateText ( Page, ConfigDatah->Label );
+      TemplateText ( Page, "</a></span>" );
+      Filled = true;
+   }
+
+   return Filled;
+}
+
+// -------------------------------------------------------< /FillSensorName >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< FillSensorConfig >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Fill in a place holder of the sensor configuration page with the
+//             current stored setting.
+//
+// PARAMETERS: Page - The page being sent.
+//
+//             Field - The place holder found (see SENSOR_CONFIG_FIELDS).
+//
+//             Context - Pointer to the configuration data structure.
+//
+// RETURNS:    bool == 'true' when the place holder was filled in.
+//                  == 'false' if it is sent as it is.
+//
+// NOTES:      -  The radio button place holders include their quotes, and
+//                are replaced by the quoted value, marked "checked" for the
+//                current setting.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static bool FillSensorConfig (
+   PTemplate_t*   Page,
+   uint8_t        Field,
+   void*          Context
+)
+{
+   PConfig_t*  ConfigDatah = (PConfig_t*) Context;
+   bool        Filled = true;
+   char        Text[ 8 ];
+
+   #define FLAG_SET(f)  ( ( ConfigDatah->Flags & (f) ) != 0 )
+
+   switch ( Field )
+   {
+      case SENSOR_FIELD_NAME:
+         Filled = FillSensorName ( Page, Field, Context );
+         break;
+
+      case SENSOR_FIELD_PROBE_Y:
+         TemplateChoice ( Page, "Y", FLAG_SET ( CONFIG_TEMP_PROBE_CONNECTED ) == true, "checked" );
+         break;
+
+      case SENSOR_FIELD_PROBE_N:
+         TemplateChoice ( Page, "N", FLAG_SET ( CONFIG_TEMP_PROBE_CONNECTED ) == false, "checked" );
+         break;
+
+      case SENSOR_FIELD_RELAY_Y:
+         TemplateChoice ( Page, "Y", FLAG_SET ( CONFIG_DEVICE_RELAY_CONNECTED ) == true, "checked" );
+         break;
+
+      case SENSOR_FIELD_RELAY_N:
+         TemplateChoice ( Page, "N", FLAG_SET ( CONFIG_DEVICE_RELAY_CONNECTED ) == false, "checked" );
+         break;
+
+      case SENSOR_FIELD_UNITS_F:
+         TemplateChoice ( Page, "F", FLAG_SET ( CONFIG_TEMP_DISPLAY_FAHRENHEIT ) == true, "checked" );
+         break;
+
+      case SENSOR_FIELD_UNITS_C:
+         TemplateChoice ( Page, "C", FLAG_SET ( CONFIG_TEMP_DISPLAY_FAHRENHEIT ) == false, "checked" );
+         break;
+
+      case SENSOR_FIELD_DEBUG_Y:
+         TemplateChoice ( Page, "Y", FLAG_SET ( CONFIG_DEBUG_MESSAGE_ENABLED ) == true, "checked" );
+         break;
+
+      case SENSOR_FIELD_DEBUG_N:
+         TemplateChoice ( Page, "N", FLAG_SET ( CONFIG_DEBUG_MESSAGE_ENABLED ) == false, "checked" );
+         break;
+
+      case SENSOR_FIELD_LOWTEMP:
+         TemplateNumber ( Page, ConfigDatah->TempLowLimit );
+         break;
+
+      case SENSOR_FIELD_HIGHTEMP:
+         TemplateNumber ( Page, ConfigDatah->TempHighLimit );
+         break;
+
+      case SENSOR_FIELD_LABEL:
+         TemplateText ( Page, ConfigDatah->Label );
+         break;
+
+      case SENSOR_FIELD_INTERVAL:
+         TemplateNumber ( Page, ConfigDatah->SensorWaitTime / 1000 );
+         break;
+
+      case SENSOR_FIELD_MINWAIT:
+         TemplateNumber ( Page, ConfigDatah->SensorWaitMin / 1000 );
+         break;
+
+      case SENSOR_FIELD_MAXWAIT:
+         TemplateNumber ( Page, ConfigDatah->SensorWaitMax / 1000 );
+         break;
+
+      case SENSOR_FIELD_HYSTERESIS:
+         // Stored in tenths of a degree, shown with one decimal place.
+         sprintf ( Text, "%u.%u", ConfigDatah->TempHysteresis / 10, ConfigDatah->TempHysteresis % 10 );
+         TemplateText ( Page, Text );
+         break;
+
+      case SENSOR_FIELD_MINON:
+         TemplateNumber ( Page, ConfigDatah->RelayMinOnTime );
+         break;
+
+      case SENSOR_FIELD_MINOFF:
+         TemplateNumber ( Page, ConfigDatah->RelayMinOffTime );
+         break;
+
+      default:
+         Filled = false;
+         break;
+   }
+
+   #undef FLAG_SET
+
+   return Filled;
+}
+
+// -----------------------------------------------------< /FillSensorConfig >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------< FillWifiConfig >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Fill in a place holder of the wifi configuration page with the
+//             current stored setting.
+//
+// PARAMETERS: Page - The page being sent.
+//
+//             Field - The place holder found (see WIFI_CONFIG_FIELDS).
+//
+//             Context - Pointer to the configuration data structure.
+//
+// RETURNS:    bool == 'true' when the place holder was filled in.
+//                  == 'false' if it is sent as it is.
+//
+// NOTES:      -  The serial baud rate option that matches the current stored
+//                value is marked "selected".
+//
+//             -  The wifi network scan is only started when the list of
+//                networks is reached, so the top of the page is already on
+//                its way to the client while the scan runs.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static bool FillWifiConfig (
+   PTemplate_t*   Page,
+   uint8_t        Field,
+   void*          Context
+)
+{
+   PConfig_t*  ConfigDatah = (PConfig_t*) Context;
+   bool        Filled = true;
+   char        Text[ 12 ];
+   bool        StationEnabled = ( ConfigDatah->Flags & CONFIG_WIFI_STATION_ENABLED ) != 0;
+
+   if ( Field == WIFI_FIELD_NAME )
+   {
+      Filled = FillSensorName ( Page, Field, Context );
+   }
+
+   else if ( Field == WIFI_FIELD_NETLIST )
+   {
+      GetWifiNetworks ( Page, ConfigDatah );
    }
+
+   else if ( Field == WIFI_FIELD_WIFI_Y || Field == WIFI_FIELD_WIFI_N )
+   {
+      TemplateChoice ( Page,
+                       ( Field == WIFI_FIELD_WIFI_Y ) ? "Y" : "N",
+                       StationEnabled == ( Field == WIFI_FIELD_WIFI_Y ),
+                       "checked"
+                     );
+   }
+
+   else if ( Field == WIFI_FIELD_SSID )
+   {
+      TemplateText ( Page, ConfigDatah->WifiSSID );
+   }
+
+   else if ( Field == WIFI_FIELD_PASS )
+   {
+      TemplateText ( Page, ConfigDatah->WifiPassword );
+   }
+
+   else if ( Field >= WIFI_FIELD_AP0 && Field <= WIFI_FIELD_AP3 )
+   {
+      TemplateNumber ( Page, ConfigDatah->AccessIP[ Field - WIFI_FIELD_AP0 ] );
+   }
+
+   else if ( Field >= WIFI_FIELD_NM0 && Field <= WIFI_FIELD_NM3 )
+   {
+      TemplateNumber ( Page, ConfigDatah->NetMask[ Field - WIFI_FIELD_NM0 ] );
+   }
+
+   else if ( Field >= WIFI_FIELD_GW0 && Field <= WIFI_FIELD_GW3 )
+   {
+      TemplateNumber ( Page, ConfigDatah->Gateway[ Field - WIFI_FIELD_GW0 ] );
+   }
+
+   else if ( Field >= WIFI_FIELD_BAUD0 && Field <= WIFI_FIELD_BAUD9 )
+   {
+      int Baud = BaudList[ Field - WIFI_FIELD_BAUD0 ];
+
+      sprintf ( Text, "%d", Baud );
+      TemplateChoice ( Page, Text, ConfigDatah->SerialBaud == (uint32_t) Baud, "selected" );
+   }
+
+   else if ( Field == WIFI_FIELD_WEBPORT )
+   {
+      TemplateNumber ( Page, ConfigDatah->WebServerPort );
+   }
+
+   else if ( Field == WIFI_FIELD_WSPORT )
+   {
+      TemplateNumber ( Page, ConfigDatah->WebSocketServerPort );
+   }
+
+   else
+   {
+      Filled = false;
+   }
+
+   return Filled;
+}
+
+// -------------------------------------------------------< /FillWifiConfig >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< FillSensorDataJS >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Fill in the web socket address place holder of the sensor data
+//             javascript file.
+//
+// PARAMETERS: Page - The page being sent.
+//
+//             Field - The place holder found, which is always the address.
+//
+//             Context - Pointer to the configuration data structure.
+//
+// RETURNS:    bool == 'true', the place holder is always filled in.
+//
+// NOTES:      -  Written in the form of:  ws://w.x.y.z:p
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static bool FillSensorDataJS (
+   PTemplate_t*   Page,
+   uint8_t        Field,
+   void*          Context
+)
+{
+   PConfig_t*  ConfigDatah = (PConfig_t*) Context;
+   char        URL[ 32 ];
+
+   sprintf ( URL, "ws://%u.%u.%u.%u:%u",
+             ConfigDatah->StationIP[ 0 ], ConfigDatah->StationIP[ 1 ],
+             ConfigDatah->StationIP[ 2 ], ConfigDatah->StationIP[ 3 ],
+             ConfigDatah->WebSocketServerPort
+           );
+
+   TemplateText ( Page, URL );
+
+   return true;
 }
 
-// ----------------------------------------------------< /ReplaceSensorName >---
+// -----------------------------------------------------< /FillSensorDataJS >---
 
 
 
@@ -2335,9 +3333,9 @@ static void ReplaceSensorName (
 //
 // PURPOSE:    Add a list of wifi networks (SSID) to the content of a web page.
 //
-// PARAMETERS: ConfigDatah - Pointer to the configuration data structure.
+// PARAMETERS: Page - The page being sent.
 //
-//             HTMLFile - The contents of the HTML source to be updated.
+//             ConfigDatah - Pointer to the configuration data structure.
 //
 // RETURNS:    void
 //
@@ -2345,15 +3343,19 @@ static void ReplaceSensorName (
 //                <option></option> tags, and that set of tags will replace
 //                text in the HTML source of:  <span name="set_netlist"/>
 //
+//             -  Each tag is written to the page as it is made, rather than
+//                the whole list being built first.
+//
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 31Jan2019 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Written to the page as it is sent.
 //
 // -----------------------------------------------------------------------------
 
 static void GetWifiNetworks ( 
-   PConfig_t*  ConfigDatah,
-   String&     HTMLFile
+   PTemplate_t*   Page,
+   PConfig_t*     ConfigDatah
 )
 
 {
@@ -2374,7 +3376,6 @@ static void GetWifiNetworks (
       int      NWEncryptID;
       String   NWEncryptType;
       String   NWOption;
-      String   NWList;
       
       for ( int i = 0; i < NetworkCount; i++ )
       {
@@ -2400,12 +3401,10 @@ static void GetWifiNetworks (
                   + NWEncryptType 
                   + (String)") </option>\n"; 
 
-         NWList += NWOption;
-      }
-
-      DEBUG_PRINTLN ( ConfigDatah, NWList );
+         TemplateText ( Page, NWOption.c_str() );
 
-      HTMLFile.replace ( "<span name=\"set_netlist\"/>", NWList );   
+         DEBUG_PRINTF ( ConfigDatah, "%s", NWOption.c_str() );
+      }
    }
 }
 
@@ -2413,6 +3412,51 @@ static void GetWifiNetworks (
 
 
 
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< ShowPageStats >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Report how quickly a filled in page was sent, and how much of the
+//             heap it needed.
+//
+// PARAMETERS: ConfigDatah - Pointer to the configuration data structure.
+//
+//             Handler - The name of the request handler, for the message.
+//
+//             Page - The page that was sent.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The time to the first byte is also kept in /TimingStats.json
+//                as "PageFirstByte", and the low heap mark there includes the
+//                pages sent.
+//
+// HISTORY:
+// --------- ---------- - ------------------------------------------------------
+// 16Oct2026 DSVance    - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+static void ShowPageStats (
+   PConfig_t*     ConfigDatah,
+   const char*    Handler,
+   PTemplate_t*   Page
+)
+{
+   DEBUG_PRINTF ( ConfigDatah,
+                  "DEBUG: %s - Sent %u bytes, first byte %u us, all %lu us, heap used %u \n",
+                  Handler,
+                  Page->Sent,
+                  Page->FirstMicros,
+                  micros() - Page->StartMicros,
+                  Page->StartHeap - Page->MinHeap
+                );
+}
+
+// --------------------------------------------------------< /ShowPageStats >---
+
+
+
 // -----------------------------------------------------------------------------
 // --------------------------------------------------------< GetContentType >---
 // -----------------------------------------------------------------------------
@@ -2592,61 +3636,3 @@ int GetFileSize (
 }
 
 // ----------------------------------------------------------< /GetFileSize >---
-
-
-
-// -----------------------------------------------------------------------------
-// --------------------------------------------------------------< LoadFile >---
-// -----------------------------------------------------------------------------
-//
-// PURPOSE:    Read a SPIFFS file and store its contents in a memory variable.
-//
-// PARAMETERS: FileSys - A reference to the file system handle.
-//
-//             FilePath - The path and name of the file to be loaded.
-//
-//             FileContent - A reference to the memory variable to load into.
-//
-// RETURNS:    int == The number of bytes read an loaded into memory variable.
-//
-// NOTES:
-//
-// HISTORY:
-// --------- ---------- - ------------------------------------------------------
-// 30Nov2018 DSV - Initial implementation.
-//
-// -----------------------------------------------------------------------------
-
-int LoadFile (
-   fs::FS&     FileSys,
-   const char* FilePath,
-   String&     FileContent
-)
-{
-   int ReadSize = 0;
-
-   if ( FileSys.exists ( FilePath ) )
-   {
-      File FileHandle = FileSys.open ( FilePath, "r" );
-
-      if ( FileHandle )
-      {
-         int FileSize = FileHandle.size();
-
-         if ( FileSize > 0 )
-         {
-            while ( FileHandle.available() )
-            {
-               FileContent += char ( FileHandle.read() );
-               ReadSize++;
-            }
-         }
-
-         FileHandle.close();
-      }
-   }
-
-   return ReadSize;
-}
-
-// -------------------------------------------------------------< /LoadFile >---
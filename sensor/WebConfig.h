@@ -16,6 +16,8 @@
 // HISTORY:
 // --------- ---------- - ------------------------------------------------------
 // 30Nov2018 DSVance    - Initial development.
+// 16Oct2026 DSVance    - Changed settings applied without a restart.
+// 16Oct2026 DSVance    - LoadFile() replaced by PageTemplate.
 //
 // -----------------------------------------------------------------------------
 
@@ -28,16 +30,20 @@
 
 
 
+//
+// Called after the settings are changed from a web page, with a copy of them
+// from before the change, to put the changes into effect.  Returns true if
+// some of them only take effect after a restart.
+//
+typedef bool ( *ConfigApply_t ) ( const PConfig_t* Before );
+
+
+
 void WebEvents (
    ESP8266WebServer* WebServerh,
    PConfig_t*        ConfigDatah,
-   SSDPClass*        SSDPh
-);
-
-int LoadFile (
-   fs::FS&     FileSys,
-   const char* FilePath,
-   char*       FileContent
+   SSDPClass*        SSDPh,
+   ConfigApply_t     ApplyConfig
 );
 
 
@@ -122,9 +122,36 @@ function Connect()
       {
          console.log ( 'Data = ' + event.data );
          var JSONData = JSON.parse ( event.data );
-         JSONData.Value =  ( Math.round ( JSONData.Value * 10 ) / 10 );
-         DataField.innerHTML = JSONData.Value + " &deg;" + JSONData.Units;
-         drawChart ( JSONData.Value );
+
+         // A null value means the probe could not be read.
+         if ( JSONData.Value === null )
+         {
+            DataField.innerHTML = 'Probe fault';
+         }
+
+         else
+         {
+            JSONData.Value =  ( Math.round ( JSONData.Value * 10 ) / 10 );
+            DataField.innerHTML = JSONData.Value + " &deg;" + JSONData.Units;
+         }
+
+         // With more than one probe, list each probe's value.
+         if ( JSONData.Probes && JSONData.Probes.length > 1 )
+         {
+            var ProbeText = "";
+
+            for ( var i = 0; i < JSONData.Probes.length; i++ )
+            {
+               ProbeText += "<br>#" + ( i + 1 ) + ": "
+                          + ( ( JSONData.Probes[ i ] === null )
+                              ? "fault"
+                              : ( Math.round ( JSONData.Probes[ i ] * 10 ) / 10 )
+                                + " &deg;" + JSONData.Units );
+            }
+            DataField.innerHTML += ProbeText;
+         }
+
+         drawChart ( ( JSONData.Value === null ) ? 0 : JSONData.Value );
 
       };
    
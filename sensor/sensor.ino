@@ -68,8 +68,18 @@
 //
 //             Use (char)247 for the degree symbol on the SSD1306 OLED screen.
 //
-// TODO:    - Check for DEVICE_DISCONNECTED after reading temp from sensor.
-//          - Set high and low alarm values on sensor object in setup.
+//          -  Web sockets:  arduinoWebSockets library by Markus Sattler,
+//             version 2.3.6 exactly (WS_LIBRARY_VERSION).
+//
+//             SensorSocketServer reads and changes that library's protected
+//             members (_clients[] with its status, tcp, and cProtocol,
+//             _server, and _port), none of which are part of its interface.
+//             Before moving to another version, check them against its
+//             WebSocketsServer.h and WebSockets.h, then change
+//             WS_LIBRARY_VERSION to match.  The build stops on any other
+//             version, or one too old to say.
+//
+// TODO:    - Set high and low alarm values on sensor object in setup.
 //          - Create an alarm handler function.
 //          - Set the alarm handler function on sensor object in setup.
 //          - Check for sensor alarms in loop.
@@ -78,6 +88,7 @@
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
 // 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - WebSockets library version pinned.
 //
 // -----------------------------------------------------------------------------
 
@@ -90,6 +101,15 @@
 #include "Sensor.h"              // Definitions common to whole Sensor sketch
 #include "EEPROMConfig.h"        // Read a write configuration to FLASH storage
 #include "WebConfig.h"           // Web server event handlers
+#include "TimingStats.h"         // Code path timing measurements
+#include "TempProbe.h"           // DS18B20 temperature probe table
+#include "FixedPoint.h"          // Fixed point temperature values
+#include "SensorHistory.h"       // Ring buffer of recent readings
+#include "SensorRollup.h"        // Min, max, and average over time windows
+#include "SensorControl.h"       // Adaptive reading interval and relay
+#include "DisplayControl.h"      // Send only what changed to the screen
+#include "JsonWriter.h"          // Write JSON text straight into a buffer
+#include "SensorData.h"          // Sensor data sent to web socket clients
 
 #include <Schedule.h>            // Scheduled function ability
 
@@ -118,6 +138,11 @@
 // Specify the NodeMCU pin number connected to data of DS18B20 temp sensor.
 #define ONE_WIRE_BUS  D4
 
+// How long to wait between checks of a conversion that is taking longer
+// than expected, and how many times to check before giving up waiting.
+#define CONVERSION_CHECK_TIME   10
+#define CONVERSION_CHECK_MAX    10
+
 // Definitions for the 'Services' flag field.
 #define  SERIAL_CONNECTED        0x0001
 #define  WIFI_STATION_CONNECTED  0x0002
@@ -128,6 +153,10 @@
 
 #define  WIFI_CONNECTED          ( WIFI_STATION_CONNECTED | WIFI_ACCESS_CONNECTED )
 
+// The network services RestartServices() can start again on a new port.
+#define  RESTART_WEB_SERVER      0x01
+#define  RESTART_WEB_SOCKET      0x02
+
 // Define the size of the SSD1306 screen.
 #define SCREEN_WIDTH      128       // Width in pixels
 #define SCREEN_HEIGHT      64       // Height in pixels
@@ -151,8 +180,120 @@ DallasTemperature  Sensors ( &OneWireComm );
 // method (from the stored config data) when the server is started.
 ESP8266WebServer  WebServer ( 80 );
 
+//
+// The web socket subprotocol a client asks for to be sent binary frames
+// instead of JSON text (see SerializeBinary), and how each client is sent to.
+//
+#define WS_PROTOCOL_BINARY "sensor.bin"
+#define FRAME_NONE         0     // Not connected
+#define FRAME_JSON         1     // JSON text, the default
+#define FRAME_BINARY       2     // A descriptor, then binary frames
+
+//
+// The only WebSockets library version SensorSocketServer has been checked
+// against, as WEBSOCKETS_VERSION_INT gives it (major, minor, and patch at
+// 1000 apart).  Versions before 2.3 do not define WEBSOCKETS_VERSION_INT.
+//
+#define WS_LIBRARY_VERSION 2003006
+
+#if !defined ( WEBSOCKETS_VERSION_INT ) || WEBSOCKETS_VERSION_INT != WS_LIBRARY_VERSION
+#error "SensorSocketServer uses WebSockets library internals checked only against version 2.3.6"
+#endif
+
+//
+// The web socket server, able to tell which subprotocol a client asked for,
+// and whether a message would fit in a client's TCP send buffer without
+// waiting.  The library has no way to ask either, and keeps its client table
+// to itself, so a subclass is the only place they can be read from.
+//
+// The library also answers a client that sent any Sec-WebSocket-Protocol
+// header with the server's protocol, whatever the client asked for, and
+// offers no hook to change that.  So loop() looks at each handshake as it is
+// read, and keeps the request only if WS_PROTOCOL_BINARY is exactly one of
+// its comma separated tokens.  A client that asked for anything else is sent
+// no protocol header, and JSON text.  The library reads one handshake line
+// per pass, so this always runs before the blank line that ends it.
+//
+// The library also fixes the port when the server is made, so Listen() makes
+// a new listening socket to move it to another.
+//
+class SensorSocketServer : public WebSocketsServer
+{
+   public:
+
+   SensorSocketServer ( uint16_t Port )
+      : WebSocketsServer ( Port, "", WS_PROTOCOL_BINARY )
+   {
+   }
+
+   void loop ()
+   {
+      WebSocketsServer::loop();
+
+      for ( uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++ )
+      {
+         if ( _clients[ num ].status == WSC_HEADER && _clients[ num ].cProtocol.length() > 0 )
+         {
+            _clients[ num ].cProtocol = HasToken ( _clients[ num ].cProtocol.c_str(), WS_PROTOCOL_BINARY )
+                                        ? WS_PROTOCOL_BINARY
+                                        : "";
+         }
+      }
+   }
+
+   bool Requested ( uint8_t num, const char* Protocol )
+   {
+      return num < WEBSOCKETS_SERVER_CLIENT_MAX && _clients[ num ].cProtocol == Protocol;
+   }
+
+   bool Writable ( uint8_t num, size_t Length )
+   {
+      return num < WEBSOCKETS_SERVER_CLIENT_MAX
+          && _clients[ num ].tcp != NULL
+          && _clients[ num ].tcp->availableForWrite() >= (int) Length;
+   }
+
+   void Listen ( uint16_t Port )
+   {
+      if ( Port != _port )
+      {
+         close();
+         delete _server;
+         _server = new WEBSOCKETS_NETWORK_SERVER_CLASS ( Port );
+         _port   = Port;
+      }
+
+      begin();
+   }
+
+   private:
+
+   static bool HasToken ( const char* List, const char* Token )
+   {
+      size_t   Length = strlen ( Token );
+      size_t   Size;
+      bool     Found = false;
+
+      while ( *List != 0 && Found == false )
+      {
+         List += strspn ( List, " \t," );
+         Size  = strcspn ( List, "," );
+
+         while ( Size > 0 && ( List[ Size - 1 ] == ' ' || List[ Size - 1 ] == '\t' ) )
+         {
+            Size--;
+         }
+
+         Found = ( Size == Length && strncmp ( List, Token, Length ) == 0 );
+         List += strcspn ( List, "," );
+      }
+
+      return Found;
+   }
+};
+
 // Instantiate a web socket server on port 81.
-WebSocketsServer  WebSocket = WebSocketsServer ( 81 );
+SensorSocketServer  WebSocket ( 81 );
 
 // Instantiate a SSD1306 display object.
 // NOTE: The TwoWire instance 'Wire' referenced here was declared in Wire.h
@@ -164,26 +305,87 @@ PConfig_t   ConfigData = { 0 };
 uint16_t    Services = 0;
 char        ChipUUID[ SSDP_UUID_SIZE ] = { 0 };
 os_timer_t  TemperatureTimer;
-
-
-typedef struct SENSOR_DATA
+os_timer_t  ConversionTimer;
+bool        ConversionPending = false;
+uint8_t     ConversionChecks = 0;
+uint8_t     DisplayProbe = 0;
+uint8_t     ProbeRetries = 0;
+int16_t     SampleValue[ PROBE_MAX ];
+uint8_t     SampleStatus[ PROBE_MAX ];
+
+
+// Room the JSON library needs to parse the sensor data (see DeserializeJSON).
+#define SENSORDATA_JSON_SIZE ( JSON_OBJECT_SIZE ( 8 ) + JSON_ARRAY_SIZE ( PROBE_MAX ) )
+
+// The most recent sensor data sent to clients, kept to give to clients that
+// connect before the next reading, and its sequence number.  Binary clients
+// are sent the descriptor and the binary frame, JSON clients the JSON text.
+// The reading itself, and the values and units it points to, are kept for
+// the clients that only want part of it.
+char        LastFrame[ JSON_MAX_TEXT ] = { 0 };
+size_t      LastFrameLength = 0;
+char        LastDescriptor[ JSON_MAX_TEXT ] = { 0 };
+size_t      LastDescriptorLength = 0;
+uint8_t     LastBinary[ SENSOR_BINARY_MAX ];
+size_t      LastBinaryLength = 0;
+SData_t     LastData = { 0 };
+int16_t     LastValues[ PROBE_MAX ];
+char        LastUnits[ 2 ];
+uint32_t    FrameSeq = 0;
+
+//
+// What each web socket client is sent, and when.  A client that has not
+// subscribed (see SocketCommand) is sent every field of every reading.
+//
+// Nothing is sent to a client straight away.  What it is owed is only noted
+// here, and sent from loop() once the client's TCP send buffer has room for
+// it and the web socket header in front of it (see DrainQueues).  No copy
+// of a message is kept: the only reading ever owed is the newest one, and
+// the other messages are made from what is current when they are sent.
+//
+#define SOCKET_FRAME_HEADER   4
+
+typedef struct SOCKET_CLIENT
 {
-  const char*    Type;
-  const char*    Name;
-  const char*    Units;
-  float          Value;
-  uint32_t       Time;
-  uint32_t       Interval;
-} SData_t ;
+   uint8_t  Format;        // FRAME_NONE, FRAME_JSON, or FRAME_BINARY
+   bool     Descriptor;    // A binary client is owed the new descriptor
+   bool     Reading;       // Owed the newest reading
+   bool     Reply;         // Owed the answer to a Set command
+   uint8_t  Saved;         // Settings that command stored
+   uint8_t  Probes;        // One bit for each probe wanted
+   uint16_t Fields;        // One bit for each field wanted, JSON clients only
+   uint16_t Backfill;      // Readings of history owed, 0 for none
+   const char* Error;      // Why that command changed nothing, or NULL
+   uint32_t Interval;      // Fewest milliseconds between readings, 0 for all
+   uint32_t LastSent;      // millis() when a reading was last queued
+   uint32_t Skipped;       // Readings not sent because they came too soon
+   uint32_t Dropped;       // Readings replaced by newer ones before sending
+} SClient_t;
 
-#define SENSORDATA_JSON_SIZE ( JSON_OBJECT_SIZE ( 6 ) )
+SClient_t   Clients[ WEBSOCKETS_SERVER_CLIENT_MAX ] = { 0 };
 
+//
+// The text of a message made for just one client: its history (see
+// SendBackfill), part of a reading, or the answer to a Set command.  They
+// are made and sent one at a time (see DrainQueues), so they share this
+// buffer rather than each having one, and the number of readings of history
+// is limited so that they always fit in it.
+//
+#define SOCKET_TEXT_MAX    2560
+#define BACKFILL_HEADER    64
+#define BACKFILL_TEXT(n)   ( BACKFILL_HEADER + ( n ) * HISTORY_SAMPLE_MAX )
+#define BACKFILL_MAX       ( ( SOCKET_TEXT_MAX - BACKFILL_HEADER ) / HISTORY_SAMPLE_MAX )
 
-// Convert celsius to fahrenheit.
-#define C2F(c) ( ((float)c * (9.0/5.0)) + 32.0 )
+char        SocketText[ SOCKET_TEXT_MAX ];
 
-// Convert fahrenheit to celsius.
-#define F2C(f) ( ((float)f - 32.0 ) * (5.0/9.0) )
+// The relay modes by name, in the order of RELAY_MODE_AUTO, ON, and OFF.
+const char* const   RelayModeNames[] = { "AUTO", "ON", "OFF" };
+
+// Room to parse the biggest command a client sends (see SocketCommand).
+#define SOCKET_COMMAND_JSON_SIZE  ( JSON_OBJECT_SIZE ( 8 )                       \
+                                  + JSON_OBJECT_SIZE ( 3 )                       \
+                                  + JSON_ARRAY_SIZE ( PROBE_MAX )                \
+                                  + JSON_ARRAY_SIZE ( SDATA_FIELD_COUNT ) )
 
 
 
@@ -195,9 +397,12 @@ void InitDisplay (
   Adafruit_SSD1306* Screen
 );
 
-void UpdateDisplay (
+bool UpdateDisplay (
   Adafruit_SSD1306* Screen,
-  float             SensorValueF,
+  int16_t           SensorValue,
+  char              Units,
+  uint8_t           ProbeIndex,
+  uint8_t           ProbeTotal,
   bool              DeviceState
 );
 
@@ -211,6 +416,14 @@ void SensorAction (
   void*    Args
 );
 
+void ConversionTimerISR (
+  void*    Args
+);
+
+void SensorCollect (
+  void*    Args
+);
+
 void WebSocketEvent (
   uint8_t  num,
   WStype_t type,
@@ -227,11 +440,73 @@ bool DeserializeJSON (
   char*       JSONBuffer
 );
 
-size_t SerializeJSON (
+size_t PackLE (
+  uint8_t*       Buffer,
+  size_t         Length,
+  uint32_t       Value,
+  uint8_t        Bytes
+);
+
+size_t PackTemps (
+  uint8_t*       Buffer,
+  size_t         Length,
+  const int16_t* Values,
+  uint8_t        Count
+);
+
+void SelectProbes (
   const SData_t& Data,
-  char*          JSONBuffer,
+  uint8_t        Probes,
+  SData_t&       Subset,
+  int16_t*       Values
+);
+
+void SendFrames (
+  bool           NewDescriptor
+);
+
+void DrainQueues ();
+
+size_t SerializeReading (
+  const SClient_t* Client,
+  const uint8_t**  Data
+);
+
+void SendBackfill (
+  uint8_t        num,
+  long           Count
+);
+
+size_t SerializeBackfill (
+  char*          Text,
+  size_t         MaxSize,
+  uint16_t       Count
+);
+
+void SocketCommand (
+  uint8_t        num,
+  uint8_t*       payload,
+  size_t         payload_length
+);
+
+void SocketSet (
+  uint8_t        num,
+  JsonObject&    Set
+);
+
+size_t SerializeState (
+  char*          Text,
   size_t         MaxSize,
-  boolean        Pretty = false
+  uint8_t        Saved,
+  const char*    Error
+);
+
+bool ApplyConfig (
+  const PConfig_t* Before
+);
+
+void RestartServices (
+  uint8_t        Which
 );
 
 void Deblank ( 
@@ -259,10 +534,16 @@ void Deblank (
 //                invokes a specified function when it does.  The sequence of
 //                routines that executes when the timer fires cause the sensor
 //                data to be updated and transmitted to the connected clients.
+//                The interval may be changed later as readings come in.
 //
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
 // 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Start the sensor timer with the adjustable SensorPeriod.
+// 16Oct2026 DSV - Send only what changed to the screen.
+// 16Oct2026 DSV - Web socket port from the settings, changes applied live.
+// 16Oct2026 DSV - No start-up pause after a restart asked for by software.
+// 16Oct2026 DSV - Check the settings kept in the former spare bytes.
 //
 // -----------------------------------------------------------------------------
 
@@ -308,7 +589,7 @@ void setup()
   Status = false;
   for ( int i = 0; i < BAUD_LIST_SIZE && Status == false; i++ )
   {
-    if ( ConfigData.SerialBaud == BaudList[ i ] )
+    if ( ConfigData.SerialBaud == (uint32_t) BaudList[ i ] )
     {
       Status = true;
     }
@@ -354,9 +635,12 @@ void setup()
      Serial.printf ( "         Compiled version = 0x%04x \n", PCONFIG_VERSION  );
   }
 
+  // Settings that older software left as spare bytes may hold anything.
+  CheckROMValues ( &ConfigData );
+
   
   // Initialize output for screen at address 0x3C.
-  Screen.begin ( SSD1306_SWITCHCAPVCC, 0x3C );
+  DisplayBegin ( &Screen );
 
   // Display the IP address to the screen.
   Screen.clearDisplay();
@@ -364,7 +648,7 @@ void setup()
   Screen.setTextSize ( 2 );
   Screen.setCursor ( 0, 0 );
   Screen.println ( "Connecting" );
-  Screen.display();
+  DisplayFlush ( &Screen );
 
 
    // Connect to the wifi network.
@@ -467,7 +751,7 @@ void setup()
       Screen.setCursor ( 0, 30 );
       Screen.print   ( "IP: " );
       Screen.println ( ConnectedIP );
-      Screen.display();
+      DisplayFlush ( &Screen );
 
 
       //
@@ -514,13 +798,15 @@ void setup()
          // Disable services (like timers) that might interfere with the update.
          //
          os_timer_disarm ( &TemperatureTimer );
+         os_timer_disarm ( &ConversionTimer );
 
 
          Screen.clearDisplay();
+         DisplayCacheClear();
          Screen.setTextSize ( 2 );
          Screen.setCursor ( 0, 0 );
          Screen.println ( " Updating " );
-         Screen.display();
+         DisplayFlush ( &Screen );
          delay ( 1000 );
       } );
 
@@ -532,7 +818,7 @@ void setup()
          Screen.setTextSize ( 2 );
          Screen.setCursor ( 0, 0 );
          Screen.println ( " Finished " );
-         Screen.display();
+         DisplayFlush ( &Screen );
 
          // Reset the processor after a short delay.
          delay ( 1000 );
@@ -552,7 +838,7 @@ void setup()
          Screen.setCursor ( 10, 50 );
          Screen.printf ( "%u of %u", progress, total );
 
-         Screen.display();
+         DisplayFlush ( &Screen );
       } );
 
       ArduinoOTA.onError ( [] ( ota_error_t error )
@@ -578,7 +864,7 @@ void setup()
                                                            "Unknown"
                         );
 
-         Screen.display();
+         DisplayFlush ( &Screen );
       } );
 
       ArduinoOTA.begin();
@@ -598,7 +884,7 @@ void setup()
       }
 
       // Setup handlers for web server events.
-      WebEvents ( &WebServer, &ConfigData, &SSDP );
+      WebEvents ( &WebServer, &ConfigData, &SSDP, ApplyConfig );
 
 
       // Start the web server running on the specified port.
@@ -634,8 +920,8 @@ void setup()
       // Start the web-socket server running, passing an event
       // handler function to take care of incoming messages.
       WebSocket.onEvent ( WebSocketEvent );
-      WebSocket.begin();
-      Serial.println ( "Web socket server started" );
+      WebSocket.Listen ( ConfigData.WebSocketServerPort );
+      Serial.printf ( "Web socket server started on port %d \n", ConfigData.WebSocketServerPort );
       Screen.setCursor ( 2, 50 );
       Screen.println ( "Web socket started" );
    }
@@ -651,34 +937,20 @@ void setup()
    }
 
 
-   Screen.display();
+   DisplayFlush ( &Screen );
 
 
    if ( ConfigData.Flags & CONFIG_TEMP_PROBE_CONNECTED )
    {
       DEBUG_PRINTF ( &ConfigData, "DEBUG: DS18B20 temperature sensor is in use \n" );
 
-      // Start the sensor communications.
-      Sensors.begin ();
-
-      // Set the global sensor resolution (9..12).
-      Sensors.setResolution ( 10 );
+      // Start the sensor communications and find all of the probes.
+      ProbeBegin ( &Sensors, &ConfigData );
 
-      if ( ConfigData.Flags & CONFIG_DEBUG_MESSAGE_ENABLED )
-      {
-         uint8_t OWDeviceCount = Sensors.getDeviceCount();
-         Serial.printf ( "DEBUG: Found %u OneWire device%s \n",
-                         OWDeviceCount,
-                         ( OWDeviceCount > 1 ) ? "s" : " "
-                       );
-
-         for ( uint8_t i = 0; i < OWDeviceCount; i++ )
-         {
-            uint8_t OWDeviceAddress = 0;
-            Sensors.getAddress ( &OWDeviceAddress, i );
-            Serial.printf ( "   Device #%d address is: 0x%08x \n", i, OWDeviceAddress );
-         }
-      }
+      Serial.printf ( "Using %u temperature probe%s \n",
+                      ProbeCount,
+                      ( ProbeCount != 1 ) ? "s" : ""
+                    );
    }
 
    else
@@ -690,8 +962,12 @@ void setup()
       randomSeed ( analogRead ( 0 ) );
    }
 
-   // Ensure the intial info has time to be seen.
-   delay ( 5000 );
+   // Ensure the intial info has time to be seen, unless the restart was
+   // asked for (such as for new wifi settings) and someone is waiting on it.
+   if ( ESP.getResetInfoPtr()->reason != REASON_SOFT_RESTART )
+   {
+      delay ( 5000 );
+   }
 
    // Display the start-up screen content.
    InitDisplay ( &Screen );
@@ -703,9 +979,11 @@ void setup()
    // Take an initial temperature reading before handing control to timer.
    SensorAction ( (void*) ActionID.c_str() );
 
-   // Enable the timer that transmits data to web socket client.
+   // Enable the timer that transmits data to web socket client.  The period
+   // may be adjusted later as readings come in (see SensorAdapt).
+   SensorPeriod = ConfigData.SensorWaitTime;
    os_timer_setfn ( &TemperatureTimer, SensorTimerISR, NULL );
-   os_timer_arm ( &TemperatureTimer, ConfigData.SensorWaitTime, true );
+   os_timer_arm ( &TemperatureTimer, SensorPeriod, true );
 
    return;
 }
@@ -727,17 +1005,60 @@ void setup()
 //
 // NOTES:      -  This loop mostly just handles services and connected clients.
 //
+//             -  Screen updates are sent a few pages per pass (see
+//                DisplayStep), so the clients are serviced in between.
+//
+//             -  Readings waiting for web socket clients are sent as their
+//                connections have room for them (see DrainQueues).
+//
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
 // 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Send screen updates a few pages at a time.
+// 16Oct2026 DSV - Send queued readings to web socket clients.
 //
 // -----------------------------------------------------------------------------
 
 void loop ()
 {
+   uint32_t FreeHeap;
+   bool     Pending;
+
+   // Measure the time since the previous pass, including any scheduled
+   // functions that ran in between.
+   TimingLap ( TIMING_LOOP );
+
+   FreeHeap = ESP.getFreeHeap();
+   if ( FreeHeap < MinFreeHeap )
+   {
+      MinFreeHeap = FreeHeap;
+   }
+
+   if ( DisplayPending() == true )
+   {
+      TimingStart ( TIMING_DISPLAY_FLUSH );
+      Pending = DisplayStep ( &Screen, DISPLAY_STEP_PAGES );
+      TimingStop ( TIMING_DISPLAY_FLUSH );
+
+      if ( Pending == false )
+      {
+         DEBUG_PRINTF ( &ConfigData, "DEBUG: Display flush sent %u I2C bytes (%u us), a full frame is %u (%u us) \n",
+                        DisplayStats.LastBytes,
+                        DisplayBusMicros ( DisplayStats.LastBytes, DisplayStats.LastTransmissions, DISPLAY_I2C_CLOCK ),
+                        DisplayFullBytes(),
+                        DisplayBusMicros ( DisplayFullBytes(), DisplayFullTransmissions(), DISPLAY_I2C_CLOCK )
+                      );
+      }
+   }
+
    if ( Services & WIFI_CONNECTED )
    {
       WebSocket.loop();
+
+      TimingStart ( TIMING_SOCKET_DRAIN );
+      DrainQueues();
+      TimingStop ( TIMING_SOCKET_DRAIN );
+
       WebServer.handleClient();
       ArduinoOTA.handle();
    }
@@ -780,7 +1101,7 @@ void SensorTimerISR ( void* Args )
 {
    if ( Args != NULL )
    {
-      DEBUG_PRINTF ( &ConfigData, "DEBUG: SensorTimerISR - Args = 0x%08x \n", Args );
+      DEBUG_PRINTF ( &ConfigData, "DEBUG: SensorTimerISR - Args = %p \n", Args );
    }
 
    // Schedule a function to be executed the next time loop() returns.
@@ -795,8 +1116,9 @@ void SensorTimerISR ( void* Args )
 // ----------------------------------------------------------< SensorAction >---
 // -----------------------------------------------------------------------------
 //
-// PURPOSE:    Retrieve data from the attached sensor(s) and update any attached
-//             displays and connected clients with the new values and status.
+// PURPOSE:    Start a reading of the attached sensor(s).  The new values and
+//             status are reported to any displays and connected clients by
+//             SensorCollect() when the reading completes.
 //
 // PARAMETERS:  Args - Argument block passed to the function.
 //
@@ -806,119 +1128,424 @@ void SensorTimerISR ( void* Args )
 //                a const char* to a character string label that provides some
 //                context about the routine's caller.
 //
+//             -  The DS18B20 needs time to perform a temperature conversion
+//                (~190ms at 10 bit resolution, ~750ms at 12 bit).  Rather than
+//                block the only thread while it waits, this routine only starts
+//                the conversion and arms a one-shot timer that schedules
+//                SensorCollect() to pick up the result once it is ready.  The
+//                web server and web socket keep running in the meantime.
+//
+//             -  If a conversion is already in process this routine does
+//                nothing, since the pending result will be reported anyway.
+//
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
 // 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Split into start (here) and collect (SensorCollect) phases.
 //
 // -----------------------------------------------------------------------------
 
 void SensorAction ( void* Args )
 {
-   float    SensorValue;
-   bool     DeviceState;
-   char     Units[ 2 ];
-
    if ( Args != NULL )
    {
       DEBUG_PRINTF ( &ConfigData, "DEBUG: SensorAction - %s \n", (const char*) Args );
    }
 
+   if ( ConversionPending == true )
+   {
+      DEBUG_PRINTF ( &ConfigData, "DEBUG: SensorAction - Conversion already in process \n" );
+   }
+
+   else if ( ConfigData.Flags & CONFIG_TEMP_PROBE_CONNECTED )
+   {
+      TimingStart ( TIMING_SENSOR_ACTION );
+
+      // Indicate temperature measurement in process (LED ON).
+      digitalWrite ( D7, HIGH );
+
+      // Send a command for all devices on the bus to perform a temperature
+      // conversion.  The wait-for-conversion option was turned off in setup()
+      // so this returns as soon as the command is on the wire.
+      uint32_t WaitTime = ProbeStartConversion ( &Sensors );
+
+      ConversionPending = true;
+      ConversionChecks  = 0;
+      ProbeRetries      = 0;
+
+      // Come back for the result once the conversion should be complete.
+      os_timer_setfn ( &ConversionTimer, ConversionTimerISR, NULL );
+      os_timer_arm ( &ConversionTimer, WaitTime, false );
+
+      TimingStop ( TIMING_SENSOR_ACTION );
+   }
+
+   else
+   {
+      // Indicate temperature measurement in process (LED ON).
+      digitalWrite ( D7, HIGH );
+
+      // Fake data values are available immediately.
+      SensorCollect ( NULL );
+   }
+}
+
+// ---------------------------------------------------------< /SensorAction >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------< ConversionTimerISR >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:     An interrupt service routine (ISR) that is called when the one
+//              shot timer armed by SensorAction() fires.
+//
+// PARAMETERS:  Args - an argument or structure of arguments provided by the
+//              routine that set up the timer that triggered this ISR to run.
+//
+// RETURNS:     void
+//
+// NOTES:      -  See the notes in SensorTimerISR() about the restrictions on
+//                what an interrupt handler can do.  This one also just
+//                schedules the real work for when loop() returns.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void ConversionTimerISR ( void* Args )
+{
+   // Schedule a function to be executed the next time loop() returns.
+   schedule_function ( std::bind ( &SensorCollect, Args ) );
+}
+
+// ---------------------------------------------------< /ConversionTimerISR >---
+
+
 
-   sprintf ( Units, "%s", ( ConfigData.Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT ) ? "F" : "C" );
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< SensorCollect >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Retrieve data from the attached sensor(s) and update any attached
+//             displays and connected clients with the new values and status.
+//
+// PARAMETERS:  Args - Argument block passed to the function.
+//
+// RETURNS:     void
+//
+// NOTES:      -  This is the second half of a reading started by SensorAction().
+//
+//             -  If the bus reports that the conversion is still in process
+//                (a slow part, or a long interrupt latency on the timer) the
+//                timer is re-armed for a short time and the check repeated, up
+//                to CONVERSION_CHECK_MAX times before the value is read anyway.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 25Oct2018 DSV - Initial development (as part of SensorAction).
+// 16Oct2026 DSV - Split into start (SensorAction) and collect (here) phases.
+// 16Oct2026 DSV - Keep each reading in the history ring buffer.
+// 16Oct2026 DSV - Feed the controlling probe's reading to the rollups.
+// 16Oct2026 DSV - Adjust the sensor timer period to the readings.
+// 16Oct2026 DSV - Relay set by RelayControl.
+// 16Oct2026 DSV - Fixed point readings from the probe through to the JSON.
+// 16Oct2026 DSV - Retry faulty probes, and don't act on invalid readings.
+// 16Oct2026 DSV - Send the screen once, with only what changed.
+// 16Oct2026 DSV - Don't flush the screen when nothing was drawn.
+// 16Oct2026 DSV - Trend graph of the controlling probe.
+// 16Oct2026 DSV - Screen flush left for loop() to send in steps.
+// 16Oct2026 DSV - Pretty debug text cut off rather than overrun.
+// 16Oct2026 DSV - Keep the JSON sent to clients, with a sequence number.
+// 16Oct2026 DSV - Binary frames for clients that ask for them.
+// 16Oct2026 DSV - The reading kept for clients that want part of it.
+//
+// -----------------------------------------------------------------------------
 
-   // Indicate temperature measurement in process (LED ON).
-   digitalWrite ( D7, HIGH );
+void SensorCollect ( void* Args )
+{
+   int16_t  ProbeValue[ PROBE_MAX ];
+   uint8_t  ValueCount = 1;
+   int16_t  SensorValue = 0;
+   bool     DeviceState;
+   bool     Ready = true;
+   bool     Redraw;
+   char     Units[ 2 ];
+   char     Text[ FIXED_TEXT_MAX ];
+
+   TimingStart ( TIMING_SENSOR_COLLECT );
 
    if ( ConfigData.Flags & CONFIG_TEMP_PROBE_CONNECTED )
    {
-      // Send a command for all devices on the bus
-      // to perform a temperature conversion.
-      Sensors.requestTemperatures();
+      if (  ! Sensors.isConversionComplete()
+         && ConversionChecks < CONVERSION_CHECK_MAX
+         )
+      {
+         // Not done yet.  Give the sensor a little more time.
+         ConversionChecks++;
+         Ready = false;
+         os_timer_arm ( &ConversionTimer, CONVERSION_CHECK_TIME, false );
+      }
+
+      else
+      {
+         uint8_t  Faults = 0;
+         bool     PowerOn = false;
+
+         // Get a temperature in degrees C from each probe.  Even with no probes
+         // found there is still one (disconnected) value to report.
+         // NOTE: The sensor's native value is in sixteenths of a degree celsius.
+         ValueCount = ( ProbeCount > 0 ) ? ProbeCount : 1;
+
+         // On a retry only the probes that failed are read again.
+         for ( uint8_t i = 0; i < ValueCount; i++ )
+         {
+            if ( ProbeRetries == 0 || SampleStatus[ i ] != PROBE_OK )
+            {
+               SampleStatus[ i ] = ProbeRead ( &Sensors, i, &SampleValue[ i ] );
+
+               if (  SampleStatus[ i ] != PROBE_OK
+                  && SampleStatus[ i ] != PROBE_FAULT_MISSING
+                  )
+               {
+                  Faults++;
+                  PowerOn = PowerOn || ( SampleStatus[ i ] == PROBE_FAULT_POWER_ON );
+               }
+            }
+         }
+
+         if ( Faults > 0 && ProbeRetries < PROBE_RETRY_MAX )
+         {
+            // Try again a little later, from the timer, so loop() keeps
+            // running in the meantime.  A power on value means the probe
+            // reset and lost the conversion, so that needs a new conversion
+            // rather than just a second read of the scratchpad.
+            uint32_t WaitTime = PROBE_RETRY_TIME << ProbeRetries;
+
+            DEBUG_PRINTF ( &ConfigData, "DEBUG: SensorCollect - %u probe fault%s, retry %u \n",
+                           Faults,
+                           ( Faults != 1 ) ? "s" : "",
+                           ProbeRetries + 1
+                         );
+
+            for ( uint8_t i = 0; i < ValueCount; i++ )
+            {
+               if ( SampleStatus[ i ] != PROBE_OK && SampleStatus[ i ] != PROBE_FAULT_MISSING )
+               {
+                  ProbeFaults[ i ].Retries++;
+               }
+            }
+
+            if ( PowerOn == true )
+            {
+               WaitTime = ProbeStartConversion ( &Sensors );
+               ConversionChecks = 0;
+            }
+
+            ProbeRetries++;
+            Ready = false;
+            os_timer_arm ( &ConversionTimer, WaitTime, false );
+         }
 
-      // Get a temperature in degrees C from device 0.
-      // NOTE: The sensor's native return value is in celsius.
-      SensorValue = Sensors.getTempCByIndex ( 0 );
+         else
+         {
+            ConversionPending = false;
+
+            // Whatever still failed is reported as invalid.
+            for ( uint8_t i = 0; i < ValueCount; i++ )
+            {
+               if ( SampleStatus[ i ] != PROBE_OK && SampleStatus[ i ] != PROBE_FAULT_MISSING )
+               {
+                  ProbeFaults[ i ].Invalid++;
+               }
+
+               ProbeValue[ i ] = SampleValue[ i ];
+            }
+         }
+      }
    }
 
    else
    {
       // Simulate data with random numbers in abscense of a sensor.
-      SensorValue = (float) random ( -199, 4999 );
-      SensorValue /= 100;
+      ProbeValue[ 0 ] = (int16_t) ( random ( -199, 4999 ) * FIXED_ONE / 100 );
    }
 
-   if ( ConfigData.Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT )
+   if ( Ready == true )
    {
-      SensorValue = C2F ( SensorValue );
-   }
+      // Keep the history in celsius, before any conversion for display.
+      // Probes that could not be read are left out.
+      for ( uint8_t i = 0; i < ValueCount; i++ )
+      {
+         if ( ProbeValue[ i ] != FIXED_DISCONNECTED )
+         {
+            HistoryAdd ( i, ProbeValue[ i ] );
+         }
+      }
 
-   // Determine the desired device state based on temperature value.
-   DeviceState = ( SensorValue > ConfigData.TempLowLimit && SensorValue < ConfigData.TempHighLimit );
+      if ( ProbeValue[ 0 ] != FIXED_DISCONNECTED )
+      {
+         RollupAdd ( ProbeValue[ 0 ] );
+      }
 
-   DEBUG_PRINTF ( &ConfigData, "DEBUG: SensorAction - %.1f °%s  Device is %s \n",
-                  SensorValue,
-                  Units,
-                  ( DeviceState == true ) ? "ON" : "OFF"
-                );
+      // Move the trend graph along with the controlling probe's reading.
+      Redraw = DisplaySparkline ( &Screen, &ConfigData, ProbeValue[ 0 ] );
 
-   // Set the output pin HIGH to turn the device ON or LOW to turn it OFF.
-   digitalWrite ( D6, ( DeviceState == true ) ? HIGH : LOW );
+      sprintf ( Units, "%s", ( ConfigData.Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT ) ? "F" : "C" );
 
-   // Indicate temperature measurement complete (LED OFF).
-   digitalWrite ( D7, LOW );
+      if ( ConfigData.Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT )
+      {
+         for ( uint8_t i = 0; i < ValueCount; i++ )
+         {
+            if ( ProbeValue[ i ] != FIXED_DISCONNECTED )
+            {
+               ProbeValue[ i ] = FixedC2F ( ProbeValue[ i ] );
+            }
+         }
+      }
 
-   UpdateDisplay ( &Screen, SensorValue, DeviceState );
+      // The first probe found is the one that controls the device.
+      SensorValue = ProbeValue[ 0 ];
 
-   if ( WebSocket.connectedClients ( false ) > 0 )
-   {
-      // There are clients connected to the web socket server.  Send the new
-      // sensor data to the clients in a JSON format.
+      // Determine the desired device state based on temperature value.  An
+      // invalid reading must not drive the relay.
+      if ( SensorValue != FIXED_DISCONNECTED )
+      {
+         DeviceState = RelayControl ( &ConfigData, SensorValue );
+         FormatFixed ( Text, SensorValue, 1 );
+      }
 
+      else
+      {
+         DeviceState = RelayFault();
+         sprintf ( Text, "Fault" );
+      }
 
-      // The maximum size of the JSON text that the tranmission buffer can hold.
-      // If more values are added to the SData_t structure, this size will need
-      // to be increased to accommodate the additional characters.
-#define  JSON_MAX_TEXT  160
+      DEBUG_PRINTF ( &ConfigData, "DEBUG: SensorCollect - %s °%s  Device is %s (%u changes) \n",
+                     Text,
+                     Units,
+                     ( DeviceState == true ) ? "ON" : "OFF",
+                     RelayTransitions
+                   );
+
+      // Set the output pin HIGH to turn the device ON or LOW to turn it OFF.
+      digitalWrite ( D6, ( DeviceState == true ) ? HIGH : LOW );
+
+      // Read more often while the temperature is moving or near a limit, and
+      // less often while it is steady.
+      if (  SensorValue != FIXED_DISCONNECTED
+         && SensorAdapt ( &ConfigData, SensorValue ) == true
+         )
+      {
+         DEBUG_PRINTF ( &ConfigData, "DEBUG: Sensor timer is set to %d milliseconds \n", SensorPeriod );
 
-      char     JSONText[ JSON_MAX_TEXT ];
-      size_t   JSONTextLength = 0;
-      char     Type[] = { "Temperature" };
+         os_timer_disarm ( &TemperatureTimer );
+         os_timer_arm ( &TemperatureTimer, SensorPeriod, true );
+      }
+
+      // Indicate temperature measurement complete (LED OFF).
+      digitalWrite ( D7, LOW );
+
+      // Take turns showing each of the probes on the screen.
+      DisplayProbe = ( DisplayProbe + 1 < ValueCount ) ? DisplayProbe + 1 : 0;
+
+      // One flush for everything this reading changed on the screen, and
+      // none at all if it looks the same as before.  It is sent from loop(),
+      // a few pages at a time.
+      if (  UpdateDisplay ( &Screen,
+                            ProbeValue[ DisplayProbe ],
+                            Units[ 0 ],
+                            DisplayProbe,
+                            ValueCount,
+                            DeviceState
+                          ) == true
+         || Redraw == true
+         )
+      {
+         DisplayRequest();
+      }
+
+      // Keep the new sensor data in a JSON format, numbered so that a
+      // client can tell which reading it is, for the clients connected now
+      // and any that connect before the next reading.  The values and units
+      // are copied, as the reading is kept until the next one.
+      static const char Type[] = { "Temperature" };
+
+      memcpy ( LastValues, ProbeValue, sizeof ( LastValues ) );
+      memcpy ( LastUnits, Units, sizeof ( LastUnits ) );
 
       // Initialize the const character pointers.
       SData_t  SensorData = { (const char*) Type,
                               (const char*) ConfigData.Label,
-                              (const char*) Units,
+                              (const char*) LastUnits,
                             };
-      SensorData.Value    = SensorValue;
-      SensorData.Time     = 0;
-      SensorData.Interval = ConfigData.SensorWaitTime / 1000;
+      SensorData.Value      = SensorValue;
+      SensorData.Time       = 0;
+      SensorData.Interval   = SensorPeriod / 1000;
+      SensorData.Seq        = ++FrameSeq;
+      SensorData.Values     = LastValues;
+      SensorData.ValueCount = ValueCount;
+
+      LastData = SensorData;
+
+      LastFrameLength = SerializeJSON ( SensorData, LastFrame, JSON_MAX_TEXT );
+      assert ( LastFrameLength < JSON_MAX_TEXT );
+
+      LastBinaryLength = SerializeBinary ( SensorData, LastBinary, SENSOR_BINARY_MAX );
 
+      // The descriptor only needs sending again when something in it, such
+      // as the interval, has changed.
+      char     JSONText[ JSON_MAX_TEXT ];
+      size_t   JSONTextLength = 0;
+      bool     NewDescriptor  = false;
+
+      JSONTextLength = SerializeDescriptor ( SensorData, JSONText, JSON_MAX_TEXT );
+      assert ( JSONTextLength < JSON_MAX_TEXT );
 
-      if ( ConfigData.Flags & CONFIG_DEBUG_MESSAGE_ENABLED )
+      if (  JSONTextLength != LastDescriptorLength
+         || memcmp ( JSONText, LastDescriptor, JSONTextLength ) != 0
+         )
       {
-         // Get the "pretty" version of the JSON for display.
-         JSONTextLength = SerializeJSON ( SensorData, (char*) JSONText, JSON_MAX_TEXT, true );
-         assert ( JSONTextLength < JSON_MAX_TEXT );
-         // NULL termination is probably unnecessary, but just in case.
-         JSONText[ JSONTextLength ] = 0;
-
-         Serial.printf ( "JSON text length: %d \n  %.*s \n",
-                         JSONTextLength,
-                         JSONTextLength,
-                         JSONText
-                       );
-         memset ( JSONText, 0, JSON_MAX_TEXT );
+         memcpy ( LastDescriptor, JSONText, JSONTextLength + 1 );
+         LastDescriptorLength = JSONTextLength;
+         NewDescriptor        = true;
       }
 
-      JSONTextLength = SerializeJSON ( SensorData, (char*) JSONText, JSON_MAX_TEXT );
-      assert ( JSONTextLength < JSON_MAX_TEXT );
-      // NULL termination is probably unnecessary, but just in case.
-      JSONText[ JSONTextLength ] = 0;
-      WebSocket.broadcastTXT ( JSONText, JSONTextLength );
+      if ( WebSocket.connectedClients ( false ) > 0 )
+      {
+         // There are clients connected to the web socket server.  Send the new
+         // sensor data to the clients.
+         if ( ConfigData.Flags & CONFIG_DEBUG_MESSAGE_ENABLED )
+         {
+            // Get the "pretty" version of the JSON for display.  It is longer
+            // than the compact text the buffer is sized for, so with a long
+            // label and several probes the end of it is cut off.
+            JSONTextLength = SerializeJSON ( SensorData, (char*) JSONText, JSON_MAX_TEXT, true );
+
+            Serial.printf ( "JSON text length: %d%s \n  %.*s \n",
+                            (int) JSONTextLength,
+                            ( JSONTextLength < JSON_MAX_TEXT ) ? "" : " (cut off)",
+                            (int) min ( JSONTextLength, (size_t) JSON_MAX_TEXT - 1 ),
+                            JSONText
+                          );
+         }
+
+         SendFrames ( NewDescriptor );
+      }
+   }
+
+   TimingStop ( TIMING_SENSOR_COLLECT );
+
+   if ( Ready == true && ( ConfigData.Flags & CONFIG_DEBUG_MESSAGE_ENABLED ) )
+   {
+      ShowTimingStats ( "DEBUG: Timing statistics:" );
    }
 }
 
-// ---------------------------------------------------------< /SensorAction >---
+// --------------------------------------------------------< /SensorCollect >---
 
 
 
@@ -938,6 +1565,8 @@ void SensorAction ( void* Args )
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
 // 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Send only what changed to the screen.
+// 16Oct2026 DSV - Everything must be drawn again after clearing the screen.
 //
 // -----------------------------------------------------------------------------
 
@@ -946,6 +1575,7 @@ void InitDisplay (
 )
 {
    Screen->clearDisplay();
+   DisplayCacheClear();
 
    Screen->setTextSize ( 2 );
    Screen->setCursor ( 5, 0 );
@@ -954,6 +1584,8 @@ void InitDisplay (
    Screen->setCursor ( 20, 23 );
    Screen->println ( "Wait..." );
 
+   // The limits are shown until the first reading starts the trend graph in
+   // their place.
    Screen->setTextSize ( 1 );
    Screen->setCursor ( 10, 45 );
    Screen->println ( "Low temp trip:  " + (String) ConfigData.TempLowLimit );
@@ -965,7 +1597,7 @@ void InitDisplay (
 
    // Leave the screen set to the temp value display size.
    Screen->setTextSize ( 2 );
-   Screen->display();
+   DisplayFlush ( Screen );
 }
 
 // ----------------------------------------------------------< /InitDisplay >---
@@ -981,39 +1613,112 @@ void InitDisplay (
 //
 // PARAMETERS: Screen - A pointer to the screen object operate on.
 //
-//             SensorValueF - Temperature sensor value in degrees farenheit.
+//             SensorValue - Temperature sensor value to display, in sixteenths
+//                           of a degree, or FIXED_DISCONNECTED if invalid.
+//
+//             Units - The temperature units, 'F' or 'C'.
+//
+//             ProbeIndex - Which probe the sensor value came from.
+//
+//             ProbeTotal - How many probes are being reported.
 //
 //             DeviceState - Whether the device in ON (true) or OFF (false).
 //
-// RETURNS:    void
+// RETURNS:    bool - True if anything was drawn, so the screen needs to be
+//                    flushed.
 //
-// NOTES:
+// NOTES:      -  When there is more than one probe a small probe number is
+//                shown to the left of the temperature value.
+//
+//             -  Only the frame buffer is drawn.  The caller has it sent to
+//                the screen with DisplayRequest(), once for the whole update.
+//
+//             -  A line that would look the same as it already does is not
+//                drawn again.  The temperature is not even formatted when the
+//                value, units, and probe are all the same as last time (see
+//                DisplayCacheKey).
 //
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
 // 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Show the probe number and units for multiple probes.
+// 16Oct2026 DSV - Fixed point value formatted without floating point.
+// 16Oct2026 DSV - Show a fault in place of an invalid reading.
+// 16Oct2026 DSV - Leave sending the screen to the caller.
+// 16Oct2026 DSV - Skip lines that would not change.
 //
 // -----------------------------------------------------------------------------
 
-void UpdateDisplay (
+bool UpdateDisplay (
    Adafruit_SSD1306* Screen,
-   float             SensorValueF,
+   int16_t           SensorValue,
+   char              Units,
+   uint8_t           ProbeIndex,
+   uint8_t           ProbeTotal,
    bool              DeviceState
 )
 {
-   ClearLine ( Screen, 23, 2 );
-   Screen->setCursor ( 20, 23 );
+   char        Text[ FIXED_TEXT_MAX ];
+   char        Line[ DISPLAY_CACHE_TEXT ];
+   int         Split;
+   const char* State = ( DeviceState == true ) ? "Device ON" : "Device OFF";
+   uint32_t    Key;
+   bool        Drawn = false;
+
+   Key = (uint16_t) SensorValue
+       | ( (uint32_t) (uint8_t) Units << 16 )
+       | ( (uint32_t) ProbeIndex << 24 )
+       | ( ( ProbeTotal > 1 ) ? 0x80000000 : 0 );
+
+   if ( DisplayCacheKey ( DISPLAY_REGION_VALUE, Key ) == false )
+   {
+      // The line is the probe label (if any) and then the value, kept as
+      // one text so a change to either one is seen.
+      Split = ( ProbeTotal > 1 ) ? sprintf ( Line, "#%u", ProbeIndex + 1 ) : 0;
+
+      if ( SensorValue != FIXED_DISCONNECTED )
+      {
+         FormatFixed ( Text, SensorValue, 1 );
+
+         // NOTE: Character 247 is degree symbol for screen display.
+         // The one created with Alt-248 doesn't work for the SSD1306.
+         sprintf ( &Line[ Split ], "|%s %c%c", Text, (char)247, Units );
+      }
+
+      else
+      {
+         sprintf ( &Line[ Split ], "|Fault" );
+      }
+
+      if ( DisplayCacheUpdate ( DISPLAY_REGION_VALUE, Key, Line ) == true )
+      {
+         ClearLine ( Screen, 23, 2 );
+
+         Line[ Split ] = 0;
 
-   // NOTE: Character 247 is degree symbol for screen display.
-   // The one created with Alt-248 doesn't work for the SSD1306.
-   Screen->printf ( "%.1f %cF", SensorValueF, (char)247 );
-   Screen->display();
+         if ( Split > 0 )
+         {
+            Screen->setTextSize ( 1 );
+            Screen->setCursor ( 0, 27 );
+            Screen->print ( Line );
+            Screen->setTextSize ( 2 );
+         }
+
+         Screen->setCursor ( 20, 23 );
+         Screen->print ( &Line[ Split + 1 ] );
+         Drawn = true;
+      }
+   }
 
+   if ( DisplayCacheUpdate ( DISPLAY_REGION_STATE, DeviceState, State ) == true )
+   {
+      ClearLine ( Screen, 0, 2 );
+      Screen->setCursor ( 0, 0 );
+      Screen->println ( State );
+      Drawn = true;
+   }
 
-   ClearLine ( Screen, 0, 2 );
-   Screen->setCursor ( 0, 0 );
-   Screen->println ( ( DeviceState == true ) ? "Device ON" : "Device OFF" );
-   Screen->display();
+   return Drawn;
 }
 
 // --------------------------------------------------------< /UpdateDisplay >---
@@ -1033,7 +1738,7 @@ void UpdateDisplay (
 //              TextSize - The size of the text on the line being cleared.
 //
 // NOTES:     - Clearing the line of text turns off all of the pixels in the
-//              line by overwriting each row of pixels in BLACK.
+//              line, straight in the frame buffer (see DisplayClearRect).
 //
 //            - TextSize is a magnification value applied to the default
 //              character size:
@@ -1045,6 +1750,7 @@ void UpdateDisplay (
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
 // 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Clear whole pages at a time instead of row by row.
 //
 // -----------------------------------------------------------------------------
 
@@ -1063,10 +1769,7 @@ void ClearLine (
          BottomRow = SCREEN_HEIGHT;
       }
 
-      for ( int i = TopRow; i < BottomRow; i++ )
-      {
-         Screen->drawFastHLine ( 0, i, SCREEN_WIDTH, BLACK );
-      }
+      DisplayClearRect ( Screen, 0, TopRow, SCREEN_WIDTH, BottomRow - TopRow );
    }
 }
 
@@ -1093,9 +1796,17 @@ void ClearLine (
 // NOTES:      -  The timer that invoked the function is automatically reset to
 //                fire again as long as it is "armed".
 //
+//             -  Text messages from a client are commands (see SocketCommand).
+//
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
 // 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Send a new client the last reading instead of taking one.
+// 16Oct2026 DSV - Binary frames for clients that ask for the subprotocol.
+// 16Oct2026 DSV - Recent history for clients that ask for it.
+// 16Oct2026 DSV - Each client starts out subscribed to everything.
+// 16Oct2026 DSV - Each client starts out with an empty send queue.
+// 16Oct2026 DSV - Nothing sent straight away, not even to a new client.
 //
 // -----------------------------------------------------------------------------
 
@@ -1108,6 +1819,9 @@ void WebSocketEvent (
 {
 #define PAYLOAD ( ( payload != NULL ) ? payload : (unsigned char*) " " )
 
+   uint8_t  Format;
+   char*    History;
+
    Serial.print ( "Web Socket Event - " );
 
    switch ( type )
@@ -1121,6 +1835,18 @@ void WebSocketEvent (
       case WStype_DISCONNECTED:
       {
          Serial.printf ( "DISCONNECTED [%u] \n", num );
+
+         if ( num < WEBSOCKETS_SERVER_CLIENT_MAX )
+         {
+            DEBUG_PRINTF ( &ConfigData, "DEBUG: Client %u skipped %u readings and dropped %u \n",
+                           num,
+                           Clients[ num ].Skipped,
+                           Clients[ num ].Dropped
+                         );
+
+            Clients[ num ].Format = FRAME_NONE;
+         }
+
          break;
       }
 
@@ -1136,9 +1862,44 @@ void WebSocketEvent (
                          ip[3],
                          PAYLOAD
                        );
-         // Take an initial temperature reading so the client isn't left without
-         // any response until the next timer event occurs.
-         SensorAction ( NULL );
+         // A client that asked for the binary subprotocol is sent the
+         // descriptor once, and after that only binary frames.
+         Format = WebSocket.Requested ( num, WS_PROTOCOL_BINARY ) ? FRAME_BINARY : FRAME_JSON;
+
+         if ( num < WEBSOCKETS_SERVER_CLIENT_MAX )
+         {
+            // Send the most recent reading to just this client, so it isn't
+            // left without any response until the next timer event occurs.
+            // Nothing is read from the probes, so clients connecting and
+            // reconnecting cost no bus or relay activity.  It is sent from
+            // loop(), after the descriptor and any history (see DrainQueues).
+            Clients[ num ].Format     = Format;
+            Clients[ num ].Descriptor = ( Format == FRAME_BINARY && LastDescriptorLength > 0 );
+            Clients[ num ].Reading    = ( Format == FRAME_BINARY ) ? LastBinaryLength > 0 : LastFrameLength > 0;
+            Clients[ num ].Reply      = false;
+            Clients[ num ].Backfill   = 0;
+            Clients[ num ].Probes     = SDATA_ALL_PROBES;
+            Clients[ num ].Fields     = SDATA_ALL_FIELDS;
+            Clients[ num ].Interval   = 0;
+            Clients[ num ].LastSent   = millis();
+            Clients[ num ].Skipped    = 0;
+            Clients[ num ].Dropped    = 0;
+         }
+
+         // A URL of the form ws://sensor:81/?history=N asks for the N most
+         // recent readings before the live ones start.
+         History = ( payload != NULL ) ? strstr ( (char*) payload, "history=" ) : NULL;
+
+         if ( History != NULL )
+         {
+            SendBackfill ( num, strtol ( History + strlen ( "history=" ), NULL, 10 ) );
+         }
+
+         DEBUG_PRINTF ( &ConfigData, "DEBUG: Reading %u queued for client %u as %s \n",
+                        FrameSeq,
+                        num,
+                        ( Format == FRAME_BINARY ) ? "binary" : "JSON"
+                      );
 
          break;
       }
@@ -1146,6 +1907,7 @@ void WebSocketEvent (
       case WStype_TEXT:
       {
          Serial.printf ( "TEXT [%u] %s \n", num, PAYLOAD );
+         SocketCommand ( num, payload, payload_length );
          break;
       }
 
@@ -1163,162 +1925,1421 @@ void WebSocketEvent (
 
 
 // -----------------------------------------------------------------------------
-// --------------------------------------------------------------< MakeUUID >---
+// ---------------------------------------------------------< SocketCommand >---
 // -----------------------------------------------------------------------------
 //
-// PURPOSE:    Return a UUID value based on the current processor ID.
+// PURPOSE:    Carry out a command sent by a web socket client.
 //
-// PARAMETERS: Result - Memory to store the returned UUID into.
+// PARAMETERS: num - ID number of the web socket the command came from.
+//
+//             payload - The command text, a JSON object.
+//
+//             payload_length - The length of the command text.
 //
 // RETURNS:    void
 //
-// NOTES:      -  A universally unique identifier (UUID) is a 128-bit number
-//                used to identify information in a computer, that if generated
-//                correctly, has a negligible probability of being duplicated.
+// NOTES:      -  Each member of the object is a command, so several can be
+//                sent at once.  Commands that are not known are ignored.
 //
-//             -  The value of a UUID is represented in string form as 32
-//                hexadecimal digits divided into five hyphen separated groups
-//                in the form 8-4-4-4-12, for a total of 36 characters not
-//                including any NULL terminator.
+//             -  {"History":N} - Send the N most recent readings (see
+//                SendBackfill).
 //
-//                -  In version 1 UUID format, the last six bytes were known as
-//                   the "node ID", which is how this routine justifies swapping
-//                   out the last six bytes with bytes from the ESP8266 chip ID.
+//             -  {"Subscribe":{"Interval":60,"Probes":[0,2],"Fields":["Time","Probes"]}}
+//                - Send readings no more often than every Interval seconds,
+//                with only the probes and fields listed.  Any part left out
+//                means all of it, so {"Subscribe":{}} goes back to every
+//                field of every reading.  A binary client gets the probes
+//                it asked for, but always all the fields, as its frames
+//                follow the descriptor.  An Interval outside 0 to
+//                PCONFIG_MAX_WAIT seconds is refused, with the rest of the
+//                subscription.
 //
-//             -  When used as a Uniform Resource Name (URN), a UUID value
-//                takes form:  urn:uuid:dab6cd98-dcd3-4709-9566-fc03e77e8b66
+//             -  {"Set":{"LowLimit":60,"Relay":"AUTO",...}} - Change settings
+//                at once, without a restart (see SocketSet).
+//
+//             -  The text is parsed in place, the library gives each message
+//                its own buffer.
 //
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
-// 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Initial development.
+// 16Oct2026 DSV - Subscriptions.
+// 16Oct2026 DSV - Settings.
+// 16Oct2026 DSV - Subscribed interval range checked before it is made ms.
 //
 // -----------------------------------------------------------------------------
 
-void MakeUUID ( char* Result )
+void SocketCommand (
+   uint8_t        num,
+   uint8_t*       payload,
+   size_t         payload_length
+)
 {
-   uint32_t ChipID = ESP.getChipId();
+#define  SDATA_NAME(k,j,m,c,s)  #j,
 
-   Serial.printf ( "Chip ID = %d (0x%08x) \n", ChipID, ChipID );
-   //
-   // UUID generated online at https://www.uuidgenerator.net/:
-   // dab6cd98-dcd3-4709-9566-fc03e77e8b66
-   // Replace the last six characters with the ESP8266 chip ID.
-   //
-   sprintf ( Result, "dab6cd98-dcd3-4709-9566-fc03e7%02x%02x%02x",
-             (uint16_t) ((ChipID >> 16) & 0xff),
-             (uint16_t) ((ChipID >>  8) & 0xff),
-             (uint16_t) ChipID & 0xff
-           );
+   static const char* const   FieldNames[] = { SENSOR_DATA_FIELDS ( SDATA_NAME ) };
+
+   StaticJsonBuffer<SOCKET_COMMAND_JSON_SIZE> jsonBuffer;
+   SClient_t*  Client;
+   uint8_t     Probe;
+   const char* Name;
+
+   if ( payload != NULL && payload_length > 0 )
+   {
+      JsonObject& root = jsonBuffer.parseObject ( (char*) payload );
+
+      if ( root.success() == false )
+      {
+         DEBUG_PRINTF ( &ConfigData, "DEBUG: Client %u sent a command that is not JSON \n", num );
+      }
+
+      else
+      {
+         if ( root.containsKey ( "History" ) )
+         {
+            SendBackfill ( num, root[ "History" ].as<long>() );
+         }
+
+         if ( root.containsKey ( "Subscribe" ) && num < WEBSOCKETS_SERVER_CLIENT_MAX )
+         {
+            JsonObject& Subscribe = root[ "Subscribe" ].as<JsonObject>();
+            long        Seconds   = Subscribe[ "Interval" ].as<long>();
+
+            if ( Seconds < 0 || Seconds > (long) ( PCONFIG_MAX_WAIT / 1000 ) )
+            {
+               DEBUG_PRINTF ( &ConfigData, "DEBUG: Client %u subscribed every %ld seconds, not 0 to %lu, ignored \n",
+                              num,
+                              Seconds,
+                              PCONFIG_MAX_WAIT / 1000
+                            );
+            }
+
+            else
+            {
+               Client           = &Clients[ num ];
+               Client->Interval = Seconds * 1000;
+               Client->Probes   = SDATA_ALL_PROBES;
+               Client->Fields   = SDATA_ALL_FIELDS;
+
+               if ( Subscribe.containsKey ( "Probes" ) )
+               {
+                  JsonArray& Probes = Subscribe[ "Probes" ].as<JsonArray>();
+
+                  Client->Probes = 0;
+
+                  for ( size_t i = 0; i < Probes.size(); i++ )
+                  {
+                     Probe = Probes[ i ].as<unsigned int>();
+
+                     if ( Probe < PROBE_MAX )
+                     {
+                        Client->Probes |= 1 << Probe;
+                     }
+                  }
+               }
+
+               if ( Subscribe.containsKey ( "Fields" ) )
+               {
+                  JsonArray& Fields = Subscribe[ "Fields" ].as<JsonArray>();
+
+                  Client->Fields = 0;
+
+                  for ( size_t i = 0; i < Fields.size(); i++ )
+                  {
+                     Name = Fields[ i ].as<const char*>();
+
+                     for ( uint8_t Field = 0; Field < SDATA_FIELD_COUNT; Field++ )
+                     {
+                        if ( Name != NULL && strcmp ( Name, FieldNames[ Field ] ) == 0 )
+                        {
+                           Client->Fields |= 1 << Field;
+                        }
+                     }
+                  }
+               }
+
+               DEBUG_PRINTF ( &ConfigData, "DEBUG: Client %u subscribed every %u ms, probes 0x%02x, fields 0x%04x \n",
+                              num,
+                              Client->Interval,
+                              Client->Probes,
+                              Client->Fields
+                            );
+            }
+         }
+
+         if ( root.containsKey ( "Set" ) )
+         {
+            SocketSet ( num, root[ "Set" ].as<JsonObject>() );
+         }
+      }
+   }
 }
 
-// --------------------------------------------------------------< MakeUUID >---
+// --------------------------------------------------------< /SocketCommand >---
 
 
 
 // -----------------------------------------------------------------------------
-// -------------------------------------------------------< DeserializeJSON >---
+// -------------------------------------------------------------< SocketSet >---
 // -----------------------------------------------------------------------------
 //
-// PURPOSE:    Parse a JSON text buffer and populate a data structure for sensor
-//             data from the extracted values.
+// PURPOSE:    Change settings for a web socket client, straight away, and
+//             answer with the settings now in use.
 //
-// PARAMETERS: Data - The data structure to be populated with extracted values.
+// PARAMETERS: num - ID number of the web socket the command came from.
 //
-//             JSONBuffer - The JSON text buffer to parse and extract data from.
+//             Set - The settings to change, any of:
 //
-// RETURNS:    bool == true:  The JSON buffer was successfully parsed.
-//                  == false: Parsing of the JSON buffer failed.
+//                   LowLimit, HighLimit - The temperature limits, in whole
+//                                         degrees of the units in use, from
+//                                         PCONFIG_MIN_LIMIT to
+//                                         PCONFIG_MAX_LIMIT.
+//                   Interval - Seconds between readings, from
+//                              SensorWaitMin to SensorWaitMax.
+//                   Units - "F" or "C".
+//                   Relay - "ON" or "OFF" to hold the relay there by hand,
+//                           "AUTO" to give it back to the readings.
+//                   Save - true to also store the settings, so they are
+//                          kept after a restart.
 //
-// NOTES:
+//                   Units and Relay may be given in either case.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The answer looks like:
+//                {"State":{"LowLimit":60,"HighLimit":80,"Interval":15,"Units":"F",
+//                          "Relay":"AUTO","Device":"ON","Saved":0}}
+//                with "Error" added, and nothing changed, if any setting was
+//                not valid.  "Saved" is how many settings were written to
+//                the EEPROM.
+//
+//             -  Changes are only made in memory unless Save is given, so a
+//                supervisor can move the limits many times an hour without
+//                wearing out the FLASH.  Save on its own stores whatever has
+//                been changed since.
+//
+//             -  The limits are compared with readings in the units in use,
+//                so a change of Units should give the limits in the new units
+//                in the same command.
+//
+//             -  A new interval restarts the sensor timer (see ApplyConfig).
+//                A change of the relay mode is written to the relay pin at
+//                once.  The limits and units are used from the next reading.
+//                The relay mode is never stored (see RelayOverride).
+//
+//             -  The answer is sent from loop() once the client has room for
+//                it (see DrainQueues and SerializeState).
+//
+//             -  The interval is checked in seconds, as it is given, so that
+//                one too large cannot wrap around to a short interval when
+//                it is made milliseconds.  With the adaptive interval turned
+//                off it may be anything from a second to PCONFIG_MAX_WAIT.
 //
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
-// 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Initial development.
+// 16Oct2026 DSV - Changes applied by ApplyConfig.
+// 16Oct2026 DSV - Answer sent from loop() rather than straight away.
+// 16Oct2026 DSV - Interval kept within SensorWaitMin and SensorWaitMax.
+// 16Oct2026 DSV - Limits range checked, a good Relay keeps an earlier Error.
 //
 // -----------------------------------------------------------------------------
 
-bool DeserializeJSON (
-   SData_t&    Data,
-   char*       JSONBuffer
+void SocketSet (
+   uint8_t        num,
+   JsonObject&    Set
 )
 {
-   StaticJsonBuffer<SENSORDATA_JSON_SIZE> jsonBuffer;
-   JsonObject& root = jsonBuffer.parseObject ( JSONBuffer );
+#define  SAVE_SETTING(o,f)                                           \
+         if ( Stored.f != ConfigData.f )                             \
+         {                                                           \
+            SetROMValue ( o, (uint8_t*) &ConfigData.f, sizeof ( ConfigData.f ) ); \
+            Saved++;                                                 \
+         }
 
-   Data.Type     = root[ "Type" ];
-   Data.Name     = root[ "Name" ];
-   Data.Units    = root[ "Units" ];
-   Data.Value    = root[ "Value" ];
-   Data.Time     = root[ "Time" ];
-   Data.Interval = root[ "Interval" ];
+   // Stored is cleared first, as EEPROM.get() leaves it untouched if the
+   // EEPROM cannot be read.
+   PConfig_t   Before;
+   PConfig_t   Stored = { 0 };
+   int16_t     LowLimit  = ConfigData.TempLowLimit;
+   int16_t     HighLimit = ConfigData.TempHighLimit;
+   uint32_t    WaitTime  = ConfigData.SensorWaitTime;
+   uint32_t    Seconds;
+   uint32_t    Shortest  = max ( ConfigData.SensorWaitMin / 1000, (uint32_t) 1 );
+   uint32_t    Longest   = ( ( ConfigData.SensorWaitMax > 0 ) ? ConfigData.SensorWaitMax : PCONFIG_MAX_WAIT ) / 1000;
+   long        Limit;
+   uint32_t    Flags     = ConfigData.Flags;
+   uint8_t     Mode      = RelayMode;
+   const char* Value;
+   const char* Error = NULL;
+   uint8_t     Saved = 0;
+   bool        Found;
+
+   if ( Set.containsKey ( "LowLimit" ) )
+   {
+      Limit = Set[ "LowLimit" ].as<long>();
 
-   return root.success();
+      if ( Limit >= PCONFIG_MIN_LIMIT && Limit <= PCONFIG_MAX_LIMIT )
+      {
+         LowLimit = (int16_t) Limit;
+      }
+
+      else
+      {
+         Error = "LowLimit must be from -2048 to 2047";
+      }
+   }
+
+   if ( Set.containsKey ( "HighLimit" ) )
+   {
+      Limit = Set[ "HighLimit" ].as<long>();
+
+      if ( Limit >= PCONFIG_MIN_LIMIT && Limit <= PCONFIG_MAX_LIMIT )
+      {
+         HighLimit = (int16_t) Limit;
+      }
+
+      else
+      {
+         Error = "HighLimit must be from -2048 to 2047";
+      }
+   }
+
+   if ( Set.containsKey ( "Interval" ) )
+   {
+      Seconds = Set[ "Interval" ].as<unsigned long>();
+
+      if ( Seconds >= Shortest && Seconds <= Longest )
+      {
+         WaitTime = Seconds * 1000;
+      }
+
+      else
+      {
+         Error = "Interval must be from SensorWaitMin to SensorWaitMax";
+      }
+   }
+
+   if ( Set.containsKey ( "Units" ) )
+   {
+      Value = Set[ "Units" ].as<const char*>();
+
+      if ( Value != NULL && strcasecmp ( Value, "F" ) == 0 )
+      {
+         Flags |= CONFIG_TEMP_DISPLAY_FAHRENHEIT;
+      }
+
+      else if ( Value != NULL && strcasecmp ( Value, "C" ) == 0 )
+      {
+         Flags &= ~CONFIG_TEMP_DISPLAY_FAHRENHEIT;
+      }
+
+      else
+      {
+         Error = "Units must be F or C";
+      }
+   }
+
+   if ( Set.containsKey ( "Relay" ) )
+   {
+      Value = Set[ "Relay" ].as<const char*>();
+      Found = false;
+
+      for ( uint8_t i = 0; Value != NULL && i < sizeof ( RelayModeNames ) / sizeof ( RelayModeNames[ 0 ] ); i++ )
+      {
+         if ( strcasecmp ( Value, RelayModeNames[ i ] ) == 0 )
+         {
+            Mode  = i;
+            Found = true;
+         }
+      }
+
+      if ( Found == false && Error == NULL )
+      {
+         Error = "Relay must be ON, OFF, or AUTO";
+      }
+   }
+
+   if ( LowLimit >= HighLimit )
+   {
+      Error = "LowLimit must be below HighLimit";
+   }
+
+   if ( Error == NULL )
+   {
+      Before = ConfigData;
+
+      ConfigData.TempLowLimit   = LowLimit;
+      ConfigData.TempHighLimit  = HighLimit;
+      ConfigData.SensorWaitTime = WaitTime;
+      ConfigData.Flags          = Flags;
+
+      ApplyConfig ( &Before );
+
+      if ( Mode != RelayMode )
+      {
+         digitalWrite ( D6, ( RelayOverride ( Mode ) == true ) ? HIGH : LOW );
+      }
+
+      if ( Set[ "Save" ].as<bool>() == true )
+      {
+         EEPROM.get ( PCONFIG_OFFSET, Stored );
+
+         SAVE_SETTING ( PCONFIG_OFFSET_TEMPLOWLIMIT,   TempLowLimit   )
+         SAVE_SETTING ( PCONFIG_OFFSET_TEMPHIGHLIMIT,  TempHighLimit  )
+         SAVE_SETTING ( PCONFIG_OFFSET_SENSORWAITTIME, SensorWaitTime )
+         SAVE_SETTING ( PCONFIG_OFFSET_FLAGS,          Flags          )
+      }
+   }
+
+   if ( num < WEBSOCKETS_SERVER_CLIENT_MAX )
+   {
+      Clients[ num ].Reply = true;
+      Clients[ num ].Saved = Saved;
+      Clients[ num ].Error = Error;
+   }
+
+   DEBUG_PRINTF ( &ConfigData, "DEBUG: Client %u changed settings, saved %u%s%s \n",
+                  num,
+                  Saved,
+                  ( Error != NULL ) ? ", " : "",
+                  ( Error != NULL ) ? Error : ""
+                );
 }
 
-// ------------------------------------------------------< /DeserializeJSON >---
+// ------------------------------------------------------------< /SocketSet >---
 
 
 
 // -----------------------------------------------------------------------------
-// ---------------------------------------------------------< SerializeJSON >---
+// --------------------------------------------------------< SerializeState >---
 // -----------------------------------------------------------------------------
 //
-// PURPOSE:    Fill a buffer with the JSON representation of a data structure
-//             holding sensor data.
+// PURPOSE:    Make the answer to a web socket client's Set command.
 //
-// PARAMETERS: Data - The sensor data structure to be converted into JSON form.
+// PARAMETERS: Text - Where the answer is written.
 //
-//             JSONBuffer - The buffer to store the JSON formatted values into.
+//             MaxSize - The size of Text.
 //
-//             MaxSize - The size of the JSON buffer.
+//             Saved - How many settings the command stored.
 //
-//             Pretty -  Should the JSON be formatted for display and easy
-//             reading (true), or for compactness (false).
+//             Error - Why the command changed nothing, or NULL if it did.
 //
-// RETURNS:    size_t - The number of bytes of JSON text returned in the buffer.
+// RETURNS:    size_t - The length of the text.
 //
-// NOTES:
+// NOTES:      -  The settings are the ones in use when the answer is sent,
+//                so a client whose answer had to wait is not told of
+//                settings that have already been changed again.
 //
 // HISTORY:
 // --------- --- - -------------------------------------------------------------
-// 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Initial development, from SocketSet.
 //
 // -----------------------------------------------------------------------------
 
-size_t SerializeJSON (
-   const SData_t& Data,
-   char*          JSONBuffer,
+size_t SerializeState (
+   char*          Text,
    size_t         MaxSize,
-   boolean        Pretty
+   uint8_t        Saved,
+   const char*    Error
 )
 {
-   size_t   Length = 0;
-   StaticJsonBuffer<SENSORDATA_JSON_SIZE> jsonBuffer;
-   JsonObject& root = jsonBuffer.createObject();
+   JWriter_t   Writer;
+
+   JsonBegin ( &Writer, Text, MaxSize, false );
+   JsonOpen ( &Writer, NULL, '{' );
+   JsonOpen ( &Writer, "State", '{' );
+   JsonSigned ( &Writer, "LowLimit", ConfigData.TempLowLimit );
+   JsonSigned ( &Writer, "HighLimit", ConfigData.TempHighLimit );
+   JsonUnsigned ( &Writer, "Interval", ConfigData.SensorWaitTime / 1000 );
+   JsonString ( &Writer, "Units", ( ConfigData.Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT ) ? "F" : "C" );
+   JsonString ( &Writer, "Relay", RelayModeNames[ RelayMode ] );
+   JsonString ( &Writer, "Device", ( RelayState == true ) ? "ON" : "OFF" );
+   JsonUnsigned ( &Writer, "Saved", Saved );
+
+   if ( Error != NULL )
+   {
+      JsonString ( &Writer, "Error", Error );
+   }
 
-   root[ "Type" ]     = Data.Type;
-   root[ "Name" ]     = Data.Name;
-   root[ "Units" ]    = Data.Units;
-   root[ "Value" ]    = Data.Value;
-   root[ "Time" ]     = Data.Time;
-   root[ "Interval" ] = Data.Interval;
+   JsonClose ( &Writer, '}' );
+   JsonClose ( &Writer, '}' );
 
-   if ( Pretty == true )
+   return JsonEnd ( &Writer );
+}
+
+// -------------------------------------------------------< /SerializeState >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< ApplyConfig >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Put changed settings into effect without a restart, where that
+//             can be done.
+//
+// PARAMETERS: Before - The settings before they were changed.  ConfigData
+//                      holds the new ones.
+//
+// RETURNS:    bool - True if some of the changes only take effect after a
+//                    restart.
+//
+// NOTES:      -  Most settings, such as the limits, label, units, hysteresis,
+//                and relay times, are read from ConfigData each time they
+//                are used, and are in effect already.
+//
+//             -  A new reading interval sets the sensor timer again, and a
+//                new baud rate starts the serial port again, straight away.
+//
+//             -  A new web server or web socket port starts just that
+//                service again, once the web request that changed it has
+//                been answered (see RestartServices).
+//
+//             -  The wifi settings and whether a probe is connected are only
+//                used at start-up, so need a restart.  A new label is used
+//                for the wifi host name after the next restart too, but that
+//                alone is not worth one.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+bool ApplyConfig (
+   const PConfig_t* Before
+)
+{
+#define  CHANGED(f)  ( memcmp ( &Before->f, &ConfigData.f, sizeof ( ConfigData.f ) ) != 0 )
+
+   uint32_t Start = micros();
+   uint8_t  Which = 0;
+   bool     Restart;
+
+   Restart =  CHANGED ( WifiSSID )
+           || CHANGED ( WifiPassword )
+           || CHANGED ( AccessIP )
+           || CHANGED ( NetMask )
+           || CHANGED ( Gateway )
+           || ( ( Before->Flags ^ ConfigData.Flags )
+                & ( CONFIG_WIFI_STATION_ENABLED | CONFIG_TEMP_PROBE_CONNECTED ) );
+
+   if ( CHANGED ( SensorWaitTime ) || CHANGED ( SensorWaitMin ) || CHANGED ( SensorWaitMax ) )
    {
-      root.prettyPrintTo ( JSONBuffer, MaxSize );
-      Length = root.measurePrettyLength();
+      SensorPeriod = ConfigData.SensorWaitTime;
+
+      os_timer_disarm ( &TemperatureTimer );
+      os_timer_arm ( &TemperatureTimer, SensorPeriod, true );
    }
 
-   else
+   if ( CHANGED ( SerialBaud ) )
    {
-      root.printTo ( JSONBuffer, MaxSize );
-      Length = root.measureLength();
+      Serial.flush();
+      Serial.begin ( ConfigData.SerialBaud );
    }
 
-   return Length;
-}
+   if ( CHANGED ( WebServerPort ) )
+   {
+      Which |= RESTART_WEB_SERVER;
+   }
+
+   if ( CHANGED ( WebSocketServerPort ) )
+   {
+      Which |= RESTART_WEB_SOCKET;
+   }
+
+   if ( Which != 0 && ( Services & WIFI_CONNECTED ) )
+   {
+      schedule_function ( std::bind ( &RestartServices, Which ) );
+   }
+
+   DEBUG_PRINTF ( &ConfigData, "DEBUG: Settings applied in %lu us, %s \n",
+                  micros() - Start,
+                  ( Restart == true ) ? "some need a restart" : "no restart needed"
+                );
+
+   return Restart;
+}
+
+// ----------------------------------------------------------< /ApplyConfig >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< RestartServices >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Start network services again on their configured ports.
+//
+// PARAMETERS: Which - RESTART_WEB_SERVER and/or RESTART_WEB_SOCKET.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Scheduled by ApplyConfig() rather than called from it, so the
+//                web server is not closed while it is still answering the
+//                request that changed its port.
+//
+//             -  Web socket clients are disconnected, and are expected to
+//                connect again on the new port.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void RestartServices (
+   uint8_t        Which
+)
+{
+   uint32_t Start = micros();
+
+   if ( Which & RESTART_WEB_SERVER )
+   {
+      WebServer.close();
+      WebServer.begin ( ConfigData.WebServerPort );
+      SSDP.setHTTPPort ( ConfigData.WebServerPort );
+
+      Serial.printf ( "Web server started on port %d \n", ConfigData.WebServerPort );
+   }
+
+   if ( Which & RESTART_WEB_SOCKET )
+   {
+      WebSocket.Listen ( ConfigData.WebSocketServerPort );
+
+      Serial.printf ( "Web socket server started on port %d \n", ConfigData.WebSocketServerPort );
+   }
+
+   DEBUG_PRINTF ( &ConfigData, "DEBUG: Services restarted in %lu us \n", micros() - Start );
+}
+
+// ------------------------------------------------------< /RestartServices >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< SendBackfill >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send a web socket client the most recent readings from the
+//             history, all in one message.
+//
+// PARAMETERS: num - ID number of the web socket to send to.
+//
+//             Count - How many readings are wanted, as the client asked for
+//                     them.  No more than BACKFILL_MAX are sent, and none if
+//                     it is zero or less.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Nothing is written to the socket here.  The count is only
+//                noted, and the history is made and sent from loop() once
+//                the client has room for it (see DrainQueues).  A client
+//                that asks again before then is sent it once, with the
+//                count it asked for last.
+//
+//             -  Sent as JSON text to binary clients too.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+// 16Oct2026 DSV - Count limited before it is narrowed.
+// 16Oct2026 DSV - Sent from loop() rather than straight away.
+//
+// -----------------------------------------------------------------------------
+
+void SendBackfill (
+   uint8_t        num,
+   long           Count
+)
+{
+   Count = constrain ( Count, 0, BACKFILL_MAX );
+
+   if ( num < WEBSOCKETS_SERVER_CLIENT_MAX )
+   {
+      Clients[ num ].Backfill = (uint16_t) Count;
+   }
+}
+
+// ---------------------------------------------------------< /SendBackfill >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------< SerializeBackfill >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Make the message that gives a web socket client the most
+//             recent readings from the history.
+//
+// PARAMETERS: Text - Where the message is written.
+//
+//             MaxSize - The size of Text.
+//
+//             Count - How many readings to give, no more than BACKFILL_MAX.
+//
+// RETURNS:    size_t - The length of the text, no more than
+//                      BACKFILL_TEXT ( Count ).
+//
+// NOTES:      -  The message looks like:
+//                {"History":{"Now":1234,"Units":"F","Samples":[[1200,0,72.50],...]}}
+//                with the samples the same as /History.json gives them, so
+//                a chart gets its data in the same round trip as the live
+//                readings that follow, without polling.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development, from SendBackfill.
+//
+// -----------------------------------------------------------------------------
+
+size_t SerializeBackfill (
+   char*          Text,
+   size_t         MaxSize,
+   uint16_t       Count
+)
+{
+   JWriter_t   Writer;
+   HCursor_t   Cursor;
+   uint8_t     Probe;
+   int16_t     Value;
+   uint32_t    Time;
+
+   HistoryFirst ( &Cursor, Count );
+
+   JsonBegin ( &Writer, Text, MaxSize, false );
+   JsonOpen ( &Writer, NULL, '{' );
+   JsonOpen ( &Writer, "History", '{' );
+   JsonUnsigned ( &Writer, "Now", millis() / 1000 );
+   JsonString ( &Writer, "Units", ( ConfigData.Flags & CONFIG_TEMP_DISPLAY_FAHRENHEIT ) ? "F" : "C" );
+   JsonOpen ( &Writer, "Samples", '[' );
+
+   while ( HistoryNext ( &Cursor, &Probe, &Value, &Time ) )
+   {
+      JsonOpen ( &Writer, NULL, '[' );
+      JsonUnsigned ( &Writer, NULL, Time );
+      JsonUnsigned ( &Writer, NULL, Probe );
+      JsonFixed ( &Writer, NULL, FixedUnits ( &ConfigData, Value ), JSON_TEMP_PLACES );
+      JsonClose ( &Writer, ']' );
+   }
+
+   JsonClose ( &Writer, ']' );
+   JsonClose ( &Writer, '}' );
+   JsonClose ( &Writer, '}' );
+
+   return JsonEnd ( &Writer );
+}
+
+// ----------------------------------------------------< /SerializeBackfill >---
+
+
+
+// -----------------------------------------------------------------------------
+// --------------------------------------------------------------< MakeUUID >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Return a UUID value based on the current processor ID.
+//
+// PARAMETERS: Result - Memory to store the returned UUID into.
+//
+// RETURNS:    void
+//
+// NOTES:      -  A universally unique identifier (UUID) is a 128-bit number
+//                used to identify information in a computer, that if generated
+//                correctly, has a negligible probability of being duplicated.
+//
+//             -  The value of a UUID is represented in string form as 32
+//                hexadecimal digits divided into five hyphen separated groups
+//                in the form 8-4-4-4-12, for a total of 36 characters not
+//                including any NULL terminator.
+//
+//                -  In version 1 UUID format, the last six bytes were known as
+//                   the "node ID", which is how this routine justifies swapping
+//                   out the last six bytes with bytes from the ESP8266 chip ID.
+//
+//             -  When used as a Uniform Resource Name (URN), a UUID value
+//                takes form:  urn:uuid:dab6cd98-dcd3-4709-9566-fc03e77e8b66
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 25Oct2018 DSV - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void MakeUUID ( char* Result )
+{
+   uint32_t ChipID = ESP.getChipId();
+
+   Serial.printf ( "Chip ID = %d (0x%08x) \n", ChipID, ChipID );
+   //
+   // UUID generated online at https://www.uuidgenerator.net/:
+   // dab6cd98-dcd3-4709-9566-fc03e77e8b66
+   // Replace the last six characters with the ESP8266 chip ID.
+   //
+   sprintf ( Result, "dab6cd98-dcd3-4709-9566-fc03e7%02x%02x%02x",
+             (uint16_t) ((ChipID >> 16) & 0xff),
+             (uint16_t) ((ChipID >>  8) & 0xff),
+             (uint16_t) ChipID & 0xff
+           );
+}
+
+// --------------------------------------------------------------< MakeUUID >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< DeserializeJSON >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Parse a JSON text buffer and populate a data structure for sensor
+//             data from the extracted values.
+//
+// PARAMETERS: Data - The data structure to be populated with extracted values.
+//
+//             JSONBuffer - The JSON text buffer to parse and extract data from.
+//
+// RETURNS:    bool == true:  The JSON buffer was successfully parsed.
+//                  == false: Parsing of the JSON buffer failed.
+//
+// NOTES:      -  The "Value" is converted to sixteenths of a degree.  This is
+//                not on the path of a sensor reading, so the float parsed by
+//                the JSON library is simply scaled.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Fixed point "Value".
+//
+// -----------------------------------------------------------------------------
+
+bool DeserializeJSON (
+   SData_t&    Data,
+   char*       JSONBuffer
+)
+{
+   StaticJsonBuffer<SENSORDATA_JSON_SIZE> jsonBuffer;
+   JsonObject& root = jsonBuffer.parseObject ( JSONBuffer );
+
+   Data.Type     = root[ "Type" ];
+   Data.Name     = root[ "Name" ];
+   Data.Units    = root[ "Units" ];
+   Data.Value    = lroundf ( (float) root[ "Value" ] * FIXED_ONE );
+   Data.Time     = root[ "Time" ];
+   Data.Interval = root[ "Interval" ];
+
+   // The individual probe values are not kept, there is nowhere to put them.
+   Data.Values     = NULL;
+   Data.ValueCount = 0;
+
+   return root.success();
+}
+
+// ------------------------------------------------------< /DeserializeJSON >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------------< SerializeJSON >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Fill a buffer with the JSON representation of a data structure
+//             holding sensor data.
+//
+// PARAMETERS: Data - The sensor data structure to be converted into JSON form.
+//
+//             JSONBuffer - The buffer to store the JSON formatted values into.
+//
+//             MaxSize - The size of the JSON buffer.
+//
+//             Pretty -  Should the JSON be formatted for display and easy
+//             reading (true), or for compactness (false).
+//
+//             Fields - One bit for each field to write (see SDATA_FIELD_BIT),
+//                      all of them if left out.
+//
+// RETURNS:    size_t - The number of bytes of JSON text returned in the buffer.
+//
+// NOTES:      -  The "Probes" array holds the value from every probe, while
+//                "Value" holds the first probe's value for older clients.
+//
+//             -  The fields are written straight into the buffer in one pass,
+//                in the order of SENSOR_DATA_FIELDS, with no JSON object built
+//                in memory first.  The text is the same as the JSON library
+//                wrote (see SerializeBenchmark in the host build).
+//
+//             -  An invalid reading is sent as null.
+//
+//             -  As with the JSON library, the length returned is the full
+//                length even if the buffer was too small to hold it all.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 25Oct2018 DSV - Initial development.
+// 16Oct2026 DSV - Added the "Probes" array.
+// 16Oct2026 DSV - Fixed point values formatted as text.
+// 16Oct2026 DSV - Invalid values sent as null.
+// 16Oct2026 DSV - Written directly from the field list, without the library.
+// 16Oct2026 DSV - Only the fields a client subscribed to.
+//
+// -----------------------------------------------------------------------------
+
+size_t SerializeJSON (
+   const SData_t& Data,
+   char*          JSONBuffer,
+   size_t         MaxSize,
+   boolean        Pretty,
+   uint16_t       Fields
+)
+{
+#define  SDATA_JSON(k,j,m,c,s)                                       \
+         if ( Fields & SDATA_FIELD_BIT ( j ) )                       \
+         {                                                           \
+            SDATA_JSON_##k ( &Writer, Data, j, m, c );               \
+         }
+
+   JWriter_t   Writer;
+
+   JsonBegin ( &Writer, JSONBuffer, MaxSize, Pretty );
+   JsonOpen ( &Writer, NULL, '{' );
+
+   SENSOR_DATA_FIELDS ( SDATA_JSON )
+
+   JsonClose ( &Writer, '}' );
+
+   return JsonEnd ( &Writer );
+}
+
+// --------------------------------------------------------< /SerializeJSON >---
+
+
+
+// -----------------------------------------------------------------------------
+// ---------------------------------------------------< SerializeDescriptor >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Fill a buffer with the JSON descriptor sent to binary clients,
+//             holding the fields that are not in each binary frame, and the
+//             layout of the binary frame.
+//
+// PARAMETERS: Data - The sensor data structure to describe.
+//
+//             JSONBuffer - The buffer to store the JSON text into.
+//
+//             MaxSize - The size of the JSON buffer.
+//
+// RETURNS:    size_t - The number of bytes of JSON text returned in the buffer.
+//
+// NOTES:      -  The descriptor looks like:
+//                {"Type":"Temperature","Name":"Lab","Units":"F","Interval":5,
+//                 "Frame":["Value:i16","Time:u32","Seq:u32","Probes:u8+i16[]"],
+//                 "Scale":16,"Invalid":-2032}
+//                where "Frame" lists the fields of each binary frame in order,
+//                little endian, "u8+i16[]" is a count followed by that many
+//                values, temperatures are in 1/"Scale" of a degree, and a
+//                temperature of "Invalid" means the probe could not be read.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+size_t SerializeDescriptor (
+   const SData_t& Data,
+   char*          JSONBuffer,
+   size_t         MaxSize
+)
+{
+#define  SDATA_DESC(k,j,m,c,s)       SDATA_DESC_##s ( k, j, m, c )
+#define  SDATA_DESC_META(k,j,m,c)    SDATA_JSON_##k ( &Writer, Data, j, m, c );
+#define  SDATA_DESC_EACH(k,j,m,c)
+#define  SDATA_LAYOUT(k,j,m,c,s)     SDATA_LAYOUT_##s ( k, j )
+#define  SDATA_LAYOUT_META(k,j)
+#define  SDATA_LAYOUT_EACH(k,j)      JsonString ( &Writer, NULL, #j ":" SDATA_TYPE_##k );
+
+   JWriter_t   Writer;
+
+   JsonBegin ( &Writer, JSONBuffer, MaxSize, false );
+   JsonOpen ( &Writer, NULL, '{' );
+
+   SENSOR_DATA_FIELDS ( SDATA_DESC )
+
+   JsonOpen ( &Writer, "Frame", '[' );
+   SENSOR_DATA_FIELDS ( SDATA_LAYOUT )
+   JsonClose ( &Writer, ']' );
+
+   JsonUnsigned ( &Writer, "Scale", FIXED_ONE );
+   JsonSigned ( &Writer, "Invalid", FIXED_DISCONNECTED );
+
+   JsonClose ( &Writer, '}' );
+
+   return JsonEnd ( &Writer );
+}
+
+// --------------------------------------------------< /SerializeDescriptor >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------< SerializeBinary >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Fill a buffer with the binary frame sent to binary clients for
+//             each reading.
+//
+// PARAMETERS: Data - The sensor data structure to be packed.
+//
+//             Buffer - The buffer to store the binary frame into.
+//
+//             MaxSize - The size of the buffer, at least SENSOR_BINARY_MAX.
+//
+// RETURNS:    size_t - The number of bytes in the binary frame.
+//
+// NOTES:      -  Only the EACH fields are packed, in the order of
+//                SENSOR_DATA_FIELDS.  The layout is given to the client by
+//                SerializeDescriptor().  With one probe a frame is 13 bytes,
+//                where the JSON text is around 130.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+size_t SerializeBinary (
+   const SData_t& Data,
+   uint8_t*       Buffer,
+   size_t         MaxSize
+)
+{
+#define  SDATA_PACK(k,j,m,c,s)       SDATA_PACK_##s ( k, m, c )
+#define  SDATA_PACK_META(k,m,c)
+#define  SDATA_PACK_EACH(k,m,c)      Length = SDATA_BIN_##k ( Buffer, Length, Data, m, c );
+
+   size_t   Length = 0;
+
+   assert ( MaxSize >= SENSOR_BINARY_MAX );
+
+   SENSOR_DATA_FIELDS ( SDATA_PACK )
+
+   return Length;
+}
+
+// ------------------------------------------------------< /SerializeBinary >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------------< PackLE >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add a number to a binary frame, least significant byte first.
+//
+// PARAMETERS: Buffer - The binary frame.
+//
+//             Length - The length of the frame so far.
+//
+//             Value - The number to add.
+//
+//             Bytes - How many bytes of the number to add.
+//
+// RETURNS:    size_t - The length of the frame with the number added.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+size_t PackLE (
+   uint8_t*       Buffer,
+   size_t         Length,
+   uint32_t       Value,
+   uint8_t        Bytes
+)
+{
+   for ( uint8_t i = 0; i < Bytes; i++ )
+   {
+      Buffer[ Length++ ] = (uint8_t) ( Value >> ( 8 * i ) );
+   }
+
+   return Length;
+}
+
+// ---------------------------------------------------------------< /PackLE >---
+
+
+
+// -----------------------------------------------------------------------------
+// -------------------------------------------------------------< PackTemps >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Add an array of temperatures to a binary frame: a count byte,
+//             then each value as 16 bits, least significant byte first.
+//
+// PARAMETERS: Buffer - The binary frame.
+//
+//             Length - The length of the frame so far.
+//
+//             Values - The temperatures, or NULL for none.
+//
+//             Count - The number of temperatures.
+//
+// RETURNS:    size_t - The length of the frame with the array added.
+//
+// NOTES:
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+size_t PackTemps (
+   uint8_t*       Buffer,
+   size_t         Length,
+   const int16_t* Values,
+   uint8_t        Count
+)
+{
+   if ( Values == NULL )
+   {
+      Count = 0;
+   }
+
+   Buffer[ Length++ ] = Count;
+
+   for ( uint8_t i = 0; i < Count; i++ )
+   {
+      Length = PackLE ( Buffer, Length, (uint16_t) Values[ i ], 2 );
+   }
+
+   return Length;
+}
+
+// ------------------------------------------------------------< /PackTemps >---
+
+
+
+// -----------------------------------------------------------------------------
+// ----------------------------------------------------------< SelectProbes >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Make a copy of the sensor data holding only some of the probes.
+//
+// PARAMETERS: Data - The sensor data to copy.
+//
+//             Probes - One bit for each probe to keep.
+//
+//             Subset - Where the copy is made.
+//
+//             Values - Room for PROBE_MAX values, which the copy points to.
+//
+// RETURNS:    void
+//
+// NOTES:      -  The probes kept are still in order, so a client that asked
+//                for probes 0 and 2 gets a "Probes" array of two values.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+//
+// -----------------------------------------------------------------------------
+
+void SelectProbes (
+   const SData_t& Data,
+   uint8_t        Probes,
+   SData_t&       Subset,
+   int16_t*       Values
+)
+{
+   uint8_t  Count = 0;
+
+   Subset = Data;
+
+   for ( uint8_t i = 0; Data.Values != NULL && i < min ( Data.ValueCount, (uint8_t) PROBE_MAX ); i++ )
+   {
+      if ( Probes & ( 1 << i ) )
+      {
+         Values[ Count++ ] = Data.Values[ i ];
+      }
+   }
+
+   Subset.Values     = Values;
+   Subset.ValueCount = Count;
+}
+
+// ---------------------------------------------------------< /SelectProbes >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------------< SendFrames >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Queue the most recent reading for each connected web socket
+//             client in the format, and with the parts, it asked for.
+//
+// PARAMETERS: NewDescriptor - True if the descriptor has changed since it was
+//                             last sent, so binary clients need it again.
+//
+// RETURNS:    void
+//
+// NOTES:      -  Nothing is written to a socket here, the readings are only
+//                queued, and are sent from loop() as each connection has
+//                room for them (see DrainQueues).  A client on a weak link
+//                can no longer hold up the others, or the next reading, the
+//                way broadcastTXT() did while it wrote to each one in turn.
+//
+//             -  A reading that comes before a client's subscribed interval
+//                is up is not queued for it at all, and costs it no radio
+//                time.  Half a sensor period of slack is allowed, so a 60
+//                second interval with readings every 15 seconds sends every
+//                fourth reading even if the timer runs a little early.
+//
+//             -  A client still owed the last reading is owed this one
+//                instead, and the last one is counted as dropped.  A client
+//                that falls behind skips to the newest reading rather than
+//                getting further and further behind.
+//
+//             -  A binary client owed a new descriptor is sent it before any
+//                more frames.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+// 16Oct2026 DSV - Subscribed intervals, probes and fields for each client.
+// 16Oct2026 DSV - Queued for each client instead of sent straight away.
+// 16Oct2026 DSV - Only the newest reading is owed, and none are copied.
+//
+// -----------------------------------------------------------------------------
+
+void SendFrames (
+   bool           NewDescriptor
+)
+{
+   SClient_t*  Client;
+   uint32_t    Now = millis();
+
+   for ( uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++ )
+   {
+      Client = &Clients[ num ];
+
+      if ( Client->Format == FRAME_BINARY )
+      {
+         Client->Descriptor = Client->Descriptor || NewDescriptor;
+      }
+
+      if ( Client->Format == FRAME_NONE )
+      {
+         // Nobody connected with this ID.
+      }
+
+      else if ( Now - Client->LastSent + SensorPeriod / 2 < Client->Interval )
+      {
+         Client->Skipped++;
+      }
+
+      else
+      {
+         if ( Client->Reading == true )
+         {
+            Client->Dropped++;
+         }
+
+         Client->LastSent = Now;
+         Client->Reading  = true;
+      }
+   }
+}
+
+// -----------------------------------------------------------< /SendFrames >---
+
+
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------< DrainQueues >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Send each web socket client the messages it is owed that its
+//             connection has room for.
+//
+// PARAMETERS: None
+//
+// RETURNS:    void
+//
+// NOTES:      -  A message is only written when the client's TCP send buffer
+//                can take all of it, so the write returns at once instead of
+//                waiting for the client to acknowledge earlier data.  What
+//                does not fit waits for a later pass through loop().
+//
+//             -  The messages go in the order a new client needs them: the
+//                descriptor, the history, the answer to a Set command, and
+//                then the newest reading.  Nothing goes ahead of a message
+//                that has to wait.
+//
+//             -  Room is checked for before a message is made, so a client
+//                that is not reading costs no time making text for it on
+//                every pass.  The most a message can need is known: part of
+//                a reading is never longer than all of it.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development.
+// 16Oct2026 DSV - History, the answers to Set commands, and a new client's
+//                 first reading sent from here too.
+//
+// -----------------------------------------------------------------------------
+
+void DrainQueues ()
+{
+   SClient_t*     Client;
+   const uint8_t* Data;
+   size_t         Length;
+   bool           Ready;
+
+   for ( uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++ )
+   {
+      Client = &Clients[ num ];
+      Ready  = ( Client->Format != FRAME_NONE );
+
+      if ( Ready == true && Client->Descriptor == true )
+      {
+         Ready = WebSocket.Writable ( num, LastDescriptorLength + SOCKET_FRAME_HEADER );
+
+         if ( Ready == true )
+         {
+            WebSocket.sendTXT ( num, LastDescriptor, LastDescriptorLength );
+            Client->Descriptor = false;
+         }
+      }
+
+      if ( Ready == true && Client->Backfill > 0 )
+      {
+         Ready = WebSocket.Writable ( num, BACKFILL_TEXT ( Client->Backfill ) + SOCKET_FRAME_HEADER );
+
+         if ( Ready == true )
+         {
+            Length = SerializeBackfill ( SocketText, SOCKET_TEXT_MAX, Client->Backfill );
+            assert ( Length < SOCKET_TEXT_MAX );
+
+            WebSocket.sendTXT ( num, SocketText, Length );
+            Client->Backfill = 0;
+
+            DEBUG_PRINTF ( &ConfigData, "DEBUG: Sent %u bytes of history to client %u \n", (unsigned int) Length, num );
+         }
+      }
+
+      if ( Ready == true && Client->Reply == true )
+      {
+         Ready = WebSocket.Writable ( num, JSON_MAX_TEXT + SOCKET_FRAME_HEADER );
+
+         if ( Ready == true )
+         {
+            Length = SerializeState ( SocketText, JSON_MAX_TEXT, Client->Saved, Client->Error );
+            assert ( Length < JSON_MAX_TEXT );
+
+            WebSocket.sendTXT ( num, SocketText, Length );
+            Client->Reply = false;
+         }
+      }
+
+      if ( Ready == true && Client->Reading == true )
+      {
+         Length = ( Client->Format == FRAME_BINARY ) ? LastBinaryLength : LastFrameLength;
+         Ready  = WebSocket.Writable ( num, Length + SOCKET_FRAME_HEADER );
+
+         if ( Ready == true )
+         {
+            Length = SerializeReading ( Client, &Data );
+
+            if ( Client->Format == FRAME_BINARY )
+            {
+               WebSocket.sendBIN ( num, Data, Length );
+            }
+
+            else
+            {
+               WebSocket.sendTXT ( num, (const char*) Data, Length );
+            }
+
+            Client->Reading = false;
+         }
+      }
+   }
+}
+
+// ----------------------------------------------------------< /DrainQueues >---
+
+
+
+// -----------------------------------------------------------------------------
+// ------------------------------------------------------< SerializeReading >---
+// -----------------------------------------------------------------------------
+//
+// PURPOSE:    Give the newest reading in the format, and with the parts, a
+//             web socket client asked for.
+//
+// PARAMETERS: Client - The client the reading is for.
+//
+//             Data - Returns where the reading is.
+//
+// RETURNS:    size_t - The length of the reading.
+//
+// NOTES:      -  Text is only made for a client that wants part of a reading,
+//                in SocketText.  Clients that want all of it are given
+//                LastFrame or LastBinary as they are.
+//
+// HISTORY:
+// --------- --- - -------------------------------------------------------------
+// 16Oct2026 DSV - Initial development, from SendFrames.
+//
+// -----------------------------------------------------------------------------
+
+size_t SerializeReading (
+   const SClient_t* Client,
+   const uint8_t**  Data
+)
+{
+   SData_t     Subset;
+   int16_t     Values[ PROBE_MAX ];
+   size_t      Length;
+
+   if ( Client->Format == FRAME_BINARY && Client->Probes == SDATA_ALL_PROBES )
+   {
+      *Data  = LastBinary;
+      Length = LastBinaryLength;
+   }
+
+   else if ( Client->Format == FRAME_BINARY )
+   {
+      SelectProbes ( LastData, Client->Probes, Subset, Values );
+      *Data  = (const uint8_t*) SocketText;
+      Length = SerializeBinary ( Subset, (uint8_t*) SocketText, SENSOR_BINARY_MAX );
+   }
+
+   else if ( Client->Probes == SDATA_ALL_PROBES && Client->Fields == SDATA_ALL_FIELDS )
+   {
+      *Data  = (const uint8_t*) LastFrame;
+      Length = LastFrameLength;
+   }
+
+   else
+   {
+      SelectProbes ( LastData, Client->Probes, Subset, Values );
+      *Data  = (const uint8_t*) SocketText;
+      Length = SerializeJSON ( Subset, SocketText, JSON_MAX_TEXT, false, Client->Fields );
+      assert ( Length < JSON_MAX_TEXT );
+   }
+
+   return Length;
+}
+
+// -----------------------------------------------------< /SerializeReading >---
 
-// --------------------------------------------------------< /SerializeJSON >---
 
 
 // -----------------------------------------------------------------------------